@@ -33,6 +33,7 @@ extern "C" {
 /* Includes ================================================================ */
 
 #include <assert.h>
+#include <stdarg.h>
 #include <stddef.h>
 
 #include "raylib.h"
@@ -51,10 +52,14 @@ extern "C" {
 /* 게임의 목표 FPS */
 #define TARGET_FPS                          60
 
-/* 게임 창의 크기 */
+/* 게임 창의 (처음) 크기 */
 #define SCREEN_WIDTH                        1280
 #define SCREEN_HEIGHT                       800
 
+/* 게임 창의 최소 크기 */
+#define SCREEN_MIN_WIDTH                    800
+#define SCREEN_MIN_HEIGHT                   800
+
 /* 게임 창의 이름 */
 #define WINDOW_TITLE                        "jdeokkim/mvp-demo (" \
                                                 DEMO_VERSION      \
@@ -74,10 +79,32 @@ extern "C" {
 #define CULL_DISTANCE_FAR_MIN_VALUE         128.0f
 #define CULL_DISTANCE_FAR_MAX_VALUE         512.0f
 
-/* 격자의 간격, 칸 개수와 각 선의 두께 */
+/* 그리기 명령 목록에 기록할 수 있는 명령의 최대 개수 */
+#define DRAW_COMMAND_LIST_CAPACITY          64
+
+/* 게임 세계에 존재하는 물체 하나의 정점 정보 개수 */
+#define GAME_OBJECT_VERTEX_COUNT            8
+
+/* 격자의 간격, 칸 개수와 각 선의 두께 (픽셀) */
 #define GRID_SPACING_VALUE                  1.0f
 #define GRID_SLICES_VALUE                   512.0f
-#define GRID_THICK_VALUE                    0.03f
+#define GRID_LINE_WIDTH_VALUE               1.5f
+
+/* 글리프 캐시에서 글리프를 래스터화할 글꼴 파일의 경로 (실행 파일 기준) */
+#define GLYPH_FONT_FILE_NAME                "%sfonts/DungGeunMo.ttf"
+
+/* 글리프 캐시의 아틀라스 페이지 개수와 크기 (픽셀) */
+#define GLYPH_PAGE_COUNT                    4
+#define GLYPH_PAGE_SIZE                     256
+
+/* 글리프 캐시의 아틀라스 페이지에서 글리프 하나가 차지하는 칸의 크기 (픽셀) */
+#define GLYPH_CELL_SIZE                     24
+
+/* 미리 디코딩한 이미지 블롭 (blob)의 식별자 */
+#define IMAGE_BLOB_MAGIC                    "MVPI"
+
+/* 병렬 작업을 처리하는 작업 스레드의 최대 개수 */
+#define JOB_MAX_WORKER_COUNT                8
 
 /* 레이블에 들어갈 문자열의 최대 길이 */
 #define LABEL_TEXT_LENGTH                   32
@@ -85,9 +112,72 @@ extern "C" {
 /* 행렬의 각 요소를 문자열로 나타냈을 때, 그 문자열의 최대 길이 */
 #define MATRIX_VALUE_TEXT_LENGTH            16
 
+/* 행렬의 각 요소를 문자열로 나타낼 때, 소수점 아래 자릿수 */
+#define MATRIX_VALUE_PRECISION              1
+
+/* 메시 캐시에 저장할 수 있는 메시 파일의 최대 개수 */
+#define MESH_CACHE_CAPACITY                 8
+
+/* 렌더 그래프에 추가할 수 있는 렌더 패스와 렌더 타깃의 최대 개수 */
+#define RENDER_GRAPH_PASS_CAPACITY          16
+#define RENDER_GRAPH_TARGET_CAPACITY        16
+
+/* 렌더 패스 하나가 입력으로 읽을 수 있는 렌더 타깃의 최대 개수 */
+#define RENDER_GRAPH_PASS_INPUT_CAPACITY    4
+
 /* MVP 영역에 그릴 화면의 종류를 몇 초 동안 보여줄지 설정 */
 #define RENDER_MODE_ANIMATION_DURATION      3.75f
 
+/* 렌더 텍스처 풀에 저장할 수 있는 렌더 텍스처의 최대 개수 */
+#define RENDER_TEXTURE_POOL_CAPACITY        16
+
+/* 렌더 텍스처 풀의 렌더 텍스처가 기본으로 사용하는 색상 버퍼의 픽셀 형식 */
+#define RENDER_TEXTURE_FORMAT               PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+
+/* 렌더 텍스처 풀의 렌더 텍스처 크기 단위 (픽셀) */
+#define RENDER_TEXTURE_BUCKET_SIZE          256
+
+/* 사용되지 않는 렌더 텍스처를 몇 초 후에 해제할지 설정 */
+#define RENDER_TEXTURE_IDLE_DURATION        2.0f
+
+/* 입력 기록 파일에 저장할 수 있는 프레임의 최대 개수 */
+#define REPLAY_FRAME_CAPACITY               36000
+
+/* 입력 기록 파일에 저장할 수 있는 GUI 값 변경 이벤트의 최대 개수 */
+#define REPLAY_VALUE_EVENT_CAPACITY         16384
+
+/* 장면 그래프에 추가할 수 있는 노드의 최대 개수 */
+#define SCENE_NODE_CAPACITY                 1024
+
+/* 셰이더 프로그램 바이너리 캐시 파일을 저장할 디렉토리 */
+#define SHADER_CACHE_DIRECTORY              ".mvp-shader-cache"
+
+/* 장면 스냅샷 파일에 저장할 메시 파일 경로의 최대 길이 */
+#define SNAPSHOT_PATH_LENGTH                512
+
+/* 단축키로 저장하고 불러올 수 있는 장면 스냅샷 (프리셋)의 개수 */
+#define SNAPSHOT_PRESET_COUNT               8
+
+/* 장면 스냅샷 (프리셋) 파일의 이름 */
+#define SNAPSHOT_PRESET_FILE_NAME           "preset-%d.mvps"
+
+/* 타임라인의 각 채널에 추가할 수 있는 키프레임의 최대 개수 */
+#define TIMELINE_KEYFRAME_CAPACITY          64
+
+/* 타임라인의 최대 길이 (초) */
+#define TIMELINE_MAX_DURATION               10
+
+/* 타임라인의 값을 1초에 몇 번씩 미리 계산해 놓을지 설정 */
+#define TIMELINE_SAMPLE_RATE                120
+
+/* 매 프레임마다 초기화되는 메모리 할당자의 크기 (바이트) */
+#define FRAME_ARENA_SIZE                    65536
+
+/* GUI 레이아웃 노드의 크기를 나타내는 매크로 */
+#define GUI_LAYOUT_FIT       ((GuiLayoutSize) { GUI_LAYOUT_SIZE_FIT, 0.0f })
+#define GUI_LAYOUT_FIXED(v)  ((GuiLayoutSize) { GUI_LAYOUT_SIZE_FIXED, (v) })
+#define GUI_LAYOUT_WEIGHT(v) ((GuiLayoutSize) { GUI_LAYOUT_SIZE_WEIGHT, (v) })
+
 // clang-format on
 
 /* Typedefs ================================================================ */
@@ -108,9 +198,11 @@ typedef struct VertexData_ {
 
 /* 게임 세계에 존재하는 물체 */
 typedef struct GameObject_ {
-    GameObjectType type;       // 물체 종류
-    Model model;               // 물체 모델
-    VertexData vertexData[8];  // 정점 정조
+    GameObjectType type;                              // 물체 종류
+    Model model;                                      // 물체 모델
+    VertexData vertexData[GAME_OBJECT_VERTEX_COUNT];  // 정점 정조
+    int sceneNode;                                    // 장면 그래프의 노드 번호
+    bool isModelCached;                               // 메시 캐시의 메시 사용 여부
 } GameObject;
 
 /* MVP 영역에 그릴 화면의 종류 */
@@ -123,11 +215,208 @@ typedef enum MvpRenderMode_ {
     MVP_RENDER_COUNT_  // (총 몇 가지?)
 } MvpRenderMode;
 
+/* 각 공간을 그리는 그리기 명령의 종류 */
+typedef enum DrawCommandType_ {
+    DRAW_COMMAND_AXES,              // 세계 공간의 좌표축
+    DRAW_COMMAND_GAME_OBJECT,       // 게임 세계에 존재하는 물체
+    DRAW_COMMAND_INFINITE_GRID,     // 무한히 큰 격자
+    DRAW_COMMAND_PLAYER_VERTICES,   // 플레이어 모델의 정점과 좌표
+    DRAW_COMMAND_CAMERA_HINT_TEXT,  // 관찰자 카메라 도움말
+    DRAW_COMMAND_TINT,              // 렌더 텍스처 전체를 덮는 반투명한 색상
+    DRAW_COMMAND_FPS,               // 현재 FPS
+    DRAW_COMMAND_COUNT_             // (총 몇 가지?)
+} DrawCommandType;
+
+/* 렌더 텍스처에 실제로 그리기 전에 기록해 놓는 그리기 명령 */
+typedef struct DrawCommand_ {
+    unsigned long long sortKey;  // 정렬 키 (단계, 셰이더, 텍스처, 기록 순서)
+    DrawCommandType type;        // 그리기 명령의 종류
+    int objectIndex;             // 물체의 종류 (`GameObjectType`)
+    Color color;                 // 도형의 색상
+} DrawCommand;
+
+/* 한 공간을 그리는 그리기 명령 목록 */
+typedef struct DrawCommandList_ {
+    DrawCommand commands[DRAW_COMMAND_LIST_CAPACITY];  // 그리기 명령 배열
+    int count;                                         // 그리기 명령의 개수
+    MvpRenderMode renderMode;                          // 그릴 공간의 종류
+    Camera camera;                                     // 3D 물체를 그릴 카메라
+    Color clearColor;                                  // 렌더 텍스처의 배경 색상
+    int width, height;                                 // 렌더 텍스처의 크기
+} DrawCommandList;
+
+/* 매 프레임마다 초기화되는 메모리 할당자로 만드는 문자열 */
+typedef struct FrameStringBuilder_ {
+    char *buffer;  // 문자열 버퍼
+    int length;    // 문자열의 길이
+    int capacity;  // 문자열 버퍼의 크기
+} FrameStringBuilder;
+
+/* GUI 레이아웃 노드가 자식 노드를 배치하는 방향 */
+typedef enum GuiLayoutDirection_ {
+    GUI_LAYOUT_COLUMN,  // 위에서 아래로
+    GUI_LAYOUT_ROW      // 왼쪽에서 오른쪽으로
+} GuiLayoutDirection;
+
+/* GUI 레이아웃 노드가 자식 노드를 교차 축 방향으로 정렬하는 방법 */
+typedef enum GuiLayoutAlignment_ {
+    GUI_LAYOUT_ALIGN_STRETCH,  // 부모 노드의 크기에 맞춤
+    GUI_LAYOUT_ALIGN_START,    // 왼쪽 또는 위쪽으로 정렬
+    GUI_LAYOUT_ALIGN_CENTER    // 가운데 정렬
+} GuiLayoutAlignment;
+
+/* GUI 레이아웃 노드의 크기를 정하는 방법 */
+typedef enum GuiLayoutSizeType_ {
+    GUI_LAYOUT_SIZE_FIT,    // 자식 노드들의 크기에 맞춤
+    GUI_LAYOUT_SIZE_FIXED,  // 고정된 크기
+    GUI_LAYOUT_SIZE_WEIGHT  // 남은 공간을 가중치에 비례하여 나눠 가짐
+} GuiLayoutSizeType;
+
+/* GUI 레이아웃 노드의 크기 */
+typedef struct GuiLayoutSize_ {
+    GuiLayoutSizeType type;  // 크기를 정하는 방법
+    float value;             // 고정된 크기 또는 가중치
+} GuiLayoutSize;
+
+/* GUI 레이아웃 노드의 안쪽 여백 */
+typedef struct GuiLayoutPadding_ {
+    float top, right, bottom, left;
+} GuiLayoutPadding;
+
+/* GUI 레이아웃 노드 (행 또는 열) */
+typedef struct GuiLayoutNode_ {
+    GuiLayoutDirection direction;  // 자식 노드를 배치하는 방향
+    GuiLayoutAlignment alignment;  // 자식 노드를 정렬하는 방법
+    GuiLayoutSize width, height;   // 노드의 크기
+    GuiLayoutPadding padding;      // 노드의 안쪽 여백
+    float spacing;                 // 자식 노드 사이의 간격
+    int widgetId;                  // 위젯 번호 (0: 위젯 없음)
+    int parent;                    // 부모 노드의 번호
+    int firstChild, lastChild;     // 첫 번째와 마지막 자식 노드의 번호
+    int nextSibling;               // 다음 형제 노드의 번호
+    Vector2 fitSize;               // 자식 노드들에 맞춘 크기
+    Rectangle bounds;              // 계산된 노드의 영역
+} GuiLayoutNode;
+
+/* GUI 레이아웃 (노드들의 평평한 배열) */
+typedef struct GuiLayout_ {
+    GuiLayoutNode *nodes;  // 노드 배열
+    int count;             // 노드의 개수
+    int capacity;          // 노드 배열의 크기
+} GuiLayout;
+
+/* 애니메이션 타임라인의 채널 종류 */
+typedef enum TimelineChannel_ {
+    TIMELINE_CHANNEL_MODEL_SCALE,     // "모델 행렬"의 크기 변환
+    TIMELINE_CHANNEL_MODEL_TRANS,     // "모델 행렬"의 이동 변환
+    TIMELINE_CHANNEL_MODEL_ROTATE,    // "모델 행렬"의 회전 변환 (도)
+    TIMELINE_CHANNEL_VIEW_EYE,        // "뷰 행렬"의 "EYE" 벡터
+    TIMELINE_CHANNEL_VIEW_AT,         // "뷰 행렬"의 "AT" 벡터
+    TIMELINE_CHANNEL_VIEW_UP,         // "뷰 행렬"의 "UP" 벡터
+    TIMELINE_CHANNEL_PROJ_FOV,        // "투영 행렬"의 "FOV" (X 요소만 사용)
+    TIMELINE_CHANNEL_PROJ_NEAR_FAR,   // "투영 행렬"의 "Near/Far Distance"
+    TIMELINE_CHANNEL_COUNT_           // (총 몇 가지?)
+} TimelineChannel;
+
+/* 키프레임 사이의 보간 방법 */
+typedef enum TimelineInterpolation_ {
+    TIMELINE_INTERP_LINEAR,  // 선형 보간
+    TIMELINE_INTERP_CUBIC,   // 3차 스플라인 보간
+    TIMELINE_INTERP_SLERP    // 구면 선형 보간 (회전 변환 채널에만 적용)
+} TimelineInterpolation;
+
+/* 입력 기록 또는 재생 모드 */
+typedef enum ReplayMode_ {
+    REPLAY_MODE_NONE,    // 기록 및 재생하지 않음
+    REPLAY_MODE_RECORD,  // 입력 기록
+    REPLAY_MODE_PLAY     // 기록된 입력 재생
+} ReplayMode;
+
+/*
+    NOTE: 이미지 블롭은 소스 코드에 그대로 포함되므로, 헤더의 각 필드는 빌드 환경과
+    관계없이 항상 리틀 엔디언 (little-endian) 32비트 정수로 저장됨
+*/
+
+/* 미리 디코딩한 이미지 블롭의 헤더 */
+typedef struct ImageBlobHeader_ {
+    char magic[4];           // 블롭 식별자 (`IMAGE_BLOB_MAGIC`)
+    unsigned int width;      // 이미지의 가로 길이
+    unsigned int height;     // 이미지의 세로 길이
+    unsigned int format;     // 이미지의 픽셀 형식 (`PixelFormat`)
+    unsigned int dataSize;   // 압축을 해제한 픽셀 데이터의 크기
+    unsigned int packedSize; // LZ4로 압축된 픽셀 데이터의 크기
+} ImageBlobHeader;
+
+/* 작업 스레드가 `index`번째 작업으로 실행하는 함수 */
+typedef void (*JobFunc)(void *userData, int index);
+
+/* 문자열 상자를 겹치지 않게 배치하는 레이블 배치 상태 */
+typedef struct LabelLayout_ LabelLayout;
+
+/* 셰이더 변형을 만들 때 `#define` 지시문으로 추가할 상수 */
+typedef struct ShaderDefine_ {
+    const char *name;  // 상수의 이름
+    float value;       // 상수의 값
+} ShaderDefine;
+
+/* 파일에 그대로 저장되는 장면 스냅샷 */
+typedef struct SceneSnapshot_ {
+    float guiValues[TIMELINE_CHANNEL_COUNT_][3];            // GUI 패널의 각 채널 값
+    Camera virtualCamera;                                   // 가상 카메라
+    Camera observerCameras[MVP_RENDER_COUNT_];              // 각 공간의 관찰자 카메라
+    int renderMode;                                         // MVP 영역에 그릴 화면의 종류
+    bool showPlayerVertices;                                // 플레이어 모델의 정점 표시 여부
+    Matrix objectTransforms[OBJ_TYPE_COUNT_];               // 각 물체의 "로컬 행렬"
+    char meshPaths[OBJ_TYPE_COUNT_][SNAPSHOT_PATH_LENGTH];  // 각 물체의 메시 파일 경로
+} SceneSnapshot;
+
+/* 렌더링 스레드가 업데이트 스레드에 전달하는 한 프레임의 입력 */
+typedef struct FrameInput_ {
+    Matrix modelMat;                                    // 플레이어의 "세계 행렬"
+    Matrix viewMat;                                     // 가상 카메라의 "뷰 행렬"
+    Camera cameras[MVP_RENDER_COUNT_];                  // 각 공간을 그리는 카메라
+    Vector2 targetSize;                                 // 각 공간의 렌더 텍스처 크기
+    float nearDistance, farDistance;                    // View Frustum의 범위
+    Vector3 vertexPositions[GAME_OBJECT_VERTEX_COUNT];  // 플레이어 모델의 정점 좌표
+    float fontBaseSize;                                 // 좌표 문자열의 기본 크기
+    bool isVertexVisible;                               // 플레이어 모델의 정점 표시 여부
+    unsigned int frameIndex;                            // 입력을 전달한 프레임의 번호
+} FrameInput;
+
+/* 한 공간에 그릴 플레이어 모델의 정점과 좌표 문자열 */
+typedef struct SpaceVertexSnapshot_ {
+    char texts[GAME_OBJECT_VERTEX_COUNT][LABEL_TEXT_LENGTH];  // 좌표 문자열
+    Vector2 textPositions[GAME_OBJECT_VERTEX_COUNT];          // 좌표 문자열의 위치
+    bool isTextVisible[GAME_OBJECT_VERTEX_COUNT];             // 좌표 문자열의 표시 여부
+    float fontSize;                                           // 좌표 문자열의 크기
+} SpaceVertexSnapshot;
+
+/* 업데이트 스레드가 렌더링 스레드에 전달하는 한 프레임의 스냅샷 */
+typedef struct FrameSnapshot_ {
+    SpaceVertexSnapshot spaces[MVP_RENDER_COUNT_];  // 각 공간의 정점 정보
+    bool isVertexVisible;                           // 플레이어 모델의 정점 표시 여부
+    unsigned int frameIndex;                        // 스냅샷을 만든 입력의 프레임 번호
+} FrameSnapshot;
+
 /* "<물체 / 세계 / 카메라 / 클립> 공간"을 초기화하는 함수 */
 typedef void (*InitSpaceFunc)(void);
 
-/* 프레임버퍼에 "<물체 / 세계 / 카메라 / 클립> 공간"을 그리는 함수 */
-typedef void (*UpdateSpaceFunc)(RenderTexture);
+/* "<물체 / 세계 / 카메라> 공간"의 마우스 및 키보드 입력을 처리하는 함수 */
+typedef void (*InputSpaceFunc)(void);
+
+/* "<물체 / 세계 / 카메라 / 클립> 공간"을 그리는 명령들을 기록하는 함수 */
+typedef void (*RecordSpaceFunc)(DrawCommandList *);
+
+/* 렌더 그래프에 추가할 렌더 패스 */
+typedef struct RenderGraphPassDesc_ {
+    const char *name;                              // 렌더 패스의 이름
+    RecordSpaceFunc recordFunc;                    // 그리기 명령들을 기록하는 함수
+    MvpRenderMode renderMode;                      // 그릴 공간의 종류
+    int target;                                    // 그리는 렌더 타깃의 번호
+    int inputs[RENDER_GRAPH_PASS_INPUT_CAPACITY];  // 입력으로 읽는 렌더 타깃의 번호
+    int inputCount;                                // 입력으로 읽는 렌더 타깃의 개수
+    bool isPresented;                              // MVP 영역에 합성할지 여부
+} RenderGraphPassDesc;
 
 /* "<물체 / 세계 / 카메라 / 클립> 공간"에 필요한 메모리 공간을 해제하는 함수 */
 typedef void (*DeinitSpaceFunc)(void);
@@ -171,6 +460,12 @@ float GetViewFrustumFarDistance(void);
 /* 플레이어 모델의 정점 위치 및 좌표 표시 여부를 반환하는 함수 */
 bool IsVertexVisibilityModeEnabled(void);
 
+/* `fileName` 파일의 장면 스냅샷으로 게임 상태를 되돌리는 함수 */
+bool LoadGameSnapshot(const char *fileName);
+
+/* `fileName` 파일에 현재 게임 상태를 장면 스냅샷으로 저장하는 함수 */
+bool SaveGameSnapshot(const char *fileName);
+
 /* "모델 행렬"을 업데이트하는 함수 */
 void UpdateModelMatrix(bool fromGUI);
 
@@ -180,29 +475,188 @@ void UpdateViewMatrix(bool fromGUI);
 /* "투영 행렬"을 업데이트하는 함수 */
 void UpdateProjMatrix(bool fromGUI);
 
+/* ====================================================== (from src/arena.c) */
+
+/* 프레임 단위 메모리 할당자를 초기화하는 함수 */
+void ResetFrameArena(void);
+
+/* 프레임 단위 메모리 할당자로 `size` 바이트를 할당하는 함수 */
+void *AllocFrameMemory(size_t size);
+
+/* 프레임 단위 메모리 할당자로 정점 `count`개를 저장할 배열을 할당하는 함수 */
+Vector3 *AllocFrameVertices(int count);
+
+/* 프레임 단위 메모리 할당자로 형식 문자열을 만드는 함수 */
+const char *FrameTextFormat(const char *text, ...);
+
+/* 프레임 단위 메모리 할당자로 최대 `capacity` 바이트의 문자열을 만들기 시작하는 함수 */
+FrameStringBuilder BeginFrameString(int capacity);
+
+/* 만들고 있는 문자열의 끝에 형식 문자열을 덧붙이는 함수 */
+void AppendFrameString(FrameStringBuilder *builder, const char *text, ...);
+
+/* 만들고 있는 문자열의 끝에 형식 문자열을 덧붙이는 함수 (`va_list` 버전) */
+void AppendFrameStringV(FrameStringBuilder *builder,
+                        const char *text,
+                        va_list args);
+
+/* 만들고 있던 문자열을 반환하는 함수 */
+const char *EndFrameString(FrameStringBuilder *builder);
+
+/* 프레임 단위 메모리 할당자의 최대 사용량을 반환하는 함수 */
+size_t GetFrameArenaHighWaterMark(void);
+
+/* ======================================================= (from src/blob.c) */
+
+/* LZ4 블록 형식으로 압축된 데이터의 압축을 해제하고, 해제된 크기를 반환하는 함수 */
+int DecompressBlobData(const unsigned char *packedData,
+                       int packedSize,
+                       unsigned char *data,
+                       int dataSize);
+
+/* 미리 디코딩한 이미지 블롭으로 이미지를 만드는 함수 */
+Image LoadImageFromBlob(const unsigned char *blob, int blobSize);
+
 /* ======================================================= (from src/clip.c) */
 
 /* "클립 공간"을 초기화하는 함수 */
 void InitClipSpace(void);
 
-/* 프레임버퍼에 "클립 공간"을 그리는 함수 */
-void UpdateClipSpace(RenderTexture renderTexture);
+/* "클립 공간"을 그리는 명령들을 기록하는 함수 */
+void RecordClipSpace(DrawCommandList *commandList);
 
 /* "클립 공간"에 필요한 메모리 공간을 해제하는 함수 */
 void DeinitClipSpace(void);
 
 /* ========================================================================= */
 
+/* 가상 카메라로 만들어지는 "투영 행렬"을 다시 계산하는 함수 */
+void UpdateVirtualCameraProjMat(float aspect);
+
 /* 가상 카메라로 만들어지는 "투영 행렬"을 반환하는 함수 */
 Matrix GetVirtualCameraProjMat(bool fromGUI);
 
+/* ==================================================== (from src/command.c) */
+
+/* `width` x `height` 크기의 공간을 그릴 명령 목록을 초기화하는 함수 */
+void ResetDrawCommandList(DrawCommandList *commandList,
+                          MvpRenderMode renderMode,
+                          int width,
+                          int height);
+
+/* 명령 목록에 그리기 명령을 기록하는 함수 */
+void AddDrawCommand(DrawCommandList *commandList, DrawCommand command);
+
+/* 기록된 그리기 명령들을 정렬한 다음, 렌더 텍스처에 그리는 함수 */
+void SubmitDrawCommandList(DrawCommandList *commandList,
+                           RenderTexture renderTexture);
+
+/* ====================================================== (from src/glyph.c) */
+
+/* `fileName` 글꼴 파일로 글리프 캐시를 초기화하는 함수 */
+bool InitGlyphCache(const char *fileName, int fontSize);
+
+/* 글리프 캐시에 필요한 메모리 공간을 해제하는 함수 */
+void UnloadGlyphCache(void);
+
+/* 프레임이 끝날 때, 이번 프레임에 바뀐 아틀라스 페이지를 한 번에 업로드하는 함수 */
+void UpdateGlyphCache(void);
+
+/* `text`를 그리는 데 필요한 글리프를 글리프 캐시에 미리 추가하는 함수 */
+void CacheGlyphText(Font font, const char *text);
+
+/* `font`에 없는 글리프는 글리프 캐시에서 가져와서 `text`를 그리는 함수 */
+void DrawGlyphText(Font font,
+                   const char *text,
+                   Vector2 position,
+                   float fontSize,
+                   float spacing,
+                   Color tint);
+
+/* `font`에 없는 글리프는 글리프 캐시에서 가져와서 `text`의 크기를 계산하는 함수 */
+Vector2 MeasureGlyphText(Font font,
+                         const char *text,
+                         float fontSize,
+                         float spacing);
+
+/* ====================================================== (from src/graph.c) */
+
+/* 렌더 그래프에 렌더 타깃을 추가하고, 그 번호를 반환하는 함수 */
+int AddRenderGraphTarget(const char *name);
+
+/* 렌더 그래프에 렌더 패스를 추가하고, 그 번호를 반환하는 함수 */
+int AddRenderGraphPass(RenderGraphPassDesc desc);
+
+/* 렌더 그래프를 실행하여 MVP 영역 `area`에 화면의 종류 `renderMode`를 그리는 함수 */
+void ExecuteRenderGraph(MvpRenderMode renderMode, Rectangle area);
+
+/* 렌더 타깃 `target`에 연결된 렌더 텍스처를 반환하는 함수 */
+RenderTexture GetRenderGraphTexture(int target);
+
+/* 렌더 그래프의 모든 렌더 패스와 렌더 타깃을 제거하는 함수 */
+void ResetRenderGraph(void);
+
+/* ======================================================== (from src/job.c) */
+
+/* 작업 스레드들을 초기화하는 함수 */
+void InitJobSystem(void);
+
+/* `func`를 `count`번 병렬로 실행하고, 모두 끝날 때까지 기다리는 함수 */
+void ParallelFor(int count, JobFunc func, void *userData);
+
+/* 작업 스레드들을 종료하는 함수 */
+void DeinitJobSystem(void);
+
+/* ====================================================== (from src/label.c) */
+
+/* 문자열 상자를 최대 `capacity`개까지 배치할 수 있는 레이블 배치 상태를 만드는 함수 */
+LabelLayout *LoadLabelLayout(int capacity);
+
+/* 레이블 배치 상태에 할당된 메모리 공간을 해제하는 함수 */
+void UnloadLabelLayout(LabelLayout *layout);
+
+/* `width` x `height` 크기의 화면에 문자열 상자를 배치하기 시작하는 함수 */
+void BeginLabelLayout(LabelLayout *layout, int width, int height);
+
+/* 배치할 문자열 상자를 추가하고, 그 번호를 반환하는 함수 */
+int AddLabelCandidate(LabelLayout *layout,
+                      Vector2 anchor,
+                      Vector2 size,
+                      float offset,
+                      float depth);
+
+/* 카메라와 가까운 문자열 상자부터 겹치지 않는 위치에 배치하는 함수 */
+void EndLabelLayout(LabelLayout *layout);
+
+/* `index`번째 문자열 상자가 배치된 위치를 반환하는 함수 */
+bool GetLabelPosition(const LabelLayout *layout,
+                      int index,
+                      Vector2 *position);
+
+/* ===================================================== (from src/layout.c) */
+
+/* 노드 배열 `nodes`를 이용해 GUI 레이아웃을 초기화하는 함수 */
+void InitGuiLayout(GuiLayout *layout, GuiLayoutNode *nodes, int capacity);
+
+/* GUI 레이아웃의 `parent`번째 노드에 자식 노드를 추가하고, 그 번호를 반환하는 함수 */
+int AddGuiLayoutNode(GuiLayout *layout, int parent, GuiLayoutNode node);
+
+/* GUI 레이아웃의 모든 노드를 `bounds` 안에 배치하고, 위젯 영역을 계산하는 함수 */
+void SolveGuiLayout(GuiLayout *layout,
+                    Rectangle bounds,
+                    Rectangle *widgetAreas,
+                    int widgetCount);
+
 /* ====================================================== (from src/local.c) */
 
 /* "물체 공간"을 초기화하는 함수 */
 void InitLocalSpace(void);
 
-/* 프레임버퍼에 "물체 공간"을 그리는 함수 */
-void UpdateLocalSpace(RenderTexture renderTexture);
+/* "물체 공간"의 마우스 및 키보드 입력을 처리하는 함수 */
+void HandleLocalSpaceInput(void);
+
+/* "물체 공간"을 그리는 명령들을 기록하는 함수 */
+void RecordLocalSpace(DrawCommandList *commandList);
 
 /* "물체 공간"에 필요한 메모리 공간을 해제하는 함수 */
 void DeinitLocalSpace(void);
@@ -212,8 +666,214 @@ void DeinitLocalSpace(void);
 /* "물체 공간"의 관찰자 시점 카메라를 반환하는 함수 */
 Camera *GetLocalObserverCamera(void);
 
+/* ======================================================= (from src/mesh.c) */
+
+/* `fileName` 파일의 메시를 메시 캐시에서 찾거나 불러와서 모델을 만드는 함수 */
+Model LoadCachedModel(const char *fileName);
+
+/* `LoadCachedModel()`로 만든 모델의 메시 파일 경로를 반환하는 함수 */
+const char *GetCachedModelFileName(Model model);
+
+/* `LoadCachedModel()`로 만든 모델을 해제하는 함수 */
+void UnloadCachedModel(Model model);
+
+/* 메시 캐시에 저장된 모든 메시를 해제하는 함수 */
+void UnloadMeshCache(void);
+
+/* ===================================================== (from src/replay.c) */
+
+/* `fileName` 파일에 입력 기록을 시작하는 함수 */
+bool BeginReplayRecording(const char *fileName);
+
+/* `fileName` 파일의 입력 기록을 재생하기 시작하는 함수 */
+bool BeginReplayPlayback(const char *fileName);
+
+/* 입력 기록 또는 재생을 끝내는 함수 */
+void EndReplay(void);
+
+/* 입력 기록 또는 재생 모드를 반환하는 함수 */
+ReplayMode GetReplayMode(void);
+
+/* 입력 재생이 끝났는지 확인하는 함수 */
+bool IsReplayFinished(void);
+
+/* 새로운 프레임을 시작할 때, 입력을 기록하거나 기록된 입력을 재생하는 함수 */
+void UpdateReplay(void);
+
+/* 현재 프레임의 길이를 반환하는 함수 (재생 모드에서는 기록된 프레임의 길이) */
+float GetReplayFrameTime(void);
+
+/* 현재 프레임에서 바뀐 GUI 패널의 값을 기록하는 함수 */
+void RecordReplayValue(TimelineChannel channel, int component, float value);
+
+/* 현재 프레임까지 기록된 GUI 패널의 값 변경 이벤트를 하나씩 반환하는 함수 */
+bool PollReplayValue(TimelineChannel *channel, int *component, float *value);
+
+/* ====================================================== (from src/scene.c) */
+
+/* 장면 그래프에 `parent`번째 노드의 자식 노드를 추가하고, 그 번호를 반환하는 함수 */
+int CreateSceneNode(int parent);
+
+/* 장면 그래프의 모든 노드를 제거하는 함수 */
+void ResetSceneGraph(void);
+
+/* `index`번째 노드의 TRS 값을 설정하는 함수 */
+void SetSceneNodeTRS(int index,
+                     Vector3 translation,
+                     Quaternion rotation,
+                     Vector3 scale);
+
+/* `index`번째 노드의 "로컬 행렬"을 직접 설정하는 함수 */
+void SetSceneNodeLocalMat(int index, Matrix localMat);
+
+/* `index`번째 노드의 "세계 행렬"을 반환하는 함수 */
+Matrix GetSceneNodeWorldMat(int index);
+
+/* 바뀐 노드와 그 자식 노드들의 "세계 행렬"을 다시 계산하는 함수 */
+void UpdateSceneGraph(void);
+
+/* ======================================================== (from src/sdf.c) */
+
+/* `font`의 글리프들로 SDF 글꼴 아틀라스를 만드는 함수 */
+bool InitSdfFont(Font font, Image fontImage);
+
+/* SDF 글꼴에 필요한 메모리 공간을 해제하는 함수 */
+void UnloadSdfFont(void);
+
+/* SDF 글꼴로 문자열을 그리기 시작하는 함수 */
+void BeginSdfText(void);
+
+/* SDF 글꼴로 문자열을 그리는 것을 끝내는 함수 */
+void EndSdfText(void);
+
+/* SDF 글꼴로 `text`를 그리는 함수 */
+void DrawSdfText(const char *text,
+                 Vector2 position,
+                 float fontSize,
+                 float spacing,
+                 Color tint);
+
+/* SDF 글꼴로 그릴 `text`의 크기를 계산하는 함수 */
+Vector2 MeasureSdfText(const char *text, float fontSize, float spacing);
+
+/* ===================================================== (from src/shader.c) */
+
+/* 셰이더 프로그램 바이너리 캐시를 사용하여 셰이더 프로그램을 만드는 함수 */
+Shader LoadCachedShader(const char *vsCode, const char *fsCode);
+
+/* 상수 정의를 추가한 셰이더 변형을 만들거나, 이미 만든 셰이더 변형을 반환하는 함수 */
+Shader LoadShaderVariant(const char *vsCode,
+                         const char *fsCode,
+                         const ShaderDefine *defines,
+                         int defineCount);
+
+/* 셰이더 변형을 더 이상 사용하지 않는다면, 셰이더 변형을 해제하는 함수 */
+void UnloadShaderVariant(Shader shader);
+
+/* 상수로 추가하지 않은 셰이더 변형의 Uniform 값을 바꾸는 함수 */
+void SetShaderVariantValue(Shader shader, const char *name, float value);
+
+/* =================================================== (from src/snapshot.c) */
+
+/* `fileName` 파일에서 장면 스냅샷을 읽는 함수 */
+bool ReadSceneSnapshot(const char *fileName, SceneSnapshot *snapshot);
+
+/* `fileName` 파일에 장면 스냅샷을 저장하는 함수 */
+bool WriteSceneSnapshot(const char *fileName, const SceneSnapshot *snapshot);
+
+/* ===================================================== (from src/target.c) */
+
+/* 렌더 텍스처 풀에서 `width` x `height` 크기의 렌더 텍스처를 가져오는 함수 */
+RenderTexture AcquireRenderTexture(int width, int height);
+
+/* 렌더 텍스처 풀에서 색상 버퍼의 픽셀 형식이 `format`인 렌더 텍스처를 가져오는 함수 */
+RenderTexture AcquireRenderTextureEx(int width, int height, int format);
+
+/* 렌더 텍스처를 렌더 텍스처 풀에 반환하는 함수 */
+void ReleaseRenderTexture(RenderTexture renderTexture);
+
+/* 렌더 텍스처에 실제로 할당된 (크기 단위로 올림된) 텍스처를 반환하는 함수 */
+Texture GetRenderTextureStorage(RenderTexture renderTexture);
+
+/* 오랫동안 사용되지 않은 렌더 텍스처를 해제하는 함수 */
+void TrimRenderTexturePool(void);
+
+/* 렌더 텍스처 풀에 할당된 메모리 공간을 해제하는 함수 */
+void UnloadRenderTexturePool(void);
+
+/* 렌더 텍스처 풀이 사용하고 있는 GPU 메모리의 크기 (바이트)를 계산하는 함수 */
+size_t GetRenderTextureMemoryUsage(void);
+
+/* =================================================== (from src/timeline.c) */
+
+/* `channel` 채널의 `time`초에 키프레임을 추가하고, 그 번호를 반환하는 함수 */
+int AddTimelineKeyframe(TimelineChannel channel,
+                        float time,
+                        Vector3 value,
+                        TimelineInterpolation interpolation);
+
+/* 타임라인의 모든 키프레임을 제거하는 함수 */
+void ClearTimeline(void);
+
+/* 타임라인의 현재 시간을 반환하는 함수 */
+float GetTimelineTime(void);
+
+/* 타임라인의 현재 시간을 설정하는 함수 */
+void SetTimelineTime(float time);
+
+/* 타임라인의 길이를 반환하는 함수 */
+float GetTimelineDuration(void);
+
+/* 타임라인의 모든 채널에 있는 키프레임의 개수를 반환하는 함수 */
+int GetTimelineKeyframeCount(void);
+
+/* 현재 시간에서 `channel` 채널의 값을 반환하는 함수 */
+bool GetTimelineSample(TimelineChannel channel, Vector3 *value);
+
+/* 타임라인의 재생 여부를 반환하는 함수 */
+bool IsTimelinePlaying(void);
+
+/* 타임라인의 재생 여부를 설정하는 함수 */
+void SetTimelinePlaying(bool playing);
+
+/* 타임라인을 업데이트하고, 새로운 샘플을 반영해야 하는지 확인하는 함수 */
+bool UpdateTimeline(float deltaTime);
+
+/* ===================================================== (from src/update.c) */
+
+/* 업데이트 스레드를 초기화하는 함수 */
+bool InitUpdateThread(void);
+
+/* 업데이트 스레드에 전달할 입력을 작성하기 시작하는 함수 */
+FrameInput *BeginFrameInput(void);
+
+/* 작성한 입력을 업데이트 스레드에 전달하는 함수 */
+void EndFrameInput(void);
+
+/* 업데이트 스레드가 만든 가장 최근의 스냅샷을 가져오는 함수 */
+const FrameSnapshot *AcquireFrameSnapshot(void);
+
+/* 현재 프레임의 입력으로 만든 스냅샷을 반환하는 함수 */
+const FrameSnapshot *GetFrameSnapshot(void);
+
+/* 업데이트 스레드를 종료하고, 할당된 메모리 공간을 해제하는 함수 */
+void DeinitUpdateThread(void);
+
 /* ====================================================== (from src/utils.c) */
 
+/* 크기, 회전 (사원수)과 이동 변환을 한 번에 합성한 "모델 행렬"을 반환하는 함수 */
+Matrix ComposeTRSMat(Vector3 translation, Quaternion rotation, Vector3 scale);
+
+/* 크기, 회전 (오일러 각, 라디안)과 이동 변환을 한 번에 합성한 "모델 행렬"을 반환하는 함수 */
+Matrix ComposeEulerTRSMat(Vector3 translation, Vector3 angle, Vector3 scale);
+
+/* 물체 `count`개의 크기, 회전과 이동 변환을 합성한 "모델 행렬"들을 계산하는 함수 */
+void ComposeTRSMats(Matrix *result,
+                    const Vector3 *translations,
+                    const Quaternion *rotations,
+                    const Vector3 *scales,
+                    int count);
+
 /* 화살표를 그리는 함수 */
 void DrawArrow(Vector3 startPos, Vector3 endPos, Color color);
 
@@ -241,11 +901,14 @@ void DrawGameObject(GameObject *gameObject,
 void DrawInfiniteGrid(const Camera *camera);
 
 /* 플레이어 모델의 정점 좌표를 표시하는 함수 */
-void DrawPlayerVertices(RenderTexture renderTexture, MvpRenderMode renderMode);
+void DrawPlayerVertices(MvpRenderMode renderMode);
 
 /* 가상 카메라의 View Frustum을 그리는 함수 */
 void DrawViewFrustum(MvpRenderMode renderMode, Color color);
 
+/* 실수 `value`를 소수점 아래 `precision`자리까지 `buffer`에 기록하는 함수 */
+int FormatFixedFloat(char *buffer, int bufferSize, float value, int precision);
+
 /* 마우스 커서 종류를 반환하는 함수 */
 MouseCursor GetMouseCursor(void);
 
@@ -255,16 +918,25 @@ bool IsObserverCameraLocked(void);
 /* 공용 셰이더 프로그램을 반환하는 함수 */
 Shader LoadCommonShader(void);
 
+/* SDF 글꼴로 문자열을 그리는 셰이더 프로그램을 반환하는 함수 */
+Shader LoadSdfTextShader(void);
+
 /* 관찰자 시점 카메라의 잠금 여부를 변경하는 함수 */
 void ToggleObserverCameraLock(void);
 
+/* 기록된 프레임 시간으로 관찰자 시점 카메라를 업데이트하는 함수 */
+void UpdateObserverCamera(Camera *camera);
+
 /* ======================================================= (from src/view.c) */
 
 /* "카메라 (뷰) 공간"을 초기화하는 함수 */
 void InitViewSpace(void);
 
-/* 프레임버퍼에 "카메라 (뷰) 공간"을 그리는 함수 */
-void UpdateViewSpace(RenderTexture renderTexture);
+/* "카메라 (뷰) 공간"의 마우스 및 키보드 입력을 처리하는 함수 */
+void HandleViewSpaceInput(void);
+
+/* "카메라 (뷰) 공간"을 그리는 명령들을 기록하는 함수 */
+void RecordViewSpace(DrawCommandList *commandList);
 
 /* "카메라 (뷰) 공간"에 필요한 메모리 공간을 해제하는 함수 */
 void DeinitViewSpace(void);
@@ -279,8 +951,11 @@ Camera *GetViewObserverCamera(void);
 /* "세계 공간"을 초기화하는 함수 */
 void InitWorldSpace(void);
 
-/* 프레임버퍼에 "세계 공간"을 그리는 함수 */
-void UpdateWorldSpace(RenderTexture renderTexture);
+/* "세계 공간"의 마우스 및 키보드 입력을 처리하는 함수 */
+void HandleWorldSpaceInput(void);
+
+/* "세계 공간"을 그리는 명령들을 기록하는 함수 */
+void RecordWorldSpace(DrawCommandList *commandList);
 
 /* "세계 공간"에 필요한 메모리 공간을 해제하는 함수 */
 void DeinitWorldSpace(void);
@@ -1,314 +1,344 @@
 /*
-    Generated from `xxd -i`, CC0 License
-    
-    (https://pixelfrog-assets.itch.io/pixel-adventure-1)
+    Generated by `mvp-pack` from `res/images/atlas-192x96.png`
+    (192x96, pixel format 7, 73728 -> 3972 bytes, LZ4)
+
+    CC0 License (https://pixelfrog-assets.itch.io/pixel-adventure-1)
 */
 
-unsigned char atlas192x96Png[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x60,
-  0x08, 0x06, 0x00, 0x00, 0x00, 0x4b, 0xc0, 0x7d, 0xe9, 0x00, 0x00, 0x01,
-  0x84, 0x69, 0x43, 0x43, 0x50, 0x49, 0x43, 0x43, 0x20, 0x70, 0x72, 0x6f,
-  0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x28, 0x91, 0x7d, 0x91, 0x3d, 0x48,
-  0xc3, 0x50, 0x14, 0x85, 0x4f, 0x53, 0x4b, 0x45, 0x2a, 0x0e, 0xcd, 0x20,
-  0xe2, 0x10, 0xb0, 0x3a, 0xd9, 0x45, 0x45, 0x1c, 0x4b, 0x15, 0x8b, 0x60,
-  0xa1, 0xb4, 0x15, 0x5a, 0x75, 0x30, 0x79, 0xe9, 0x1f, 0x34, 0x69, 0x49,
-  0x52, 0x5c, 0x1c, 0x05, 0xd7, 0x82, 0x83, 0x3f, 0x8b, 0x55, 0x07, 0x17,
-  0x67, 0x5d, 0x1d, 0x5c, 0x05, 0x41, 0xf0, 0x07, 0xc4, 0x5d, 0x70, 0x52,
-  0x74, 0x91, 0x12, 0xef, 0x4b, 0x0a, 0x2d, 0x62, 0xbc, 0xf0, 0x78, 0x1f,
-  0xe7, 0xdd, 0x73, 0x78, 0xef, 0x3e, 0x40, 0x68, 0x55, 0x99, 0x66, 0xf6,
-  0xc5, 0x00, 0x4d, 0xb7, 0x8c, 0x74, 0x22, 0x2e, 0xe5, 0xf2, 0xab, 0x52,
-  0xf0, 0x15, 0x01, 0x84, 0xe1, 0xc3, 0x18, 0x44, 0x99, 0x99, 0xf5, 0x64,
-  0x66, 0x31, 0x0b, 0xcf, 0xfa, 0xba, 0xa7, 0x4e, 0xaa, 0xbb, 0x28, 0xcf,
-  0xf2, 0xee, 0xfb, 0xb3, 0x06, 0xd5, 0x82, 0xc9, 0x00, 0x9f, 0x44, 0x1c,
-  0x63, 0x75, 0xc3, 0x22, 0xde, 0x20, 0x9e, 0xdd, 0xb4, 0xea, 0x9c, 0xf7,
-  0x89, 0x45, 0x56, 0x96, 0x55, 0xe2, 0x73, 0xe2, 0x49, 0x83, 0x2e, 0x48,
-  0xfc, 0xc8, 0x75, 0xc5, 0xe5, 0x37, 0xce, 0x25, 0x87, 0x05, 0x9e, 0x29,
-  0x1a, 0xd9, 0xf4, 0x3c, 0xb1, 0x48, 0x2c, 0x95, 0x7a, 0x58, 0xe9, 0x61,
-  0x56, 0x36, 0x34, 0xe2, 0x19, 0xe2, 0x88, 0xaa, 0xe9, 0x94, 0x2f, 0xe4,
-  0x5c, 0x56, 0x39, 0x6f, 0x71, 0xd6, 0xaa, 0x0d, 0xd6, 0xb9, 0x27, 0x7f,
-  0x61, 0xa8, 0xa0, 0xaf, 0x64, 0xb8, 0x4e, 0x6b, 0x14, 0x09, 0x2c, 0x21,
-  0x89, 0x14, 0x24, 0x28, 0x68, 0xa0, 0x82, 0x2a, 0x2c, 0x44, 0x69, 0xd7,
-  0x49, 0x31, 0x91, 0xa6, 0xf3, 0xb8, 0x87, 0x7f, 0xc4, 0xf1, 0xa7, 0xc8,
-  0xa5, 0x90, 0xab, 0x02, 0x46, 0x8e, 0x05, 0xd4, 0xa0, 0x41, 0x76, 0xfc,
-  0xe0, 0x7f, 0xf0, 0x7b, 0xb6, 0x66, 0x71, 0x7a, 0xca, 0x4d, 0x0a, 0xc5,
-  0x81, 0xc0, 0x8b, 0x6d, 0x7f, 0x8c, 0x03, 0xc1, 0x5d, 0xa0, 0xdd, 0xb4,
-  0xed, 0xef, 0x63, 0xdb, 0x6e, 0x9f, 0x00, 0xfe, 0x67, 0xe0, 0x4a, 0xef,
-  0xfa, 0x6b, 0x2d, 0x60, 0xee, 0x93, 0xf4, 0x66, 0x57, 0x8b, 0x1c, 0x01,
-  0x43, 0xdb, 0xc0, 0xc5, 0x75, 0x57, 0x53, 0xf6, 0x80, 0xcb, 0x1d, 0x60,
-  0xf8, 0xa9, 0x2e, 0x1b, 0xb2, 0x23, 0xf9, 0x69, 0x09, 0xc5, 0x22, 0xf0,
-  0x7e, 0x46, 0xdf, 0x94, 0x07, 0xc2, 0xb7, 0xc0, 0xc0, 0x9a, 0x3b, 0xb7,
-  0xce, 0x39, 0x4e, 0x1f, 0x80, 0x2c, 0xcd, 0x6a, 0xf9, 0x06, 0x38, 0x38,
-  0x04, 0x26, 0x4a, 0x94, 0xbd, 0xee, 0xf1, 0xee, 0xfe, 0xde, 0xb9, 0xfd,
-  0xdb, 0xd3, 0x99, 0xdf, 0x0f, 0x88, 0x37, 0x72, 0xaf, 0x35, 0x8a, 0x5a,
-  0x3d, 0x00, 0x00, 0x0c, 0x72, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed,
-  0x5c, 0x7f, 0x6c, 0x56, 0x57, 0x19, 0x7e, 0x5a, 0xba, 0x99, 0x8d, 0xb2,
-  0xc8, 0x56, 0x0a, 0x83, 0x02, 0x69, 0x19, 0x94, 0x6f, 0x7c, 0xa5, 0xfc,
-  0x90, 0xd1, 0x38, 0x61, 0xe9, 0x30, 0x38, 0xb7, 0x3f, 0xc6, 0x46, 0x04,
-  0xb6, 0x00, 0x0d, 0x51, 0x03, 0x51, 0xd7, 0x91, 0x40, 0xf8, 0x07, 0x93,
-  0x05, 0xe3, 0x8c, 0x69, 0x6c, 0x02, 0x85, 0xe8, 0xe6, 0x34, 0x33, 0x60,
-  0x1a, 0x58, 0x87, 0x0c, 0xa3, 0xb8, 0x28, 0x85, 0x49, 0x75, 0x42, 0x90,
-  0x09, 0x6d, 0xa1, 0x14, 0x5c, 0x09, 0xbf, 0xdb, 0x52, 0x87, 0x59, 0x3b,
-  0x70, 0x50, 0x5a, 0xff, 0xf8, 0x7a, 0x2e, 0xb7, 0xe7, 0xbb, 0xe7, 0x9e,
-  0x9f, 0xf7, 0xbb, 0xdb, 0xfa, 0x3e, 0x09, 0xe1, 0xdc, 0x7b, 0xee, 0x7b,
-  0xce, 0x77, 0x9b, 0xe7, 0x9c, 0x7b, 0x9e, 0xf7, 0xbc, 0xef, 0xc9, 0x2a,
-  0x9c, 0x58, 0xd2, 0x8f, 0x58, 0x91, 0x15, 0x73, 0xf7, 0xbd, 0xf1, 0xf6,
-  0xdf, 0x7f, 0x0f, 0x86, 0xf6, 0xdf, 0xff, 0x66, 0xac, 0xdd, 0xe7, 0x00,
-  0xc0, 0x5f, 0xea, 0xbe, 0x81, 0x31, 0x45, 0x73, 0xd4, 0x8d, 0x72, 0x9f,
-  0x05, 0x00, 0xf4, 0xf6, 0xec, 0xf5, 0xae, 0x59, 0x59, 0xa7, 0x8d, 0x44,
-  0x71, 0xaa, 0xcf, 0xfa, 0xba, 0x59, 0x18, 0x5d, 0x34, 0x5f, 0xd9, 0x76,
-  0x58, 0xee, 0x8b, 0x00, 0x80, 0x3b, 0x3d, 0xb5, 0xde, 0x35, 0x2b, 0xeb,
-  0xb4, 0x91, 0x28, 0x7e, 0x0c, 0x00, 0xb0, 0xef, 0xad, 0x35, 0x18, 0x5b,
-  0x98, 0x54, 0xb6, 0xfd, 0xd2, 0x88, 0xaf, 0x02, 0x00, 0x3e, 0xed, 0x7e,
-  0xdf, 0xbb, 0x66, 0x65, 0x9d, 0x36, 0x12, 0x53, 0x67, 0x01, 0x00, 0x0e,
-  0xd4, 0x4d, 0xc6, 0xe8, 0xa2, 0x05, 0xca, 0xb6, 0xd9, 0xb9, 0xab, 0x00,
-  0x00, 0x7d, 0x3d, 0x6f, 0x7a, 0xd7, 0xac, 0xac, 0xd3, 0x46, 0xa2, 0x78,
-  0x2e, 0x00, 0xe0, 0xbd, 0xba, 0x61, 0xc8, 0x2f, 0x5a, 0xaa, 0xce, 0xd9,
-  0xdc, 0xca, 0xd4, 0xd8, 0xed, 0xa9, 0xf1, 0xae, 0x59, 0x59, 0xa7, 0x8d,
-  0x44, 0x71, 0x19, 0x00, 0xe0, 0xf7, 0x6f, 0xfd, 0x08, 0x05, 0x85, 0x53,
-  0x94, 0x6d, 0xef, 0x1b, 0x91, 0x00, 0x00, 0xdc, 0xec, 0x6e, 0xf1, 0xae,
-  0x59, 0x59, 0xa7, 0x8d, 0xc4, 0xd4, 0xd2, 0xd4, 0x00, 0xb8, 0xfa, 0xf7,
-  0x73, 0xca, 0x86, 0x63, 0x8a, 0xe6, 0xa0, 0xb7, 0x67, 0x2f, 0xda, 0xdb,
-  0x8e, 0x7a, 0xd7, 0x97, 0x1a, 0x7f, 0xa8, 0x3d, 0xf2, 0xc6, 0x14, 0xdd,
-  0x2d, 0x77, 0x34, 0x5c, 0x00, 0x70, 0x48, 0xc9, 0x6e, 0x74, 0xd1, 0x7c,
-  0xdc, 0xe9, 0xa9, 0x45, 0x47, 0xdb, 0x21, 0xef, 0xfa, 0x4a, 0xe3, 0x1a,
-  0xed, 0xfe, 0x47, 0xfb, 0xfa, 0xbf, 0x70, 0xf8, 0x8c, 0xb2, 0xdd, 0xd8,
-  0xc2, 0x24, 0x3e, 0xed, 0x7e, 0x1f, 0x57, 0xce, 0x35, 0x7b, 0xd7, 0xe7,
-  0x1a, 0x7f, 0xa9, 0xdd, 0xff, 0xd8, 0xc2, 0xbb, 0xe5, 0x6b, 0x0d, 0x97,
-  0x00, 0xd4, 0x2b, 0xfe, 0xee, 0x05, 0xe8, 0xeb, 0x79, 0x13, 0x1d, 0x6d,
-  0xf5, 0xde, 0xf5, 0xd5, 0xc6, 0xe5, 0x56, 0xef, 0xff, 0x9f, 0xbf, 0x5e,
-  0x04, 0xb0, 0x4b, 0xc9, 0x2e, 0xbf, 0x68, 0x29, 0xfa, 0x7b, 0x6a, 0xd0,
-  0xd9, 0xb6, 0xcb, 0xbb, 0xee, 0x68, 0x7c, 0x5c, 0xbb, 0xff, 0x7c, 0x5f,
-  0xff, 0x67, 0x8f, 0x9e, 0x52, 0xb6, 0x2b, 0x28, 0x9c, 0x82, 0x9b, 0xdd,
-  0x2d, 0xb8, 0x74, 0xee, 0x8c, 0x77, 0x7d, 0xb6, 0x71, 0xaf, 0x76, 0xff,
-  0x05, 0x03, 0x7f, 0xff, 0x6c, 0xff, 0xcd, 0xe3, 0x3f, 0x3f, 0x12, 0x3a,
-  0x18, 0xd8, 0x57, 0xc2, 0x4f, 0x7e, 0x56, 0x56, 0x81, 0xac, 0xfd, 0xe6,
-  0x9a, 0xe3, 0x03, 0x83, 0x41, 0x4c, 0x7e, 0x00, 0x83, 0xc8, 0xcf, 0xca,
-  0x2a, 0x90, 0xb5, 0x7f, 0xf8, 0x57, 0x07, 0x43, 0x07, 0x03, 0xfb, 0x4a,
-  0xf8, 0xc9, 0xcf, 0xca, 0x2a, 0x90, 0xb5, 0x7f, 0x6a, 0x4b, 0xf3, 0xc0,
-  0x60, 0x10, 0x93, 0x3f, 0xf5, 0xfe, 0x77, 0xc9, 0xcf, 0xca, 0x2a, 0x90,
-  0xb5, 0xdf, 0x5a, 0x7d, 0x7a, 0x60, 0x30, 0x88, 0xc9, 0x0f, 0x60, 0x10,
-  0xf9, 0x59, 0x59, 0x05, 0xb2, 0xf6, 0x0f, 0x6e, 0xff, 0x53, 0xe8, 0x60,
-  0x60, 0x5f, 0x09, 0x3f, 0xf9, 0x59, 0x59, 0x05, 0x41, 0xed, 0x67, 0xf3,
-  0x0f, 0x75, 0x9c, 0xe8, 0x8c, 0x84, 0xfc, 0xb2, 0xf6, 0xbd, 0xd9, 0xf0,
-  0x5f, 0x1f, 0x45, 0x42, 0x7e, 0x59, 0xfb, 0x0c, 0x57, 0x9a, 0x2f, 0x47,
-  0x42, 0x7e, 0x59, 0xfb, 0xde, 0xef, 0xfb, 0xe0, 0xbf, 0x91, 0x90, 0x5f,
-  0xd6, 0x3e, 0x43, 0xd7, 0x3f, 0x3f, 0x89, 0x84, 0xfc, 0xb2, 0xf6, 0x19,
-  0x2e, 0xb5, 0x9c, 0x8f, 0x84, 0xfc, 0xa2, 0xf6, 0x73, 0xfc, 0x17, 0x33,
-  0xbe, 0x37, 0x37, 0x52, 0xf2, 0x8b, 0xda, 0x67, 0x48, 0x56, 0xce, 0x88,
-  0x94, 0xfc, 0xa2, 0xf6, 0x19, 0xca, 0xbe, 0x53, 0x1e, 0x29, 0xf9, 0x45,
-  0xed, 0x33, 0x3c, 0xfa, 0x72, 0x32, 0x52, 0xf2, 0x8b, 0xda, 0x67, 0x28,
-  0x5e, 0x37, 0x35, 0x52, 0xf2, 0x8b, 0xda, 0x67, 0x28, 0x5f, 0xf9, 0xcd,
-  0x48, 0xc9, 0x1f, 0xd4, 0x7e, 0xb6, 0xca, 0x9a, 0xdf, 0x05, 0xf9, 0x4d,
-  0xe1, 0x8a, 0xfc, 0xa6, 0x70, 0x45, 0x7e, 0xf3, 0xf7, 0x77, 0x43, 0x7e,
-  0x53, 0xb8, 0x22, 0xbf, 0x29, 0x5c, 0x91, 0x5f, 0xe8, 0x0c, 0x20, 0xf2,
-  0x13, 0xf9, 0x87, 0x2a, 0xf9, 0x43, 0x07, 0x00, 0x91, 0x9f, 0xc8, 0xff,
-  0x45, 0x27, 0xbf, 0x70, 0x00, 0x10, 0xf9, 0x89, 0xfc, 0x43, 0x81, 0xfc,
-  0x69, 0x22, 0x38, 0x8c, 0xfc, 0x3a, 0x7b, 0x05, 0x00, 0xf0, 0xf0, 0xe3,
-  0x85, 0xe1, 0x1d, 0xe7, 0x3e, 0x0b, 0xe0, 0xc7, 0xca, 0xe4, 0x0f, 0x73,
-  0x5f, 0x06, 0x92, 0x68, 0xde, 0x84, 0xd0, 0xfa, 0xd4, 0x66, 0xda, 0x66,
-  0x65, 0xf2, 0xeb, 0xec, 0x15, 0x00, 0xc0, 0x84, 0xb2, 0xf0, 0x8d, 0x1d,
-  0xb6, 0x99, 0xa6, 0x4a, 0xfe, 0x30, 0xf7, 0x65, 0x10, 0x46, 0xcd, 0x2b,
-  0x08, 0x9f, 0xf9, 0x72, 0x57, 0x01, 0x78, 0x4d, 0x99, 0xfc, 0x61, 0xee,
-  0xcb, 0x20, 0x3c, 0xf4, 0xc4, 0xf8, 0xd0, 0xfa, 0xd4, 0x66, 0x5a, 0xad,
-  0x32, 0xf9, 0x75, 0xf6, 0x0a, 0x00, 0x60, 0xf2, 0x9c, 0x47, 0x43, 0xeb,
-  0xd9, 0x66, 0x5a, 0x8e, 0xea, 0xcc, 0x3f, 0x73, 0xc5, 0x12, 0xbc, 0xbb,
-  0x7e, 0x9b, 0x1a, 0xf9, 0x4a, 0xf3, 0x95, 0x84, 0xb5, 0xce, 0xcc, 0x3f,
-  0xbd, 0x62, 0x39, 0xea, 0xd7, 0xaa, 0xed, 0x36, 0x8e, 0x9a, 0xf9, 0xa0,
-  0xd2, 0x17, 0x46, 0x67, 0xe6, 0x2f, 0x7b, 0xe1, 0x79, 0xfc, 0x6e, 0xe3,
-  0x56, 0xb5, 0x2f, 0x48, 0x72, 0x9c, 0xd2, 0x17, 0x46, 0x67, 0xe6, 0x4f,
-  0x56, 0x54, 0xe0, 0xe0, 0xcb, 0x5b, 0xd4, 0xde, 0x7f, 0xd6, 0x97, 0x95,
-  0xbe, 0x30, 0x3a, 0x33, 0x7f, 0x62, 0xd5, 0x7a, 0x34, 0x7c, 0x7f, 0x93,
-  0x52, 0xff, 0x79, 0x5f, 0x19, 0xae, 0xf4, 0x85, 0xd1, 0x99, 0xf9, 0xcb,
-  0x97, 0x2c, 0xc2, 0x8e, 0x4d, 0x6a, 0xef, 0x5f, 0x90, 0x98, 0xa8, 0xf4,
-  0x85, 0x19, 0x34, 0x00, 0x54, 0x96, 0x3d, 0x8c, 0xd8, 0x2b, 0x37, 0xa7,
-  0x7e, 0xd4, 0xf6, 0xb5, 0x53, 0xd2, 0xae, 0x65, 0x7e, 0x7e, 0x13, 0xf2,
-  0xf3, 0xc4, 0x7e, 0xb1, 0xa6, 0x2b, 0xb0, 0x8d, 0xda, 0xca, 0x3c, 0xa9,
-  0x9f, 0xdf, 0x84, 0xfc, 0x3c, 0xb1, 0xd7, 0x54, 0xa7, 0x2f, 0xc7, 0x5e,
-  0x5b, 0x97, 0x6a, 0x57, 0xe6, 0xe7, 0x37, 0x21, 0x3f, 0x4f, 0xec, 0xa5,
-  0x35, 0x37, 0xd2, 0xec, 0x77, 0x55, 0xde, 0x0f, 0x40, 0xee, 0xe7, 0x37,
-  0x21, 0x3f, 0x4f, 0xec, 0xc5, 0xdb, 0xc6, 0x00, 0x00, 0x76, 0xff, 0xa0,
-  0x3d, 0xad, 0x1d, 0x99, 0x9f, 0xdf, 0x84, 0xfc, 0x3c, 0xb1, 0xd7, 0x55,
-  0xed, 0x19, 0x74, 0xbf, 0x7a, 0xc3, 0x73, 0x5e, 0x59, 0xb4, 0x8f, 0x10,
-  0x44, 0xfe, 0x41, 0x03, 0xc0, 0x4f, 0xf6, 0xa8, 0xd6, 0xfc, 0x61, 0xf1,
-  0x46, 0x7e, 0xb2, 0xab, 0xae, 0xf9, 0x6b, 0x2b, 0xf3, 0x8c, 0xb4, 0x45,
-  0x10, 0xfc, 0x64, 0x57, 0x5d, 0xf3, 0x33, 0xd2, 0xaf, 0xa9, 0x3e, 0x84,
-  0x35, 0xd5, 0x87, 0xbc, 0x6b, 0x5d, 0xf2, 0xfb, 0x89, 0xaf, 0xb3, 0xe6,
-  0x67, 0xa4, 0x5f, 0x5a, 0x73, 0x03, 0x4b, 0x6b, 0x6e, 0x78, 0xd7, 0xba,
-  0xe4, 0xf7, 0x13, 0x3f, 0xca, 0x35, 0x7f, 0x58, 0xbc, 0x91, 0x9f, 0xec,
-  0xaa, 0x6b, 0xfe, 0xea, 0x0d, 0xcf, 0x61, 0x5d, 0xd5, 0x1e, 0xac, 0xab,
-  0xda, 0x33, 0x68, 0x10, 0xa8, 0x92, 0x3f, 0x50, 0x04, 0x67, 0x8a, 0xfc,
-  0xa2, 0xe0, 0xb9, 0xa8, 0x04, 0x2f, 0x4f, 0x7e, 0x51, 0xf0, 0x5c, 0x54,
-  0x82, 0x97, 0x27, 0xbf, 0x28, 0x78, 0x2e, 0x2a, 0xc1, 0xcb, 0x93, 0x5f,
-  0x14, 0x3c, 0x97, 0x29, 0xf2, 0x8b, 0x82, 0xe7, 0x74, 0x05, 0x2f, 0x23,
-  0x3e, 0xff, 0x55, 0x90, 0x91, 0x9f, 0x05, 0xcf, 0x65, 0xc7, 0x41, 0x7e,
-  0x51, 0x1f, 0x99, 0x22, 0xbf, 0xa8, 0x8f, 0x4c, 0x91, 0x5f, 0xd4, 0x47,
-  0xa6, 0xc8, 0x2f, 0xea, 0x23, 0x53, 0xe4, 0x17, 0xf5, 0x11, 0x95, 0xb7,
-  0x87, 0x27, 0xbf, 0xbf, 0x8f, 0x9c, 0xb8, 0xc8, 0xcf, 0x7b, 0x81, 0x4c,
-  0xc8, 0xef, 0xd7, 0x02, 0xa2, 0xe5, 0x90, 0x88, 0xfc, 0xbc, 0x17, 0xc8,
-  0x84, 0xfc, 0x7e, 0x2d, 0x20, 0x5a, 0xfe, 0x88, 0xc8, 0xcf, 0x7b, 0x81,
-  0x4c, 0xc8, 0xef, 0xd7, 0x02, 0xa2, 0xe5, 0x8f, 0x88, 0xfc, 0xbc, 0x17,
-  0x28, 0xd3, 0xe4, 0xe7, 0xbd, 0x40, 0x99, 0x26, 0x3f, 0xf3, 0x02, 0x65,
-  0xcb, 0x66, 0xe5, 0x28, 0xc8, 0x1f, 0xa4, 0x05, 0x4c, 0x66, 0xfe, 0xda,
-  0xca, 0x3c, 0xef, 0x9f, 0x0e, 0xf9, 0x83, 0xb4, 0x80, 0xc9, 0xcc, 0xaf,
-  0xbb, 0xe6, 0xf7, 0x0b, 0xec, 0x30, 0x0d, 0xa0, 0x8a, 0x5d, 0x95, 0xf7,
-  0x0f, 0xd2, 0x01, 0xaa, 0xe4, 0x0f, 0xd2, 0x02, 0x99, 0x24, 0x7f, 0x90,
-  0x16, 0xc8, 0x24, 0xf9, 0xfd, 0xf7, 0xb3, 0x11, 0x11, 0x64, 0xe4, 0xd7,
-  0x4d, 0xa0, 0x71, 0xb5, 0xec, 0x61, 0xf7, 0x75, 0x13, 0x68, 0x54, 0x84,
-  0xb0, 0x0e, 0xf9, 0x75, 0x13, 0x68, 0x5c, 0x2d, 0x7b, 0xd8, 0x7d, 0xdd,
-  0x04, 0x1a, 0xd7, 0xe4, 0xd7, 0x4d, 0xa0, 0x71, 0x4d, 0xfe, 0x40, 0x0d,
-  0xe0, 0x0a, 0xfc, 0x26, 0x18, 0x4f, 0xfe, 0xa8, 0x77, 0x95, 0xf9, 0x4d,
-  0x30, 0x9e, 0xfc, 0x51, 0xef, 0x2a, 0xf3, 0x9b, 0x60, 0x3c, 0xf9, 0xa3,
-  0xde, 0x55, 0xe6, 0x37, 0xc1, 0x78, 0xf2, 0x47, 0xbd, 0xab, 0xcc, 0x6f,
-  0x82, 0xf1, 0xe4, 0x77, 0xf9, 0xb5, 0x61, 0xe2, 0xd7, 0xef, 0x05, 0xe2,
-  0x37, 0xc1, 0x78, 0xf2, 0x07, 0x6a, 0x00, 0x1d, 0x6c, 0x5f, 0x3b, 0x05,
-  0x2b, 0x37, 0x9f, 0xf1, 0xfc, 0xff, 0xec, 0x5e, 0x10, 0x32, 0x4d, 0x7e,
-  0xd1, 0xd2, 0x2a, 0x53, 0xe4, 0x17, 0x2d, 0xad, 0xa2, 0x20, 0xbf, 0x8a,
-  0x06, 0x88, 0x92, 0xfc, 0x6c, 0x3f, 0x80, 0x21, 0x68, 0x5f, 0x20, 0xd3,
-  0xe4, 0x17, 0x2d, 0xad, 0x82, 0xc8, 0xaf, 0x3d, 0x00, 0x66, 0xae, 0x58,
-  0xe2, 0x95, 0x9b, 0x56, 0xa4, 0xd7, 0xb3, 0x5c, 0x61, 0x96, 0x22, 0xe9,
-  0x9a, 0xfc, 0xd3, 0x2b, 0x52, 0xa9, 0x7f, 0xcd, 0x15, 0xc1, 0xf5, 0x2c,
-  0x57, 0x98, 0xa5, 0x48, 0xba, 0x26, 0x7f, 0xd9, 0x0b, 0xcf, 0x03, 0x00,
-  0x8e, 0x0f, 0xfc, 0xcf, 0xc0, 0xae, 0x99, 0xb0, 0x65, 0x29, 0x92, 0xae,
-  0xc9, 0x9f, 0xac, 0x48, 0xbd, 0xf8, 0x49, 0xc1, 0xfb, 0xb3, 0x5c, 0x61,
-  0x96, 0x22, 0xe9, 0x9a, 0xfc, 0x89, 0x55, 0xeb, 0x01, 0x00, 0xa7, 0x56,
-  0x05, 0xd7, 0xb3, 0x5c, 0x61, 0x96, 0x22, 0xe9, 0x9a, 0xfc, 0xe5, 0x4b,
-  0x16, 0x01, 0x00, 0x3e, 0x18, 0xf8, 0x9f, 0x07, 0x13, 0xb6, 0x2c, 0x45,
-  0x52, 0x46, 0x7e, 0xad, 0x01, 0x20, 0x23, 0x2f, 0xcb, 0x15, 0xe6, 0x3d,
-  0x4a, 0xae, 0xc8, 0x2f, 0x23, 0x2f, 0xcb, 0x15, 0xe6, 0x3d, 0x4a, 0xae,
-  0xc8, 0x2f, 0x23, 0x2f, 0xcb, 0x15, 0xe6, 0x3d, 0x4a, 0xae, 0xc8, 0x2f,
-  0x23, 0x2f, 0xcb, 0x15, 0xe6, 0x3d, 0x4a, 0xae, 0xc8, 0x2f, 0x23, 0x2f,
-  0xcb, 0x15, 0xe6, 0x3d, 0x4a, 0xae, 0xc8, 0x2f, 0x13, 0xc9, 0x2c, 0x57,
-  0x98, 0xf7, 0x28, 0x85, 0x91, 0xdf, 0x99, 0x06, 0x90, 0x09, 0xde, 0xc8,
-  0xd7, 0xfc, 0x12, 0xc1, 0x1b, 0xf5, 0xb2, 0x47, 0x26, 0x78, 0xa3, 0x5e,
-  0xf3, 0xcb, 0x04, 0x6f, 0xd4, 0x6b, 0x7e, 0x99, 0xe0, 0x8d, 0x3a, 0x92,
-  0x54, 0x26, 0x78, 0xc3, 0x06, 0x4f, 0x36, 0x91, 0x9f, 0xc8, 0x3f, 0x54,
-  0xc9, 0x6f, 0x3d, 0x00, 0x88, 0xfc, 0x44, 0xfe, 0xcf, 0x33, 0xf9, 0xad,
-  0x06, 0x00, 0x91, 0x9f, 0xc8, 0xff, 0x79, 0x27, 0x7f, 0xda, 0x00, 0x90,
-  0x9d, 0xdb, 0x63, 0x4b, 0x7e, 0xdb, 0x73, 0x81, 0x6c, 0xc9, 0x6f, 0x7b,
-  0x2e, 0x90, 0x2d, 0xf9, 0x6d, 0xcf, 0x05, 0xb2, 0x25, 0xbf, 0xed, 0xb9,
-  0x40, 0xb6, 0xe4, 0xb7, 0x3d, 0x17, 0xc8, 0x96, 0xfc, 0x56, 0xe7, 0x02,
-  0xb9, 0x9a, 0xf9, 0x4d, 0xcf, 0x05, 0x72, 0x35, 0xf3, 0x9b, 0x9e, 0x0b,
-  0xe4, 0x6a, 0xe6, 0x37, 0x3d, 0x17, 0xc8, 0xd5, 0xcc, 0x6f, 0x7a, 0x2e,
-  0x90, 0xab, 0x99, 0xdf, 0xf4, 0x5c, 0x20, 0x57, 0x33, 0xbf, 0xd1, 0xb9,
-  0x40, 0xae, 0xc8, 0x6f, 0x7a, 0x2e, 0x90, 0x2b, 0xf2, 0x9b, 0x9e, 0x0b,
-  0xe4, 0x8a, 0xfc, 0xa6, 0xe7, 0x02, 0xb9, 0x22, 0xbf, 0xe9, 0xb9, 0x40,
-  0xae, 0xc8, 0x6f, 0x7a, 0x2e, 0x90, 0x2b, 0xf2, 0x07, 0xb5, 0x9f, 0xa3,
-  0x32, 0x2b, 0x03, 0xa9, 0xf0, 0x06, 0x3f, 0xc1, 0xd9, 0x52, 0x86, 0xdd,
-  0xd7, 0xcd, 0x19, 0xd6, 0x99, 0x95, 0x81, 0x54, 0x78, 0x83, 0x9f, 0xe0,
-  0x6c, 0x29, 0xc3, 0xee, 0xeb, 0xe6, 0x0c, 0xfb, 0xcf, 0x22, 0x95, 0xcd,
-  0xca, 0x40, 0x2a, 0xbc, 0xc1, 0x4f, 0x70, 0xb6, 0x94, 0x61, 0xf7, 0x75,
-  0x73, 0x86, 0x75, 0x66, 0x65, 0x20, 0x15, 0xde, 0xe0, 0x27, 0x38, 0x5b,
-  0xca, 0xb0, 0xfb, 0xba, 0x39, 0xc3, 0xfe, 0xb3, 0x48, 0x53, 0xb3, 0x72,
-  0xf8, 0xd2, 0xe7, 0xa1, 0x27, 0xc6, 0x0f, 0x22, 0x38, 0x5b, 0xca, 0xb0,
-  0xfb, 0xba, 0x39, 0xc3, 0xfe, 0xb3, 0x48, 0x65, 0xb3, 0x3e, 0x90, 0x0a,
-  0x6f, 0xf0, 0x13, 0x9c, 0x2d, 0x65, 0xd8, 0x7d, 0xdd, 0x9c, 0x61, 0x86,
-  0x2c, 0x3a, 0x1e, 0x9d, 0x8e, 0x47, 0x8f, 0xb7, 0xfb, 0xd8, 0x8f, 0x47,
-  0xcf, 0x8e, 0xf9, 0x0f, 0x70, 0x2b, 0x66, 0x02, 0xe6, 0x0c, 0xed, 0x01,
-  0x88, 0xb8, 0xff, 0xfe, 0xc3, 0xe3, 0x1e, 0x00, 0xc0, 0xfe, 0xd9, 0x93,
-  0xf0, 0xc0, 0xd7, 0x8a, 0xd3, 0x2a, 0xdf, 0xfe, 0xc5, 0x49, 0x2c, 0x2c,
-  0xc9, 0x09, 0xac, 0x53, 0x81, 0xcc, 0xfe, 0xb1, 0x2d, 0xfb, 0x00, 0x00,
-  0x6f, 0x3c, 0xf3, 0x24, 0x46, 0x95, 0x4e, 0x4e, 0xab, 0xdf, 0xfd, 0xdb,
-  0xf7, 0x30, 0xbf, 0x64, 0x5c, 0x60, 0x9d, 0x0a, 0x64, 0xf6, 0x8b, 0x7e,
-  0xf2, 0x3a, 0x00, 0xe0, 0x9d, 0x79, 0xa5, 0x18, 0x39, 0x37, 0x3d, 0x98,
-  0xef, 0xed, 0x5f, 0x1f, 0xc3, 0x82, 0xe4, 0x88, 0xc0, 0x3a, 0xa5, 0xf7,
-  0x97, 0xd8, 0x3f, 0xf1, 0xb3, 0x3a, 0x00, 0xc0, 0xce, 0x05, 0x65, 0x78,
-  0x70, 0x76, 0xc0, 0xfb, 0xff, 0xe6, 0x1f, 0x28, 0x2f, 0xc9, 0x0b, 0xac,
-  0x53, 0x7a, 0x7f, 0x89, 0xfd, 0xc2, 0xaa, 0x1d, 0x00, 0x80, 0x4d, 0xcb,
-  0x16, 0xa3, 0x20, 0x11, 0xd0, 0xff, 0xce, 0x3f, 0x60, 0x6e, 0x69, 0x71,
-  0x60, 0x9d, 0x52, 0xff, 0x12, 0xfb, 0x6f, 0xbf, 0xf2, 0x53, 0x00, 0x40,
-  0xc3, 0xb4, 0xb1, 0x18, 0x51, 0x9e, 0xae, 0x0f, 0xea, 0x36, 0x9f, 0xc5,
-  0x53, 0xa5, 0x77, 0x02, 0xeb, 0x54, 0x20, 0xb3, 0x9f, 0xb1, 0xed, 0x40,
-  0x6a, 0x00, 0xb4, 0xb7, 0xdf, 0x06, 0xfe, 0xd6, 0x2a, 0x6c, 0xe8, 0xe3,
-  0x90, 0x3a, 0x15, 0xc8, 0xec, 0x3b, 0xbb, 0xba, 0x81, 0x13, 0x67, 0xc5,
-  0x6b, 0xe4, 0x90, 0x3a, 0xa5, 0x35, 0xb6, 0xc4, 0xbe, 0xa3, 0xf3, 0x7f,
-  0xc0, 0x11, 0xf1, 0x1a, 0xfe, 0xfa, 0x11, 0xbb, 0x64, 0x0d, 0x99, 0x7d,
-  0x67, 0xe7, 0x27, 0xc0, 0x31, 0xf1, 0x6f, 0xfc, 0xe8, 0x98, 0xdd, 0xfb,
-  0xcb, 0xec, 0xbb, 0xba, 0xae, 0x03, 0x2d, 0x67, 0x43, 0x3c, 0x27, 0x76,
-  0xfd, 0xcb, 0xec, 0xdb, 0xaf, 0xf4, 0x01, 0x07, 0x4f, 0x07, 0xd4, 0x0c,
-  0x03, 0x00, 0x74, 0x07, 0xd6, 0xa9, 0x40, 0x6e, 0x1f, 0xf3, 0xfa, 0x87,
-  0x40, 0x88, 0x17, 0xa1, 0x03, 0xa0, 0xea, 0xd6, 0x79, 0xab, 0xc6, 0x6d,
-  0xed, 0x77, 0x5c, 0x68, 0x8d, 0xd5, 0x7e, 0xeb, 0xf5, 0xb6, 0x58, 0xed,
-  0x5f, 0xef, 0xfc, 0x77, 0xac, 0xf6, 0xfb, 0x5a, 0x9a, 0x63, 0xb5, 0x7f,
-  0x35, 0xe7, 0x62, 0xe4, 0xf6, 0x59, 0x85, 0x13, 0x4b, 0xfb, 0x01, 0x60,
-  0xc3, 0xbd, 0x13, 0x85, 0xe4, 0xe5, 0xeb, 0x74, 0xc9, 0xcf, 0xec, 0xf9,
-  0x7b, 0x55, 0xb7, 0xce, 0x7b, 0x22, 0x78, 0xc5, 0x84, 0x62, 0x21, 0x79,
-  0xf9, 0x3a, 0x5d, 0xf2, 0x33, 0x7b, 0xfe, 0xde, 0x8e, 0x0b, 0xad, 0x9e,
-  0x08, 0x7e, 0x69, 0x64, 0x91, 0x90, 0xbc, 0x7c, 0x9d, 0x2e, 0xf9, 0x99,
-  0x3d, 0x7f, 0x6f, 0xeb, 0xf5, 0x36, 0x20, 0xab, 0x0f, 0x00, 0xb0, 0x3a,
-  0xff, 0x11, 0x21, 0x79, 0xf9, 0x3a, 0x5d, 0xf2, 0x33, 0x7b, 0xfe, 0x5e,
-  0xea, 0x3a, 0xf5, 0xf7, 0x7f, 0x3a, 0x91, 0x14, 0x92, 0x97, 0xaf, 0xd3,
-  0x25, 0x3f, 0xb3, 0xe7, 0xef, 0xed, 0x6b, 0x69, 0xf6, 0x44, 0xf0, 0xc6,
-  0xde, 0xf1, 0x42, 0xf2, 0xf2, 0x75, 0xba, 0xe4, 0x67, 0xf6, 0xfc, 0xbd,
-  0x57, 0x73, 0x2e, 0xa6, 0x06, 0xc0, 0x86, 0x7b, 0x27, 0x62, 0xfa, 0x28,
-  0x35, 0x6f, 0x68, 0xe3, 0xb5, 0x2c, 0x2c, 0x2c, 0x31, 0xf7, 0x9c, 0x7c,
-  0xfd, 0xd8, 0x87, 0xd8, 0x3f, 0x7b, 0x92, 0x57, 0x46, 0xd6, 0x2d, 0xac,
-  0x98, 0x50, 0x8c, 0xa9, 0x0f, 0x3f, 0xa0, 0x64, 0x7f, 0xfa, 0xea, 0xc7,
-  0x98, 0x5f, 0x32, 0xce, 0xb8, 0xff, 0xef, 0xfe, 0xf1, 0x00, 0xde, 0x78,
-  0xe6, 0x49, 0xaf, 0x8c, 0xfe, 0x1c, 0xbc, 0x34, 0xb2, 0x08, 0xc9, 0x7c,
-  0x35, 0x77, 0x64, 0x73, 0xe7, 0x6d, 0x2c, 0x48, 0x8e, 0x30, 0xee, 0x7f,
-  0x51, 0xc3, 0x09, 0xbc, 0x33, 0xaf, 0xd4, 0x2b, 0x23, 0xab, 0x0f, 0xab,
-  0xf3, 0x1f, 0xc1, 0xb4, 0xd1, 0xf7, 0x29, 0xd9, 0x9f, 0xec, 0xb8, 0x89,
-  0xf2, 0x92, 0x3c, 0xe3, 0xfe, 0x97, 0xd5, 0x1f, 0xc6, 0xce, 0x05, 0x65,
-  0x5e, 0x19, 0xb8, 0x85, 0xa7, 0x13, 0x49, 0x4c, 0x1a, 0x97, 0xaf, 0x64,
-  0xff, 0xe1, 0xe5, 0x4e, 0xcc, 0x2d, 0x2d, 0x36, 0xee, 0xff, 0x95, 0x9d,
-  0xbb, 0xb1, 0x69, 0xd9, 0x62, 0xaf, 0x8c, 0xfe, 0xe1, 0xd8, 0xd8, 0x3b,
-  0x1e, 0x33, 0x46, 0xdd, 0x56, 0xb2, 0x3f, 0x7e, 0xed, 0x1e, 0x3c, 0x55,
-  0x7a, 0xc7, 0xb8, 0xff, 0x79, 0x27, 0xaf, 0xa0, 0x61, 0xda, 0x58, 0xaf,
-  0x9c, 0x71, 0x0d, 0x60, 0xf2, 0x35, 0x71, 0x09, 0x93, 0xaf, 0x89, 0x4b,
-  0x98, 0x7c, 0x4d, 0x5c, 0xc2, 0xe4, 0x6b, 0xe2, 0x12, 0x26, 0x5f, 0x13,
-  0x97, 0xe0, 0xbf, 0x26, 0x24, 0x82, 0x09, 0x24, 0x82, 0x33, 0x29, 0x6c,
-  0x49, 0x18, 0x93, 0x30, 0xfe, 0x2c, 0x09, 0x63, 0x4f, 0x03, 0xa8, 0x88,
-  0xde, 0xb0, 0x67, 0x4c, 0xec, 0x99, 0x08, 0xf6, 0x04, 0xa9, 0x64, 0x99,
-  0x12, 0xf6, 0x8c, 0x89, 0x3d, 0x13, 0xc1, 0x9e, 0x20, 0x95, 0x2c, 0x53,
-  0xc2, 0x9e, 0x31, 0xb1, 0x67, 0x22, 0xf8, 0xae, 0x20, 0x0d, 0x5f, 0xa6,
-  0x84, 0x3d, 0x63, 0x62, 0xcf, 0x44, 0xb0, 0x27, 0x48, 0x25, 0xcb, 0x94,
-  0xb0, 0x67, 0x4c, 0xec, 0x99, 0x08, 0x66, 0x82, 0x54, 0x26, 0x7a, 0xc3,
-  0x9e, 0x31, 0xb1, 0x4f, 0x13, 0xc1, 0xcb, 0x2f, 0x5f, 0xf0, 0x04, 0xaa,
-  0xad, 0xc0, 0x55, 0x7d, 0xde, 0x2f, 0x82, 0x37, 0x1e, 0x39, 0xea, 0x09,
-  0x54, 0x5b, 0x81, 0xab, 0xfa, 0xbc, 0x5f, 0x04, 0xaf, 0x6e, 0x6d, 0xf5,
-  0x04, 0xaa, 0xad, 0xc0, 0x55, 0x7d, 0xde, 0x2f, 0x82, 0x2b, 0x9b, 0x9a,
-  0x3c, 0x81, 0x6a, 0x2b, 0x70, 0x55, 0x9f, 0xf7, 0x8b, 0xe0, 0xad, 0xfb,
-  0x0f, 0x78, 0x02, 0xd5, 0x56, 0xe0, 0xaa, 0x3e, 0xef, 0x17, 0xc1, 0xdf,
-  0xba, 0xde, 0xee, 0x09, 0x54, 0x5b, 0x81, 0xab, 0xfa, 0x7c, 0xb6, 0x4b,
-  0x81, 0x6a, 0x6b, 0x6f, 0x2b, 0x50, 0x6d, 0xed, 0x6d, 0x05, 0xaa, 0xad,
-  0xbd, 0xad, 0x40, 0xb5, 0xb5, 0xb7, 0x15, 0xa8, 0xb6, 0xf6, 0x26, 0xee,
-  0x4e, 0x5b, 0x7b, 0x12, 0xc1, 0x04, 0x12, 0xc1, 0x04, 0x02, 0x0d, 0x00,
-  0xf2, 0xf0, 0x90, 0x87, 0x67, 0x08, 0x84, 0x3e, 0xf0, 0x10, 0x7a, 0x81,
-  0x74, 0x43, 0x21, 0x4c, 0x42, 0x27, 0xc2, 0xbc, 0x40, 0xba, 0xa1, 0x10,
-  0x26, 0xa1, 0x13, 0x61, 0x5e, 0x20, 0xdd, 0x50, 0x08, 0x93, 0xd0, 0x89,
-  0x30, 0x2f, 0x90, 0x6e, 0x28, 0x84, 0x49, 0xe8, 0x44, 0x98, 0x17, 0x48,
-  0x37, 0x14, 0xc2, 0x24, 0x74, 0x22, 0xcc, 0x0b, 0xa4, 0x1b, 0x0a, 0x61,
-  0x12, 0x3a, 0x21, 0x0d, 0x85, 0xb0, 0xf5, 0x0a, 0xfd, 0xb9, 0xa9, 0x37,
-  0x34, 0x6c, 0x42, 0x16, 0x0a, 0x61, 0xeb, 0x15, 0x3a, 0xd4, 0x74, 0x39,
-  0x34, 0x6c, 0x42, 0x16, 0x0a, 0x61, 0xeb, 0x15, 0xaa, 0x6f, 0xee, 0x0e,
-  0x0d, 0x9b, 0x90, 0x85, 0x42, 0xd8, 0x7a, 0x85, 0x0e, 0x36, 0x75, 0x85,
-  0x86, 0x4d, 0xc8, 0x42, 0x21, 0x6c, 0xbd, 0x42, 0x47, 0x4e, 0xb4, 0x86,
-  0x86, 0x4d, 0xc8, 0x42, 0x21, 0x6c, 0xbd, 0x42, 0xef, 0x9e, 0x18, 0x16,
-  0x1a, 0x36, 0x21, 0x0d, 0x85, 0xa0, 0xb0, 0x05, 0x0a, 0x5b, 0x88, 0x13,
-  0xb6, 0x5e, 0x21, 0x12, 0xc1, 0x04, 0x82, 0xcd, 0x00, 0x20, 0x51, 0x4c,
-  0xa2, 0xf8, 0x8b, 0x2e, 0x8a, 0xb5, 0xf2, 0x01, 0x74, 0x84, 0x6e, 0x14,
-  0xf9, 0x00, 0x3a, 0x42, 0x37, 0x8a, 0x7c, 0x00, 0x1d, 0xa1, 0x1b, 0x45,
-  0x3e, 0x80, 0x8e, 0xd0, 0x8d, 0x22, 0x1f, 0x40, 0x47, 0xe8, 0x46, 0x91,
-  0x0f, 0xa0, 0x23, 0x74, 0x23, 0xcb, 0x07, 0x70, 0x19, 0x2e, 0x61, 0x92,
-  0x0f, 0xe0, 0x32, 0x5c, 0xc2, 0x24, 0x1f, 0xc0, 0x65, 0xb8, 0x84, 0x49,
-  0x3e, 0x80, 0xcb, 0x70, 0x09, 0x93, 0x7c, 0x00, 0x97, 0xe1, 0x12, 0x26,
-  0xf9, 0x00, 0x2e, 0xc3, 0x25, 0x8c, 0xf2, 0x01, 0x28, 0x5c, 0x82, 0xc2,
-  0x25, 0xe2, 0xb4, 0x77, 0x1d, 0x2e, 0x41, 0x22, 0x98, 0x40, 0x22, 0x38,
-  0x93, 0xc2, 0x96, 0x84, 0x31, 0x09, 0xe3, 0xcf, 0x92, 0x30, 0xa6, 0x7c,
-  0x00, 0xca, 0x07, 0xa0, 0x7c, 0x00, 0xca, 0x07, 0xa0, 0x7c, 0x00, 0xca,
-  0x07, 0x20, 0x81, 0x4b, 0x02, 0x97, 0xf2, 0x01, 0x08, 0x04, 0x12, 0xc1,
-  0x04, 0xc2, 0x90, 0x81, 0xb7, 0x13, 0x1c, 0xdf, 0x2f, 0x18, 0xea, 0xc7,
-  0xa3, 0xf7, 0xc5, 0x4c, 0x81, 0xa1, 0x7d, 0x3c, 0x3a, 0x81, 0x40, 0x20,
-  0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81,
-  0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04,
-  0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10,
-  0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40,
-  0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02,
-  0x81, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08,
-  0x04, 0x02, 0x81, 0x40, 0x20, 0x10, 0x08, 0x84, 0xe8, 0xf1, 0x7f, 0x15,
-  0x54, 0x5d, 0xd8, 0xde, 0x62, 0x59, 0x20, 0x00, 0x00, 0x00, 0x00, 0x49,
-  0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
+static const unsigned char atlas192x96Blob[] = {
+  0x4d, 0x56, 0x50, 0x49, 0xc0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x84, 0x0f, 0x00, 0x00,
+  0x4f, 0x21, 0x1f, 0x2d, 0xff, 0x04, 0x00, 0x6b, 0x1f, 0x2e, 0x04, 0x00,
+  0x6b, 0x2f, 0x20, 0x2a, 0x04, 0x00, 0x6b, 0x2f, 0x1f, 0x2f, 0x04, 0x00,
+  0x6c, 0x1f, 0x30, 0x04, 0x00, 0x6b, 0x2f, 0x20, 0x27, 0x04, 0x00, 0x6b,
+  0xaf, 0x1f, 0x2d, 0xff, 0xdc, 0xca, 0x74, 0xff, 0xf4, 0xec, 0xa9, 0x04,
+  0x00, 0x16, 0x31, 0xf8, 0xf8, 0xf8, 0x04, 0x00, 0x08, 0x10, 0x00, 0x0f,
+  0x40, 0x00, 0x19, 0x04, 0x34, 0x00, 0x04, 0x00, 0x03, 0x7f, 0xde, 0xca,
+  0x60, 0xff, 0xf5, 0xec, 0x9e, 0x04, 0x00, 0x16, 0x04, 0x80, 0x00, 0x08,
+  0x10, 0x00, 0x0f, 0x40, 0x00, 0x19, 0x04, 0x34, 0x00, 0x04, 0x00, 0x03,
+  0x7f, 0xd7, 0xca, 0x92, 0xff, 0xf1, 0xeb, 0xbe, 0x04, 0x00, 0x16, 0x04,
+  0x80, 0x00, 0x08, 0x10, 0x00, 0x0f, 0x40, 0x00, 0x19, 0x04, 0x34, 0x00,
+  0x04, 0x00, 0x03, 0x7f, 0xdf, 0xca, 0x54, 0xff, 0xf6, 0xec, 0x97, 0x04,
+  0x00, 0x16, 0x04, 0x80, 0x00, 0x08, 0x10, 0x00, 0x0f, 0x40, 0x00, 0x19,
+  0x04, 0x34, 0x00, 0x04, 0x00, 0x03, 0x7f, 0xe1, 0xca, 0x33, 0xff, 0xf7,
+  0xec, 0x8a, 0x04, 0x00, 0x16, 0x04, 0x80, 0x00, 0x08, 0x10, 0x00, 0x0f,
+  0x40, 0x00, 0x19, 0x04, 0x34, 0x00, 0x04, 0x00, 0x03, 0x7f, 0xd3, 0xca,
+  0xa9, 0xff, 0xef, 0xeb, 0xcf, 0x04, 0x00, 0x16, 0x04, 0x80, 0x00, 0x08,
+  0x10, 0x00, 0x0f, 0x40, 0x00, 0x19, 0x04, 0x34, 0x00, 0x04, 0x00, 0x03,
+  0x31, 0xc3, 0x8f, 0x53, 0x04, 0x03, 0x0f, 0x04, 0x00, 0x11, 0x04, 0xc0,
+  0x02, 0x08, 0x10, 0x00, 0x0f, 0x3c, 0x00, 0x15, 0x0c, 0x48, 0x00, 0x04,
+  0x00, 0x03, 0x31, 0xc7, 0x8d, 0x42, 0x04, 0x03, 0x0f, 0x04, 0x00, 0x11,
+  0x04, 0xc0, 0x02, 0x08, 0x10, 0x00, 0x0f, 0x3c, 0x00, 0x15, 0x0c, 0x48,
+  0x00, 0x04, 0x00, 0x03, 0x31, 0xb9, 0x92, 0x6c, 0x04, 0x03, 0x0f, 0x04,
+  0x00, 0x11, 0x04, 0xc0, 0x02, 0x08, 0x10, 0x00, 0x0f, 0x3c, 0x00, 0x15,
+  0x0c, 0x48, 0x00, 0x04, 0x00, 0x03, 0x31, 0xca, 0x8d, 0x38, 0x04, 0x03,
+  0x0f, 0x04, 0x00, 0x11, 0x04, 0xc0, 0x02, 0x08, 0x10, 0x00, 0x0f, 0x3c,
+  0x00, 0x15, 0x0c, 0x48, 0x00, 0x04, 0x00, 0x03, 0x31, 0xce, 0x8b, 0x16,
+  0x04, 0x03, 0x0f, 0x04, 0x00, 0x11, 0x04, 0xc0, 0x02, 0x08, 0x10, 0x00,
+  0x0f, 0x3c, 0x00, 0x15, 0x0c, 0x48, 0x00, 0x04, 0x00, 0x03, 0x31, 0xae,
+  0x95, 0x7f, 0x04, 0x03, 0x0f, 0x04, 0x00, 0x11, 0x04, 0xc0, 0x02, 0x08,
+  0x10, 0x00, 0x0f, 0x3c, 0x00, 0x15, 0x0c, 0x48, 0x00, 0x0c, 0x00, 0x03,
+  0x3f, 0xac, 0x60, 0x3d, 0x0c, 0x03, 0x0a, 0x0f, 0xfc, 0x02, 0x2d, 0x08,
+  0x60, 0x00, 0x0f, 0x00, 0x03, 0x01, 0x3f, 0xb2, 0x5c, 0x30, 0x0c, 0x03,
+  0x0a, 0x0f, 0xfc, 0x02, 0x2d, 0x08, 0x60, 0x00, 0x0f, 0x00, 0x03, 0x01,
+  0x3f, 0x9f, 0x66, 0x51, 0x0c, 0x03, 0x0a, 0x0f, 0xfc, 0x02, 0x2d, 0x08,
+  0x60, 0x00, 0x0f, 0x00, 0x03, 0x01, 0x3f, 0xb5, 0x5b, 0x28, 0x0c, 0x03,
+  0x0a, 0x0f, 0xfc, 0x02, 0x2d, 0x08, 0x60, 0x00, 0x0f, 0x00, 0x03, 0x01,
+  0x3f, 0xba, 0x57, 0x0b, 0x0c, 0x03, 0x0a, 0x0f, 0xfc, 0x02, 0x2d, 0x08,
+  0x60, 0x00, 0x0f, 0x00, 0x03, 0x01, 0x3f, 0x92, 0x6c, 0x60, 0x0c, 0x03,
+  0x0a, 0x0f, 0xfc, 0x02, 0x2d, 0x08, 0x60, 0x00, 0x0f, 0x00, 0x03, 0x05,
+  0x00, 0x04, 0x00, 0x0f, 0xf8, 0x05, 0x45, 0x08, 0x60, 0x00, 0x0f, 0x00,
+  0x03, 0x05, 0x00, 0x04, 0x00, 0x0f, 0xf8, 0x05, 0x45, 0x08, 0x60, 0x00,
+  0x0f, 0x00, 0x03, 0x05, 0x00, 0x04, 0x00, 0x0f, 0xf8, 0x05, 0x45, 0x08,
+  0x60, 0x00, 0x0f, 0x00, 0x03, 0x05, 0x00, 0x04, 0x00, 0x0f, 0xf8, 0x05,
+  0x45, 0x08, 0x60, 0x00, 0x0f, 0x00, 0x03, 0x05, 0x00, 0x04, 0x00, 0x0f,
+  0xf8, 0x05, 0x45, 0x08, 0x60, 0x00, 0x0f, 0x00, 0x03, 0x05, 0x00, 0x04,
+  0x00, 0x0f, 0xf8, 0x05, 0x45, 0x08, 0x60, 0x00, 0x0f, 0x00, 0x03, 0x01,
+  0x0f, 0xf4, 0x08, 0x4d, 0x0f, 0x00, 0x09, 0x25, 0x0f, 0xf4, 0x08, 0x35,
+  0x0f, 0x00, 0x09, 0x25, 0x0f, 0xf4, 0x08, 0x35, 0x0f, 0x00, 0x09, 0x25,
+  0x0f, 0xf4, 0x08, 0x35, 0x0f, 0x00, 0x09, 0x25, 0x0f, 0xf4, 0x08, 0x35,
+  0x0f, 0x00, 0x09, 0x25, 0x0f, 0xf4, 0x08, 0x35, 0x0f, 0x00, 0x09, 0x0d,
+  0x0f, 0xfc, 0x02, 0x55, 0x0f, 0x00, 0x03, 0x19, 0x0f, 0xfc, 0x02, 0x41,
+  0x0f, 0x00, 0x03, 0x19, 0x0f, 0xfc, 0x02, 0x41, 0x0f, 0x00, 0x03, 0x19,
+  0x0f, 0xfc, 0x02, 0x41, 0x0f, 0x00, 0x03, 0x19, 0x0f, 0xfc, 0x02, 0x41,
+  0x0f, 0x00, 0x03, 0x19, 0x0f, 0xfc, 0x02, 0x41, 0x0f, 0x00, 0x03, 0x15,
+  0x0f, 0xfc, 0x02, 0x45, 0x0f, 0x00, 0x03, 0x15, 0x0f, 0xfc, 0x02, 0x45,
+  0x0f, 0x00, 0x03, 0x15, 0x0f, 0xfc, 0x02, 0x45, 0x0f, 0x00, 0x03, 0x15,
+  0x0f, 0xfc, 0x02, 0x45, 0x0f, 0x00, 0x03, 0x15, 0x0f, 0xfc, 0x02, 0x45,
+  0x0f, 0x00, 0x03, 0x15, 0x0f, 0xfc, 0x02, 0x45, 0x0f, 0x00, 0x03, 0x11,
+  0x0f, 0xfc, 0x02, 0x49, 0x0f, 0x00, 0x03, 0x11, 0x0f, 0xfc, 0x02, 0x49,
+  0x0f, 0x00, 0x03, 0x11, 0x0f, 0xfc, 0x02, 0x49, 0x0f, 0x00, 0x03, 0x11,
+  0x0f, 0xfc, 0x02, 0x49, 0x0f, 0x00, 0x03, 0x11, 0x0f, 0xfc, 0x02, 0x49,
+  0x0f, 0x00, 0x03, 0x11, 0x0f, 0xfc, 0x02, 0x49, 0x0f, 0x00, 0x03, 0x0d,
+  0x0f, 0xfc, 0x02, 0x4d, 0x0f, 0x00, 0x03, 0x0d, 0x0f, 0xfc, 0x02, 0x4d,
+  0x0f, 0x00, 0x03, 0x0d, 0x0f, 0xfc, 0x02, 0x4d, 0x0f, 0x00, 0x03, 0x0d,
+  0x0f, 0xfc, 0x02, 0x4d, 0x0f, 0x00, 0x03, 0x0d, 0x0f, 0xfc, 0x02, 0x4d,
+  0x0f, 0x00, 0x03, 0x0d, 0x0f, 0xfc, 0x02, 0x4d, 0x0f, 0x00, 0x03, 0x09,
+  0x0f, 0xfc, 0x02, 0x05, 0x00, 0x24, 0x00, 0x0f, 0x04, 0x00, 0x19, 0x0f,
+  0x00, 0x03, 0x0d, 0x08, 0x00, 0x1b, 0x08, 0x00, 0x03, 0x0f, 0xfc, 0x02,
+  0x05, 0x00, 0x24, 0x00, 0x0f, 0x04, 0x00, 0x19, 0x0f, 0x00, 0x03, 0x0d,
+  0x08, 0x00, 0x1b, 0x08, 0x00, 0x03, 0x0f, 0xfc, 0x02, 0x05, 0x00, 0x24,
+  0x00, 0x0f, 0x04, 0x00, 0x19, 0x0f, 0x00, 0x03, 0x0d, 0x08, 0x00, 0x1b,
+  0x08, 0x00, 0x03, 0x0f, 0xfc, 0x02, 0x05, 0x00, 0x24, 0x00, 0x0f, 0x04,
+  0x00, 0x19, 0x0f, 0x00, 0x03, 0x0d, 0x08, 0x00, 0x1b, 0x08, 0x00, 0x03,
+  0x0f, 0xfc, 0x02, 0x05, 0x00, 0x24, 0x00, 0x0f, 0x04, 0x00, 0x19, 0x0f,
+  0x00, 0x03, 0x0d, 0x08, 0x00, 0x1b, 0x08, 0x00, 0x03, 0x0f, 0xfc, 0x02,
+  0x05, 0x00, 0x24, 0x00, 0x0f, 0x04, 0x00, 0x19, 0x0f, 0x00, 0x03, 0x0d,
+  0x0f, 0x00, 0x1b, 0x01, 0x0f, 0xf8, 0x05, 0x09, 0x00, 0x0c, 0x00, 0x04,
+  0xc0, 0x14, 0x0f, 0x04, 0x00, 0x0d, 0x0f, 0x50, 0x12, 0x11, 0x0f, 0x00,
+  0x03, 0x01, 0x0f, 0xf8, 0x05, 0x09, 0x00, 0x0c, 0x00, 0x04, 0xc0, 0x14,
+  0x0f, 0x04, 0x00, 0x0d, 0x0f, 0x50, 0x12, 0x11, 0x0f, 0x00, 0x03, 0x01,
+  0x0f, 0xf8, 0x05, 0x09, 0x00, 0x0c, 0x00, 0x04, 0xc0, 0x14, 0x0f, 0x04,
+  0x00, 0x0d, 0x0f, 0x50, 0x12, 0x11, 0x0f, 0x00, 0x03, 0x01, 0x0f, 0xf8,
+  0x05, 0x09, 0x00, 0x0c, 0x00, 0x04, 0xc0, 0x14, 0x0f, 0x04, 0x00, 0x0d,
+  0x0f, 0x50, 0x12, 0x11, 0x0f, 0x00, 0x03, 0x01, 0x0f, 0xf8, 0x05, 0x09,
+  0x00, 0x0c, 0x00, 0x04, 0xc0, 0x14, 0x0f, 0x04, 0x00, 0x0d, 0x0f, 0x50,
+  0x12, 0x11, 0x0f, 0x00, 0x03, 0x01, 0x0f, 0xf8, 0x05, 0x09, 0x00, 0x0c,
+  0x00, 0x04, 0xc0, 0x14, 0x0f, 0x04, 0x00, 0x0d, 0x0f, 0x50, 0x12, 0x11,
+  0x0c, 0x00, 0x03, 0x0f, 0xf4, 0x08, 0x0d, 0x00, 0x10, 0x00, 0x04, 0xdc,
+  0x05, 0x04, 0xbc, 0x23, 0x0f, 0x10, 0x00, 0x01, 0x0f, 0x44, 0x1b, 0x15,
+  0x0c, 0x00, 0x03, 0x0f, 0xf4, 0x08, 0x0d, 0x00, 0x10, 0x00, 0x04, 0xdc,
+  0x05, 0x0f, 0xcc, 0x23, 0x05, 0x00, 0x1c, 0x00, 0x0f, 0x44, 0x1b, 0x15,
+  0x0c, 0x00, 0x03, 0x0f, 0xf4, 0x08, 0x0d, 0x00, 0x10, 0x00, 0x04, 0xdc,
+  0x05, 0x0f, 0x7c, 0x00, 0x01, 0x04, 0x1c, 0x00, 0x0f, 0x44, 0x1b, 0x15,
+  0x0c, 0x00, 0x03, 0x0f, 0xf4, 0x08, 0x0d, 0x00, 0x10, 0x00, 0x04, 0xdc,
+  0x05, 0x0f, 0x80, 0x00, 0x01, 0x04, 0x1c, 0x00, 0x0f, 0x44, 0x1b, 0x15,
+  0x0c, 0x00, 0x03, 0x0f, 0xf4, 0x08, 0x0d, 0x00, 0x10, 0x00, 0x04, 0xdc,
+  0x05, 0x04, 0x74, 0x00, 0x0f, 0xf8, 0x05, 0x01, 0x0f, 0x44, 0x1b, 0x15,
+  0x0c, 0x00, 0x03, 0x0f, 0xf4, 0x08, 0x0d, 0x00, 0x10, 0x00, 0x04, 0xdc,
+  0x05, 0x0c, 0xfc, 0x00, 0x08, 0xf8, 0x05, 0x0f, 0x44, 0x1b, 0x15, 0x0f,
+  0x00, 0x21, 0x09, 0x0f, 0xf0, 0x0b, 0x01, 0x0f, 0x00, 0x03, 0x31, 0x0f,
+  0x00, 0x24, 0x05, 0x0f, 0x00, 0x0c, 0x01, 0x0f, 0xb8, 0x02, 0x01, 0x0c,
+  0x00, 0x03, 0x0f, 0xf8, 0x08, 0x01, 0x0f, 0x00, 0x03, 0x09, 0x0f, 0x00,
+  0x24, 0x05, 0x0f, 0x00, 0x0c, 0x01, 0x0f, 0xb8, 0x02, 0x01, 0x0c, 0x00,
+  0x03, 0x0f, 0x10, 0x00, 0x01, 0x0f, 0x00, 0x03, 0x09, 0x0f, 0x00, 0x24,
+  0x05, 0x0f, 0x00, 0x0c, 0x01, 0x0f, 0xb8, 0x02, 0x01, 0x0c, 0x00, 0x03,
+  0x0f, 0x10, 0x00, 0x01, 0x0f, 0x00, 0x03, 0x09, 0x0f, 0x00, 0x24, 0x05,
+  0x0f, 0x00, 0x0c, 0x01, 0x0f, 0xb8, 0x02, 0x01, 0x0f, 0x00, 0x03, 0x2d,
+  0x0f, 0x00, 0x24, 0x05, 0x0f, 0x00, 0x0c, 0x01, 0x0f, 0xb8, 0x02, 0x01,
+  0x0c, 0x00, 0x03, 0x0c, 0x0c, 0x00, 0x0f, 0x00, 0x03, 0x0d, 0x0f, 0x00,
+  0x24, 0x11, 0x0f, 0xec, 0x0e, 0x05, 0x0f, 0x00, 0x03, 0x2d, 0x0f, 0x04,
+  0x27, 0x01, 0x0f, 0x00, 0x0c, 0x05, 0x0f, 0xbc, 0x02, 0x05, 0x0f, 0x00,
+  0x03, 0x29, 0x0f, 0x04, 0x27, 0x01, 0x0f, 0x00, 0x0c, 0x05, 0x0f, 0xbc,
+  0x02, 0x05, 0x0f, 0x00, 0x03, 0x29, 0x0f, 0x04, 0x27, 0x01, 0x0f, 0x00,
+  0x0c, 0x05, 0x0f, 0xbc, 0x02, 0x05, 0x0f, 0x00, 0x03, 0x29, 0x0f, 0x04,
+  0x27, 0x01, 0x0f, 0x00, 0x0c, 0x05, 0x0f, 0xbc, 0x02, 0x05, 0x0f, 0x00,
+  0x03, 0x29, 0x0f, 0x04, 0x27, 0x01, 0x0f, 0x00, 0x0c, 0x05, 0x0f, 0xbc,
+  0x02, 0x05, 0x0f, 0x00, 0x03, 0x01, 0x0c, 0x10, 0x00, 0x0f, 0x00, 0x03,
+  0x05, 0x0f, 0x04, 0x27, 0x01, 0x0f, 0x00, 0x0c, 0x01, 0x0f, 0xb8, 0x08,
+  0x09, 0x0f, 0x00, 0x03, 0x25, 0x0c, 0xf8, 0x02, 0x0f, 0x00, 0x12, 0x05,
+  0x0f, 0xe8, 0x11, 0x09, 0x0f, 0x00, 0x03, 0x29, 0x0c, 0xf8, 0x02, 0x0f,
+  0x00, 0x12, 0x05, 0x0f, 0xe8, 0x11, 0x09, 0x0f, 0x00, 0x03, 0x29, 0x0c,
+  0xf8, 0x02, 0x0f, 0x00, 0x12, 0x05, 0x0f, 0xe8, 0x11, 0x09, 0x0f, 0x00,
+  0x03, 0x29, 0x0c, 0xf8, 0x02, 0x0f, 0x00, 0x12, 0x05, 0x0f, 0xe8, 0x11,
+  0x09, 0x0f, 0x00, 0x03, 0x29, 0x0c, 0xf8, 0x02, 0x0f, 0x00, 0x12, 0x05,
+  0x0f, 0xe8, 0x11, 0x09, 0x0f, 0x00, 0x03, 0x29, 0x0c, 0xf8, 0x02, 0x0f,
+  0x00, 0x12, 0x01, 0x0f, 0xe4, 0x14, 0x0d, 0x0f, 0x00, 0x03, 0x25, 0x0f,
+  0xfc, 0x02, 0x01, 0x0f, 0x00, 0x12, 0x01, 0x0f, 0xe4, 0x14, 0x0d, 0x0f,
+  0x00, 0x0c, 0x0d, 0x0f, 0x00, 0x03, 0x05, 0x0f, 0xfc, 0x02, 0x01, 0x0f,
+  0x00, 0x12, 0x01, 0x0f, 0xe4, 0x14, 0x0d, 0x0f, 0x00, 0x0c, 0x25, 0x0f,
+  0xfc, 0x02, 0x01, 0x0f, 0x00, 0x12, 0x01, 0x0f, 0xe4, 0x14, 0x0d, 0x0f,
+  0x00, 0x0c, 0x25, 0x0f, 0xfc, 0x02, 0x01, 0x0f, 0x00, 0x12, 0x01, 0x0f,
+  0xe4, 0x14, 0x0d, 0x0f, 0x00, 0x03, 0x25, 0x0f, 0xfc, 0x02, 0x01, 0x0f,
+  0x00, 0x12, 0x01, 0x0f, 0xe4, 0x14, 0x0d, 0x0f, 0x00, 0x03, 0x25, 0x0f,
+  0xfc, 0x02, 0x01, 0x0f, 0x00, 0x12, 0x05, 0x0f, 0x00, 0x03, 0x3d, 0x0f,
+  0xfc, 0x02, 0x05, 0x0f, 0x00, 0x0c, 0x0d, 0x0f, 0x00, 0x06, 0x35, 0x0f,
+  0xfc, 0x02, 0x05, 0x0f, 0x00, 0x0c, 0x0d, 0x0f, 0x00, 0x06, 0x19, 0x0f,
+  0x00, 0x03, 0x09, 0x0f, 0xfc, 0x02, 0x05, 0x0f, 0x00, 0x0c, 0x0d, 0x0f,
+  0x00, 0x06, 0x35, 0x0f, 0xfc, 0x02, 0x05, 0x0f, 0x00, 0x0c, 0x0d, 0x0f,
+  0x00, 0x03, 0x35, 0x0f, 0xfc, 0x02, 0x05, 0x0f, 0x00, 0x0c, 0x0d, 0x0f,
+  0x00, 0x03, 0x35, 0x0f, 0xfc, 0x02, 0x05, 0x0f, 0x00, 0x30, 0x21, 0x0f,
+  0x00, 0x03, 0x1d, 0x0f, 0xfc, 0x02, 0x09, 0x0f, 0x00, 0x0c, 0x09, 0x0f,
+  0x00, 0x03, 0x35, 0x0f, 0xfc, 0x02, 0x09, 0x0f, 0x00, 0x0c, 0x09, 0x0f,
+  0x00, 0x09, 0x35, 0x0f, 0xfc, 0x02, 0x09, 0x0f, 0x00, 0x0c, 0x09, 0x0f,
+  0x00, 0x03, 0x35, 0x0f, 0xfc, 0x02, 0x09, 0x0f, 0x00, 0x0c, 0x09, 0x0f,
+  0x00, 0x03, 0x35, 0x0f, 0xfc, 0x02, 0x09, 0x0f, 0x00, 0x0c, 0x09, 0x0f,
+  0x00, 0x03, 0x35, 0x0f, 0xfc, 0x02, 0x09, 0x0f, 0x00, 0x0c, 0x05, 0x0f,
+  0x00, 0x03, 0x35, 0x0c, 0xe8, 0x02, 0x0f, 0x5c, 0x1b, 0x01, 0x0f, 0x00,
+  0x03, 0x49, 0x0c, 0xe8, 0x02, 0x0f, 0x5c, 0x1b, 0x01, 0x0f, 0x00, 0x03,
+  0x49, 0x0c, 0xe8, 0x02, 0x0f, 0x5c, 0x1b, 0x01, 0x0f, 0x00, 0x03, 0x49,
+  0x0c, 0xe8, 0x02, 0x0f, 0x5c, 0x1b, 0x01, 0x0f, 0x00, 0x03, 0x49, 0x0c,
+  0xe8, 0x02, 0x0f, 0x5c, 0x1b, 0x01, 0x0f, 0x00, 0x03, 0x35, 0x0f, 0x00,
+  0x12, 0x01, 0x0c, 0xe8, 0x02, 0x0f, 0x5c, 0x1b, 0x01, 0x0f, 0x00, 0x03,
+  0x29, 0x08, 0xf4, 0x02, 0x0c, 0x0c, 0x03, 0x0c, 0x00, 0x03, 0x0f, 0x58,
+  0x1e, 0x09, 0x0f, 0x00, 0x03, 0x51, 0x0f, 0x58, 0x1e, 0x09, 0x0f, 0x00,
+  0x03, 0x51, 0x0f, 0x58, 0x1e, 0x09, 0x0f, 0x00, 0x03, 0x2d, 0x0f, 0x00,
+  0x0c, 0x05, 0x0f, 0x4c, 0x1b, 0x05, 0x0c, 0x10, 0x00, 0x0f, 0x00, 0x03,
+  0x2d, 0x0c, 0x04, 0x00, 0x0f, 0x00, 0x03, 0x01, 0x0f, 0x58, 0x1e, 0x09,
+  0x0f, 0x00, 0x03, 0x2d, 0x0f, 0x00, 0x18, 0x05, 0x0f, 0x4c, 0x1b, 0x05,
+  0x0c, 0x10, 0x00, 0x0f, 0x00, 0x03, 0x1d, 0x0f, 0x18, 0x3c, 0x15, 0x0f,
+  0x3c, 0x1e, 0x01, 0x0f, 0x50, 0x1b, 0x01, 0x0f, 0x00, 0x03, 0x1d, 0x0f,
+  0x18, 0x3c, 0x15, 0x0f, 0x3c, 0x1e, 0x01, 0x0f, 0x50, 0x1b, 0x01, 0x0f,
+  0x00, 0x03, 0x1d, 0x0f, 0x18, 0x3c, 0x15, 0x0f, 0x3c, 0x1e, 0x01, 0x0f,
+  0x50, 0x1b, 0x01, 0x0f, 0x00, 0x03, 0x1d, 0x0f, 0x18, 0x3c, 0x15, 0x0f,
+  0x3c, 0x1e, 0x01, 0x0f, 0x50, 0x1b, 0x01, 0x0f, 0x00, 0x03, 0x1d, 0x0f,
+  0x18, 0x3c, 0x15, 0x0f, 0x3c, 0x1e, 0x01, 0x0f, 0x50, 0x1b, 0x01, 0x0f,
+  0x00, 0x03, 0x1d, 0x0f, 0x18, 0x3c, 0x15, 0x0f, 0x3c, 0x1e, 0x01, 0x0f,
+  0x50, 0x1b, 0x01, 0x0f, 0x00, 0x3c, 0x21, 0x0f, 0x20, 0x03, 0x15, 0x0f,
+  0xfc, 0x02, 0x09, 0x0f, 0x00, 0x3c, 0x29, 0x0f, 0x20, 0x03, 0x15, 0x0f,
+  0xfc, 0x02, 0x09, 0x0f, 0x00, 0x3c, 0x29, 0x0f, 0x20, 0x03, 0x15, 0x0f,
+  0xfc, 0x02, 0x09, 0x0f, 0x00, 0x3c, 0x29, 0x0f, 0x20, 0x03, 0x15, 0x0f,
+  0xfc, 0x02, 0x09, 0x0f, 0x00, 0x3c, 0x29, 0x0f, 0x20, 0x03, 0x15, 0x0f,
+  0xfc, 0x02, 0x09, 0x0f, 0x00, 0x3c, 0x29, 0x0f, 0x20, 0x03, 0x15, 0x0f,
+  0xfc, 0x02, 0x09, 0x0f, 0x00, 0x03, 0x3d, 0x0f, 0xfc, 0x02, 0x1d, 0x0f,
+  0x00, 0x03, 0x3d, 0x0f, 0xfc, 0x02, 0x1d, 0x0f, 0x00, 0x03, 0x3d, 0x0f,
+  0xfc, 0x02, 0x1d, 0x0f, 0x00, 0x03, 0x3d, 0x0f, 0xfc, 0x02, 0x1d, 0x0f,
+  0x00, 0x03, 0x3d, 0x0f, 0xfc, 0x02, 0x1d, 0x0f, 0x00, 0x03, 0x3d, 0x0f,
+  0xfc, 0x02, 0x1d, 0x0f, 0x00, 0x03, 0x39, 0x0f, 0xfc, 0x02, 0x21, 0x0f,
+  0x00, 0x03, 0x39, 0x0f, 0xfc, 0x02, 0x21, 0x0f, 0x00, 0x03, 0x39, 0x0f,
+  0xfc, 0x02, 0x21, 0x0f, 0x00, 0x03, 0x39, 0x0f, 0xfc, 0x02, 0x21, 0x0f,
+  0x00, 0x03, 0x39, 0x0f, 0xfc, 0x02, 0x21, 0x0f, 0x00, 0x03, 0x39, 0x0f,
+  0xfc, 0x02, 0x21, 0x0f, 0x00, 0x03, 0x35, 0x0f, 0xfc, 0x02, 0x25, 0x0f,
+  0x00, 0x03, 0x35, 0x0f, 0xfc, 0x02, 0x25, 0x0f, 0x00, 0x03, 0x35, 0x0f,
+  0xfc, 0x02, 0x25, 0x0f, 0x00, 0x03, 0x35, 0x0f, 0xfc, 0x02, 0x25, 0x0f,
+  0x00, 0x03, 0x35, 0x0f, 0xfc, 0x02, 0x25, 0x0f, 0x00, 0x03, 0x35, 0x0f,
+  0xfc, 0x02, 0x25, 0x0f, 0x00, 0x03, 0x31, 0x0f, 0xfc, 0x02, 0x29, 0x0f,
+  0x00, 0x03, 0x31, 0x0f, 0xfc, 0x02, 0x29, 0x0f, 0x00, 0x03, 0x31, 0x0f,
+  0xfc, 0x02, 0x29, 0x0f, 0x00, 0x03, 0x31, 0x0f, 0xfc, 0x02, 0x29, 0x0f,
+  0x00, 0x03, 0x31, 0x0f, 0xfc, 0x02, 0x29, 0x0f, 0x00, 0x03, 0x31, 0x0f,
+  0xfc, 0x02, 0x29, 0x0f, 0x00, 0x48, 0x25, 0x0f, 0xfc, 0x02, 0x2d, 0x0f,
+  0x00, 0x48, 0x2d, 0x0f, 0xfc, 0x02, 0x2d, 0x0f, 0x00, 0x48, 0x2d, 0x0f,
+  0xfc, 0x02, 0x2d, 0x0f, 0x00, 0x48, 0x2d, 0x0f, 0xfc, 0x02, 0x2d, 0x0f,
+  0x00, 0x48, 0x2d, 0x0f, 0xfc, 0x02, 0x2d, 0x0f, 0x00, 0x48, 0x2d, 0x0f,
+  0xfc, 0x02, 0x2d, 0x0f, 0x00, 0x48, 0x29, 0x0f, 0xf8, 0x05, 0x31, 0x0f,
+  0x00, 0x48, 0x29, 0x0f, 0xf8, 0x05, 0x31, 0x0f, 0x00, 0x48, 0x29, 0x0f,
+  0xf8, 0x05, 0x31, 0x0f, 0x00, 0x48, 0x29, 0x0f, 0xf8, 0x05, 0x31, 0x0f,
+  0x00, 0x48, 0x29, 0x0f, 0xf8, 0x05, 0x31, 0x0f, 0x00, 0x48, 0x29, 0x0f,
+  0xf8, 0x05, 0x31, 0x0f, 0x00, 0x48, 0x25, 0x0f, 0xf4, 0x08, 0x35, 0x0f,
+  0x00, 0x09, 0x2d, 0x0f, 0xf4, 0x08, 0x2d, 0x0f, 0x00, 0x09, 0x2d, 0x0f,
+  0xf4, 0x08, 0x2d, 0x0f, 0x00, 0x09, 0x2d, 0x0f, 0xf4, 0x08, 0x2d, 0x0f,
+  0x00, 0x09, 0x2d, 0x0f, 0xf4, 0x08, 0x2d, 0x0f, 0x00, 0x09, 0x2d, 0x0f,
+  0xf4, 0x08, 0x2d, 0x0f, 0x00, 0x09, 0x05, 0x04, 0x98, 0x08, 0x0f, 0xd0,
+  0x3b, 0x19, 0x0c, 0x18, 0x00, 0x0f, 0x20, 0x3c, 0x21, 0x04, 0x00, 0x03,
+  0x04, 0x98, 0x08, 0x0f, 0xd0, 0x3b, 0x19, 0x0c, 0x18, 0x00, 0x0f, 0x20,
+  0x3c, 0x21, 0x04, 0x00, 0x03, 0x04, 0x98, 0x08, 0x0f, 0xd0, 0x3b, 0x19,
+  0x0c, 0x18, 0x00, 0x0f, 0x20, 0x3c, 0x21, 0x04, 0x00, 0x03, 0x04, 0x98,
+  0x08, 0x0f, 0xd0, 0x3b, 0x19, 0x0c, 0x18, 0x00, 0x0f, 0x20, 0x3c, 0x21,
+  0x04, 0x00, 0x03, 0x04, 0x98, 0x08, 0x0f, 0xd0, 0x3b, 0x19, 0x0c, 0x18,
+  0x00, 0x0f, 0x20, 0x3c, 0x21, 0x04, 0x00, 0x03, 0x04, 0x98, 0x08, 0x0f,
+  0xd0, 0x3b, 0x19, 0x0c, 0x18, 0x00, 0x0f, 0x20, 0x3c, 0x21, 0x04, 0x00,
+  0x03, 0x0f, 0x00, 0x5d, 0xff, 0xff, 0xed, 0x0f, 0x80, 0x01, 0x6c, 0x2f,
+  0x20, 0x29, 0x04, 0x00, 0x6b, 0x0f, 0x00, 0x04, 0x6d, 0x2f, 0x20, 0x2b,
+  0x04, 0x00, 0x6c, 0x1f, 0x25, 0x04, 0x00, 0x6b, 0x0f, 0x80, 0x03, 0x6d,
+  0xad, 0x1f, 0x2f, 0xff, 0xdd, 0x52, 0x52, 0xff, 0xeb, 0x8e, 0x79, 0x04,
+  0x00, 0x3f, 0x97, 0x25, 0x4e, 0x1c, 0x00, 0x06, 0x0f, 0x04, 0x00, 0x11,
+  0x0f, 0x40, 0x00, 0x0d, 0x04, 0x00, 0x03, 0x7d, 0xbc, 0x6b, 0x6b, 0xff,
+  0xd1, 0x9a, 0x90, 0x04, 0x00, 0x3f, 0x7e, 0x3e, 0x50, 0x1c, 0x00, 0x06,
+  0x0f, 0x04, 0x00, 0x11, 0x0f, 0x40, 0x00, 0x0d, 0x04, 0x00, 0x03, 0x7d,
+  0xd1, 0x5c, 0x5c, 0xff, 0xe2, 0x93, 0x82, 0x04, 0x00, 0x3f, 0x8e, 0x30,
+  0x4f, 0x1c, 0x00, 0x06, 0x0f, 0x04, 0x00, 0x11, 0x0f, 0x40, 0x00, 0x0d,
+  0x04, 0x00, 0x03, 0x7d, 0xc9, 0x63, 0x63, 0xff, 0xdb, 0x96, 0x88, 0x04,
+  0x00, 0x3f, 0x88, 0x36, 0x4f, 0x1c, 0x00, 0x06, 0x0f, 0x04, 0x00, 0x11,
+  0x0f, 0x40, 0x00, 0x0d, 0x04, 0x00, 0x03, 0x7d, 0xa2, 0x78, 0x78, 0xff,
+  0xbe, 0xa1, 0x9d, 0x04, 0x00, 0x3f, 0x6b, 0x49, 0x51, 0x1c, 0x00, 0x06,
+  0x0f, 0x04, 0x00, 0x11, 0x0f, 0x40, 0x00, 0x0d, 0x04, 0x00, 0x03, 0x7d,
+  0xe4, 0x4a, 0x4a, 0xff, 0xf1, 0x8b, 0x72, 0x04, 0x00, 0x3f, 0x9c, 0x1b,
+  0x4d, 0x1c, 0x00, 0x06, 0x0f, 0x04, 0x00, 0x11, 0x0f, 0x40, 0x00, 0x0d,
+  0x04, 0x00, 0x03, 0x31, 0xc5, 0x3a, 0x4d, 0xa8, 0x02, 0x0c, 0x04, 0x00,
+  0x04, 0xc0, 0x02, 0x0f, 0x04, 0x00, 0x25, 0x0f, 0x40, 0x00, 0x0d, 0x04,
+  0x00, 0x03, 0x31, 0xa6, 0x57, 0x5e, 0xa8, 0x02, 0x0c, 0x04, 0x00, 0x04,
+  0xc0, 0x02, 0x0f, 0x04, 0x00, 0x25, 0x0f, 0x40, 0x00, 0x0d, 0x04, 0x00,
+  0x03, 0x31, 0xba, 0x46, 0x54, 0xa8, 0x02, 0x0c, 0x04, 0x00, 0x04, 0xc0,
+  0x02, 0x0f, 0x04, 0x00, 0x25, 0x0f, 0x40, 0x00, 0x0d, 0x04, 0x00, 0x03,
+  0x31, 0xb3, 0x4d, 0x58, 0xa8, 0x02, 0x0c, 0x04, 0x00, 0x04, 0xc0, 0x02,
+  0x0f, 0x04, 0x00, 0x25, 0x0f, 0x40, 0x00, 0x0d, 0x04, 0x00, 0x03, 0x31,
+  0x8e, 0x64, 0x67, 0xa8, 0x02, 0x0c, 0x04, 0x00, 0x04, 0xc0, 0x02, 0x0f,
+  0x04, 0x00, 0x25, 0x0f, 0x40, 0x00, 0x0d, 0x04, 0x00, 0x03, 0x31, 0xcc,
+  0x30, 0x48, 0xa8, 0x02, 0x0c, 0x04, 0x00, 0x04, 0xc0, 0x02, 0x0f, 0x04,
+  0x00, 0x25, 0x0f, 0x40, 0x00, 0x0d, 0x0f, 0x00, 0x03, 0xff, 0xff, 0xff,
+  0x10, 0x04, 0x1c, 0x09, 0x0f, 0x04, 0x00, 0x25, 0x0f, 0x40, 0x00, 0x0d,
+  0x0f, 0x00, 0x03, 0x0d, 0x04, 0x1c, 0x09, 0x0f, 0x04, 0x00, 0x25, 0x0f,
+  0x40, 0x00, 0x0d, 0x0f, 0x00, 0x03, 0x0d, 0x04, 0x1c, 0x09, 0x0f, 0x04,
+  0x00, 0x25, 0x0f, 0x40, 0x00, 0x0d, 0x0f, 0x00, 0x03, 0x0d, 0x04, 0x1c,
+  0x09, 0x0f, 0x04, 0x00, 0x25, 0x0f, 0x40, 0x00, 0x0d, 0x0f, 0x00, 0x03,
+  0x0d, 0x04, 0x1c, 0x09, 0x0f, 0x04, 0x00, 0x25, 0x0f, 0x40, 0x00, 0x0d,
+  0x0f, 0x00, 0x03, 0x0d, 0x04, 0x1c, 0x09, 0x0f, 0x04, 0x00, 0x25, 0x0f,
+  0x40, 0x00, 0x0d, 0x04, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0xac, 0x05,
+  0x08, 0x04, 0x00, 0x08, 0xa4, 0x0e, 0x0c, 0x1c, 0x00, 0x0f, 0x04, 0x00,
+  0x11, 0x0f, 0x40, 0x00, 0x01, 0x0c, 0x14, 0x00, 0x08, 0x00, 0x0f, 0x00,
+  0xac, 0x05, 0x08, 0x04, 0x00, 0x08, 0xa4, 0x0e, 0x0c, 0x1c, 0x00, 0x0f,
+  0x04, 0x00, 0x11, 0x0f, 0x40, 0x00, 0x01, 0x0c, 0x14, 0x00, 0x08, 0x00,
+  0x0f, 0x00, 0xac, 0x05, 0x08, 0x04, 0x00, 0x08, 0xa4, 0x0e, 0x0c, 0x1c,
+  0x00, 0x0f, 0x04, 0x00, 0x11, 0x0f, 0x40, 0x00, 0x01, 0x0c, 0x14, 0x00,
+  0x08, 0x00, 0x0f, 0x00, 0xac, 0x05, 0x08, 0x04, 0x00, 0x08, 0xa4, 0x0e,
+  0x0c, 0x1c, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x0f, 0x40, 0x00, 0x01, 0x0c,
+  0x14, 0x00, 0x08, 0x00, 0x0f, 0x00, 0xac, 0x05, 0x08, 0x04, 0x00, 0x08,
+  0xa4, 0x0e, 0x0c, 0x1c, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x0f, 0x40, 0x00,
+  0x01, 0x0c, 0x14, 0x00, 0x08, 0x00, 0x0f, 0x00, 0xac, 0x05, 0x08, 0x04,
+  0x00, 0x08, 0xa4, 0x0e, 0x0c, 0x1c, 0x00, 0x0f, 0x04, 0x00, 0x11, 0x0f,
+  0x40, 0x00, 0x01, 0x0c, 0x14, 0x00, 0x04, 0x00, 0x03, 0x00, 0x8c, 0x02,
+  0x00, 0x04, 0x06, 0x0f, 0x04, 0x00, 0x11, 0x0f, 0x14, 0x09, 0x2d, 0x08,
+  0x14, 0x06, 0x04, 0x00, 0x03, 0x00, 0x8c, 0x02, 0x00, 0x04, 0x06, 0x0f,
+  0x04, 0x00, 0x11, 0x0f, 0x14, 0x09, 0x2d, 0x08, 0x14, 0x06, 0x04, 0x00,
+  0x03, 0x00, 0x8c, 0x02, 0x00, 0x04, 0x06, 0x0f, 0x04, 0x00, 0x11, 0x0f,
+  0x14, 0x09, 0x2d, 0x08, 0x14, 0x06, 0x04, 0x00, 0x03, 0x00, 0x8c, 0x02,
+  0x00, 0x04, 0x06, 0x0f, 0x04, 0x00, 0x11, 0x0f, 0x14, 0x09, 0x2d, 0x08,
+  0x14, 0x06, 0x04, 0x00, 0x03, 0x00, 0x8c, 0x02, 0x00, 0x04, 0x06, 0x0f,
+  0x04, 0x00, 0x11, 0x0f, 0x14, 0x09, 0x2d, 0x08, 0x14, 0x06, 0x04, 0x00,
+  0x03, 0x00, 0x8c, 0x02, 0x00, 0x04, 0x06, 0x0f, 0x04, 0x00, 0x11, 0x0f,
+  0x14, 0x09, 0x2d, 0x08, 0x14, 0x06, 0x0f, 0x00, 0x03, 0x61, 0x08, 0x40,
+  0x00, 0x0f, 0x00, 0x03, 0x61, 0x08, 0x40, 0x00, 0x0f, 0x00, 0x03, 0x61,
+  0x08, 0x40, 0x00, 0x0f, 0x00, 0x03, 0x61, 0x08, 0x40, 0x00, 0x0f, 0x00,
+  0x03, 0x61, 0x08, 0x40, 0x00, 0x0f, 0x00, 0x03, 0x61, 0x08, 0x40, 0x00,
+  0x0f, 0x00, 0x03, 0xff, 0xff, 0xff, 0x24, 0x0f, 0x14, 0x0f, 0x39, 0x0f,
+  0x00, 0x03, 0x21, 0x0f, 0x14, 0x0f, 0x39, 0x0f, 0x00, 0x03, 0x21, 0x0f,
+  0x14, 0x0f, 0x39, 0x0f, 0x00, 0x03, 0x21, 0x0f, 0x14, 0x0f, 0x39, 0x0f,
+  0x00, 0x03, 0x21, 0x0f, 0x14, 0x0f, 0x39, 0x0f, 0x00, 0x03, 0x21, 0x0f,
+  0x14, 0x0f, 0x39, 0x08, 0x00, 0x03, 0x0f, 0xf0, 0x0e, 0x11, 0x0f, 0x24,
+  0x00, 0x09, 0x0f, 0x40, 0x00, 0x21, 0x08, 0x00, 0x03, 0x0f, 0xf0, 0x0e,
+  0x11, 0x0f, 0x24, 0x00, 0x09, 0x0f, 0x40, 0x00, 0x21, 0x08, 0x00, 0x03,
+  0x0f, 0xf0, 0x0e, 0x11, 0x0f, 0x24, 0x00, 0x09, 0x0f, 0x40, 0x00, 0x21,
+  0x08, 0x00, 0x03, 0x0f, 0xf0, 0x0e, 0x11, 0x0f, 0x24, 0x00, 0x09, 0x0f,
+  0x40, 0x00, 0x21, 0x08, 0x00, 0x03, 0x0f, 0xf0, 0x0e, 0x11, 0x0f, 0x24,
+  0x00, 0x09, 0x0f, 0x40, 0x00, 0x21, 0x08, 0x00, 0x03, 0x0f, 0xf0, 0x0e,
+  0x11, 0x0f, 0x24, 0x00, 0x09, 0x0f, 0x40, 0x00, 0x21, 0x0c, 0x00, 0x06,
+  0x0f, 0xf0, 0x14, 0x4d, 0x0f, 0x00, 0x15, 0x05, 0x04, 0x00, 0x06, 0x0f,
+  0xf0, 0x14, 0x4d, 0x0f, 0x00, 0x15, 0x05, 0x04, 0x00, 0x06, 0x0f, 0xf0,
+  0x14, 0x4d, 0x0f, 0x00, 0x15, 0x05, 0x04, 0x00, 0x06, 0x0f, 0xf0, 0x14,
+  0x4d, 0x0f, 0x00, 0x15, 0x05, 0x04, 0x00, 0x06, 0x0f, 0xf0, 0x14, 0x4d,
+  0x0f, 0x00, 0x15, 0x05, 0x04, 0x00, 0x06, 0x0f, 0xf0, 0x14, 0x4d, 0x0f,
+  0x00, 0x15, 0x05, 0x04, 0x00, 0x03, 0x0f, 0xf0, 0x1a, 0x4d, 0x0f, 0x00,
+  0x03, 0x0d, 0x0f, 0xf0, 0x1a, 0x4d, 0x0f, 0x00, 0x03, 0x0d, 0x0f, 0xf0,
+  0x1a, 0x4d, 0x0f, 0x00, 0x03, 0x0d, 0x0f, 0xf0, 0x1a, 0x4d, 0x0f, 0x00,
+  0x03, 0x0d, 0x0f, 0xf0, 0x1a, 0x4d, 0x0f, 0x00, 0x03, 0x0d, 0x0f, 0xf0,
+  0x1a, 0x4d, 0x0f, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13,
+  0x0f, 0x00, 0x0c, 0xff, 0xff, 0xeb, 0x0f, 0x9c, 0x11, 0x02, 0x0f, 0x00,
+  0x21, 0x18, 0x0f, 0x30, 0x21, 0x21, 0x0f, 0x00, 0x12, 0x09, 0x0f, 0x00,
+  0x21, 0x1d, 0x0f, 0x30, 0x21, 0x21, 0x0f, 0x00, 0x12, 0x09, 0x0f, 0x00,
+  0x21, 0x1d, 0x0f, 0x30, 0x21, 0x21, 0x0f, 0x00, 0x12, 0x09, 0x0f, 0x00,
+  0x21, 0x1d, 0x0f, 0x30, 0x21, 0x21, 0x0f, 0x00, 0x12, 0x09, 0x0f, 0x00,
+  0x21, 0x1d, 0x0f, 0x30, 0x21, 0x21, 0x0f, 0x00, 0x12, 0x09, 0x0f, 0x00,
+  0x21, 0x1d, 0x0f, 0x30, 0x21, 0x21, 0x0f, 0x00, 0x18, 0x0d, 0x0f, 0x10,
+  0x06, 0x2d, 0x0f, 0x00, 0x2a, 0x15, 0x0f, 0x00, 0x18, 0x05, 0x0f, 0x10,
+  0x06, 0x2d, 0x0f, 0x00, 0x2a, 0x15, 0x0f, 0x00, 0x18, 0x05, 0x0f, 0x10,
+  0x06, 0x2d, 0x0f, 0x00, 0x2a, 0x15, 0x0f, 0x00, 0x18, 0x05, 0x0f, 0x10,
+  0x06, 0x2d, 0x0f, 0x00, 0x2a, 0x15, 0x0f, 0x00, 0x18, 0x05, 0x0f, 0x10,
+  0x06, 0x2d, 0x0f, 0x00, 0x2a, 0x15, 0x0f, 0x00, 0x18, 0x05, 0x0f, 0x10,
+  0x06, 0x2d, 0x0f, 0x00, 0x2a, 0x15, 0x0f, 0x00, 0x03, 0x05, 0x0f, 0x00,
+  0x2d, 0x55, 0x0f, 0x00, 0x03, 0x05, 0x0f, 0x00, 0x2d, 0x55, 0x0f, 0x00,
+  0x03, 0x05, 0x0f, 0x00, 0x2d, 0x55, 0x0f, 0x00, 0x03, 0x05, 0x0f, 0x00,
+  0x2d, 0x55, 0x0f, 0x00, 0x03, 0x05, 0x0f, 0x00, 0x2d, 0x55, 0x0f, 0x00,
+  0x03, 0x05, 0x0f, 0x00, 0x2d, 0x55, 0x0f, 0x00, 0x03, 0xff, 0xff, 0xff,
+  0x08, 0x0f, 0x00, 0x30, 0x55, 0x0f, 0x00, 0x09, 0x45, 0x0f, 0x00, 0x30,
+  0x15, 0x0f, 0x00, 0x09, 0x45, 0x0f, 0x00, 0x30, 0x15, 0x0f, 0x00, 0x09,
+  0x45, 0x0f, 0x00, 0x30, 0x15, 0x0f, 0x00, 0x09, 0x45, 0x0f, 0x00, 0x30,
+  0x15, 0x0f, 0x00, 0x09, 0x45, 0x0f, 0x00, 0x30, 0x3d, 0x0f, 0xe4, 0x0e,
+  0x19, 0x0f, 0x00, 0x30, 0x41, 0x0f, 0xe4, 0x0e, 0x19, 0x0f, 0x00, 0x30,
+  0x41, 0x0f, 0xe4, 0x0e, 0x19, 0x0f, 0x00, 0x30, 0x41, 0x0f, 0xe4, 0x0e,
+  0x19, 0x0f, 0x00, 0x30, 0x41, 0x0f, 0xe4, 0x0e, 0x19, 0x0f, 0x00, 0x30,
+  0x41, 0x0f, 0xe4, 0x0e, 0x19, 0x0f, 0x00, 0x30, 0x45, 0x0f, 0x00, 0x27,
+  0xff, 0xff, 0xc7, 0x0f, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x0f, 0x00, 0x5d, 0xff, 0xff,
+  0xeb, 0x1f, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
-unsigned int atlas192x96PngLength = 3643;
+static const unsigned int atlas192x96BlobLength = 3996;
@@ -21,19 +21,13 @@
 */
 
 /* REF: https://dev.to/javiersalcedopuyo/simple-infinite-grid-shader-5fah */
+/* REF: https://bgolus.medium.com/the-best-darn-grid-shader-yet-727f9278b9d8 */
+
+/* NOTE: `#version` 지시문과 상수 정의는 `LoadShaderVariant()`가 추가함 */
 
 /* 정점 셰이더 코드 */
 const char resShadersCommonVsVert[] = ""
 
-#ifdef PLATFORM_WEB
-"#version 300 es\n"
-"\n"
-"precision mediump float;\n"
-#else
-"#version 330\n"
-#endif
-
-"\n"
 "/* Input Variables ===================================================== */\n"
 "\n"
 "/* <===================================== [variables assigned by raylib] */\n"
@@ -59,9 +53,15 @@ const char resShadersCommonVsVert[] = ""
 "\n"
 "uniform vec3 cameraPosition;\n"
 "\n"
+"uniform float farDistance;\n"
+"\n"
+"/* NOTE: A constant folded into the variant, unless overridden at runtime */\n"
+"\n"
+"#ifdef GRID_SLICES\n"
+"const float slices = GRID_SLICES;\n"
+"#else\n"
 "uniform float slices;\n"
-"uniform float spacing;\n"
-"uniform float thick;\n"
+"#endif\n"
 "\n"
 "/* Output Variables ==================================================== */\n"
 "\n"
@@ -73,20 +73,36 @@ const char resShadersCommonVsVert[] = ""
 "\n"
 "/* [variables assigned by raylib] =====================================> */\n"
 "\n"
-"/* Private Variables ==================================================> */\n"
+"out float fragFadeDistance;\n"
 "\n"
-"vec3 planeVertexPositions[] = vec3[](\n"
-"    vec3(-0.5,  0.0,  0.5),\n"
-"    vec3( 0.5,  0.0,  0.5),\n"
-"    vec3( 0.5,  0.0, -0.5),\n"
-"    vec3(-0.5,  0.0, -0.5)\n"
+"/* Constants ==========================================================> */\n"
+"\n"
+"const vec2 planeVertexPositions[4] = vec2[4](\n"
+"    vec2(-1.0,  1.0),\n"
+"    vec2( 1.0,  1.0),\n"
+"    vec2( 1.0, -1.0),\n"
+"    vec2(-1.0, -1.0)\n"
 ");\n"
 "\n"
+"const float heightToFadeDistanceRatio = 36.0;\n"
+"\n"
 "/* GLSL Functions ====================================================== */\n"
 "\n"
 "void main() {\n"
-"    vec3 planeVertexPosition = planeVertexPositions[gl_VertexID];\n"
-"    vec3 newVertexPosition = (planeVertexPosition * spacing) * slices;\n"
+"    float fadeDistance = heightToFadeDistanceRatio * abs(cameraPosition.y);\n"
+"\n"
+"    float minFadeDistance = 0.01 * slices;\n"
+"    float maxFadeDistance = 0.32 * slices;\n"
+"\n"
+"    fadeDistance = clamp(fadeDistance, minFadeDistance, maxFadeDistance);\n"
+"\n"
+"    float halfExtent = min(fadeDistance, farDistance);\n"
+"\n"
+"    vec2 planeVertexPosition = planeVertexPositions[gl_VertexID];\n"
+"\n"
+"    vec3 newVertexPosition = vec3(planeVertexPosition.x * halfExtent,\n"
+"                                  0.0,\n"
+"                                  planeVertexPosition.y * halfExtent);\n"
 "\n"
 "    newVertexPosition.xz += cameraPosition.xz;\n"
 "\n"
@@ -94,21 +110,14 @@ const char resShadersCommonVsVert[] = ""
 "    // fragTexCoord = vertexTexCoord;\n"
 "    // fragColor = vertexColor;\n"
 "\n"
+"    fragFadeDistance = fadeDistance;\n"
+"\n"
 "    gl_Position = mvp * vec4(newVertexPosition, 1.0);\n"
 "}\n";
 
 /* 프래그먼트 셰이더 코드 */
 const char resShadersCommonFsFrag[] = ""
 
-#ifdef PLATFORM_WEB
-"#version 300 es\n"
-"\n"
-"precision mediump float;\n"
-#else
-"#version 330\n"
-#endif
-
-"\n"
 "/* Input Variables ===================================================== */\n"
 "\n"
 "/* <===================================== [variables assigned by raylib] */\n"
@@ -119,6 +128,8 @@ const char resShadersCommonFsFrag[] = ""
 "\n"
 "/* [variables assigned by raylib] ====================================> */ \n"
 "\n"
+"in float fragFadeDistance;\n"
+"\n"
 "/* Uniforms (Global Variables) ======================================== */ \n"
 "\n"
 "/* <===================================== [variables assigned by raylib] */\n"
@@ -130,9 +141,19 @@ const char resShadersCommonFsFrag[] = ""
 "\n"
 "uniform vec3 cameraPosition;\n"
 "\n"
-"uniform float slices;\n"
+"/* NOTE: Constants folded into the variant, unless overridden at runtime */\n"
+"\n"
+"#ifdef GRID_SPACING\n"
+"const float spacing = GRID_SPACING;\n"
+"#else\n"
 "uniform float spacing;\n"
-"uniform float thick;\n"
+"#endif\n"
+"\n"
+"#ifdef GRID_LINE_WIDTH\n"
+"const float lineWidth = GRID_LINE_WIDTH;\n"
+"#else\n"
+"uniform float lineWidth;\n"
+"#endif\n"
 "\n"
 "/* Output Variables ==================================================== */\n"
 "\n"
@@ -150,41 +171,107 @@ const char resShadersCommonFsFrag[] = ""
 "const vec3 redColor = vec3(0.90, 0.16, 0.21);\n"
 "const vec3 blueColor = vec3(0.0, 0.47, 0.94);\n"
 "\n"
-"const float heightToFadeDistanceRatio = 36.0;\n"
+"const float levelScale = 10.0;\n"
+"const float minCellPixels = 6.0;\n"
 "\n"
 "/* GLSL Functions ====================================================== */\n"
 "\n"
 "float ComputeAlpha() {\n"
 "    float cameraDistance = distance(cameraPosition.xz, fragPosition.xz);\n"
-"    float fadeDistance = heightToFadeDistanceRatio * abs(cameraPosition.y);\n"
 "\n"
-"    float minFadeDistance = 0.01 * slices;\n"
-"    float maxFadeDistance = 0.32 * slices;\n"
+"    return 0.9 - smoothstep(0.0, 0.9, cameraDistance / fragFadeDistance);\n"
+"}\n"
 "\n"
-"    fadeDistance = clamp(fadeDistance, minFadeDistance, maxFadeDistance);\n"
+"float ComputeLineAlpha(vec2 distanceToLine, vec2 derivative, float width) {\n"
+"    vec2 pixelDistance = distanceToLine / derivative;\n"
+"\n"
+"    float minPixelDistance = min(pixelDistance.x, pixelDistance.y);\n"
+"\n"
+"    return clamp(0.5 * width + 0.5 - minPixelDistance, 0.0, 1.0);\n"
+"}\n"
+"\n"
+"float ComputeLevelAlpha(vec2 derivative, float cellSize) {\n"
+"    vec2 cellPosition = fragPosition.xz / cellSize;\n"
+"\n"
+"    vec2 distanceToLine = abs(fract(cellPosition - 0.5) - 0.5) * cellSize;\n"
 "\n"
-"    return 0.9 - smoothstep(0.0, 0.9, cameraDistance / fadeDistance);\n"
+"    float cellPixels = cellSize / max(derivative.x, derivative.y);\n"
+"\n"
+"    float levelFade = smoothstep(minCellPixels,\n"
+"                                 levelScale * minCellPixels,\n"
+"                                 cellPixels);\n"
+"\n"
+"    return levelFade\n"
+"           * ComputeLineAlpha(distanceToLine, derivative, lineWidth);\n"
 "}\n"
 "\n"
 "void main() {\n"
-"    vec4 texelColor = texture(texture0, fragTexCoord);\n"
+"    vec2 derivative = max(fwidth(fragPosition.xz), vec2(0.000001));\n"
+"\n"
+"    float alpha = ComputeAlpha();\n"
+"\n"
+"    if (alpha <= 0.0) discard;\n"
+"\n"
+"    float lineAlpha = max(ComputeLevelAlpha(derivative, spacing),\n"
+"                          ComputeLevelAlpha(derivative,\n"
+"                                            levelScale * spacing));\n"
+"\n"
+"    lineAlpha = max(lineAlpha,\n"
+"                    ComputeLevelAlpha(derivative,\n"
+"                                      levelScale * levelScale * spacing));\n"
+"\n"
+"    vec3 color = mix(innerColor, outerColor, lineAlpha);\n"
+"\n"
+"    float redAlpha = ComputeLineAlpha(vec2(1.0e9, abs(fragPosition.z)),\n"
+"                                      derivative,\n"
+"                                      2.0 * lineWidth);\n"
+"    float blueAlpha = ComputeLineAlpha(vec2(abs(fragPosition.x), 1.0e9),\n"
+"                                       derivative,\n"
+"                                       2.0 * lineWidth);\n"
+"\n"
+"    color = mix(color, redColor, redAlpha);\n"
+"    color = mix(color, blueColor, blueAlpha);\n"
+"\n"
+"    finalColor = vec4(color, alpha);\n"
+"}\n";
+
+/* SDF 글꼴의 프래그먼트 셰이더 코드 */
+const char resShadersSdfFsFrag[] = ""
+
+"/* Input Variables ===================================================== */\n"
+"\n"
+"/* <===================================== [variables assigned by raylib] */\n"
 "\n"
-"    float inverseSpacing = 1.0 / spacing;\n"
+"in vec2 fragTexCoord;\n"
+"in vec4 fragColor;\n"
 "\n"
-"    float cellX = fract(fragPosition.x * inverseSpacing);\n"
-"    float cellZ = fract(fragPosition.z * inverseSpacing);\n"
+"/* [variables assigned by raylib] =====================================> */\n"
 "\n"
-"    float halfThick = 0.5 * thick;\n"
+"/* Uniforms (Global Variables) ========================================= */\n"
+"\n"
+"/* <===================================== [variables assigned by raylib] */\n"
+"\n"
+"uniform sampler2D texture0;\n"
+"uniform vec4 colDiffuse;\n"
+"\n"
+"/* [variables assigned by raylib] =====================================> */\n"
+"\n"
+"/* Output Variables ==================================================== */\n"
+"\n"
+"/* <===================================== [variables assigned by raylib] */\n"
+"\n"
+"out vec4 finalColor;\n"
+"\n"
+"/* [variables assigned by raylib] =====================================> */\n"
+"\n"
+"/* GLSL Functions ====================================================== */\n"
+"\n"
+"void main() {\n"
+"    float distance = texture(texture0, fragTexCoord).r;\n"
 "\n"
-"    finalColor.xyz = innerColor;\n"
+"    float smoothing = max(fwidth(distance), 0.0001);\n"
 "\n"
-"    if ((fragPosition.x < halfThick) && (fragPosition.x > -halfThick))\n"
-"        finalColor.xyz = blueColor;\n"
-"    else if ((fragPosition.z < halfThick) && (fragPosition.z > -halfThick))\n"
-"        finalColor.xyz = redColor;\n"
-"    else if (cellX < halfThick || cellX > (spacing - halfThick)\n"
-"        || cellZ < halfThick || cellZ > (spacing - halfThick))\n"
-"        finalColor.xyz = outerColor;\n"
+"    float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);\n"
 "\n"
-"    finalColor.w = ComputeAlpha();\n"
+"    finalColor = vec4(fragColor.rgb, fragColor.a * alpha) * colDiffuse;\n"
 "}\n";
@@ -0,0 +1,337 @@
+/*
+    Generated by `mvp-pack` from `res/styles/darkr-font-512x256.png`
+    (512x256, pixel format 2, 262144 -> 3887 bytes, LZ4)
+
+    DungGeunMo-v1.3.ttf (size: 16, spacing: -1)
+*/
+
+static const unsigned char darkrFontBlob[] = {
+  0x4d, 0x56, 0x50, 0x49, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x2f, 0x0f, 0x00, 0x00,
+  0x2f, 0xff, 0x00, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x00, 0x01,
+  0x00, 0x0f, 0x16, 0x00, 0x07, 0x0f, 0x1e, 0x00, 0x09, 0x0f, 0x1c, 0x00,
+  0x03, 0x0f, 0x36, 0x00, 0x07, 0x04, 0x1a, 0x00, 0x0f, 0x1c, 0x00, 0x05,
+  0x0f, 0x20, 0x00, 0x0d, 0x0f, 0x1a, 0x00, 0x05, 0x0f, 0x18, 0x00, 0x01,
+  0x0f, 0x46, 0x00, 0x0d, 0x0f, 0x66, 0x00, 0x23, 0x0f, 0x68, 0x00, 0x03,
+  0x04, 0x01, 0x00, 0x0f, 0xec, 0x00, 0x1b, 0x0f, 0x5a, 0x01, 0x07, 0x0f,
+  0x36, 0x00, 0x3b, 0x0f, 0x1c, 0x00, 0x0d, 0x0f, 0x8a, 0x01, 0x0b, 0x0f,
+  0x58, 0x00, 0x0d, 0x0f, 0x38, 0x00, 0x1d, 0x0f, 0xaa, 0x00, 0x23, 0x0f,
+  0x60, 0x01, 0x35, 0x0f, 0xae, 0x01, 0x0d, 0x0f, 0x98, 0x02, 0x0d, 0x0f,
+  0xb8, 0x00, 0x0b, 0x0f, 0x54, 0x02, 0x25, 0x0f, 0x10, 0x01, 0x25, 0x0f,
+  0xb0, 0x00, 0x09, 0x0f, 0xfe, 0x03, 0x19, 0x0f, 0x0e, 0x01, 0x09, 0x0f,
+  0x00, 0x04, 0x3b, 0x0f, 0x38, 0x00, 0x13, 0x0f, 0xae, 0x02, 0x1b, 0x0f,
+  0xdc, 0x02, 0x1f, 0x0f, 0x62, 0x03, 0x21, 0x0f, 0xba, 0x04, 0x0f, 0x0f,
+  0x68, 0x00, 0x31, 0x0f, 0x76, 0x01, 0x0b, 0x0f, 0x08, 0x03, 0x09, 0x0f,
+  0x52, 0x00, 0x23, 0x0f, 0x08, 0x01, 0x21, 0x0f, 0x20, 0x00, 0x29, 0x0f,
+  0xaa, 0x00, 0x25, 0x0f, 0x00, 0x04, 0x1f, 0x0f, 0x1e, 0x03, 0x21, 0x0f,
+  0x4e, 0x00, 0x0f, 0x0f, 0x38, 0x04, 0x0d, 0x0f, 0xae, 0x03, 0x1d, 0x0f,
+  0x10, 0x01, 0x29, 0x0f, 0xe4, 0x00, 0x23, 0x0f, 0x00, 0x04, 0x31, 0x0a,
+  0x01, 0x00, 0x0f, 0xf0, 0x00, 0x1f, 0x04, 0x06, 0x00, 0x0f, 0x00, 0x04,
+  0x61, 0x0f, 0xbc, 0x00, 0x0b, 0x0f, 0xd8, 0x00, 0x0f, 0x0f, 0x76, 0x09,
+  0x51, 0x0f, 0x9c, 0x00, 0x0d, 0x0f, 0x00, 0x04, 0x3d, 0x0f, 0xee, 0x00,
+  0x21, 0x0f, 0x1e, 0x04, 0x23, 0x0f, 0xaa, 0x00, 0x27, 0x0f, 0xca, 0x03,
+  0x33, 0x0f, 0xd4, 0x08, 0x11, 0x0f, 0x00, 0x04, 0x3d, 0x0f, 0xe4, 0x03,
+  0x2b, 0x0f, 0x2c, 0x01, 0x4d, 0x0f, 0x4a, 0x08, 0x23, 0x0f, 0x38, 0x02,
+  0x11, 0x0f, 0xca, 0x09, 0x0b, 0x0f, 0x66, 0x07, 0x35, 0x0f, 0xca, 0x07,
+  0x3f, 0x0f, 0x2c, 0x0b, 0x21, 0x0f, 0x00, 0x04, 0x51, 0x0f, 0xb2, 0x07,
+  0x2b, 0x0f, 0x00, 0x04, 0x3b, 0x0f, 0xf0, 0x0a, 0x0d, 0x0f, 0xfe, 0x01,
+  0x21, 0x0f, 0xd4, 0x02, 0x3b, 0x0f, 0x3c, 0x00, 0x41, 0x0f, 0xf0, 0x02,
+  0x0f, 0x0f, 0xe4, 0x03, 0x41, 0x0f, 0x90, 0x04, 0x1d, 0x0f, 0x2e, 0x01,
+  0x51, 0x0f, 0x38, 0x06, 0x27, 0x0f, 0x64, 0x03, 0x3d, 0x0f, 0xf4, 0x02,
+  0x3b, 0x0f, 0xe8, 0x03, 0x3f, 0x0f, 0x00, 0x01, 0x23, 0x0f, 0x5a, 0x11,
+  0x25, 0x0f, 0x88, 0x0c, 0x1d, 0x0f, 0xc8, 0x01, 0x0d, 0x0f, 0xb8, 0x0a,
+  0x21, 0x0f, 0x8c, 0x00, 0x11, 0x0f, 0x54, 0x00, 0x21, 0x0f, 0xfe, 0x03,
+  0x51, 0x0f, 0xd4, 0x00, 0x21, 0x0a, 0xd4, 0x0a, 0x0f, 0x4a, 0x0b, 0x25,
+  0x0f, 0xda, 0x02, 0x23, 0x0f, 0x00, 0x04, 0x81, 0x0f, 0x3a, 0x0e, 0x29,
+  0x08, 0x00, 0x07, 0x0f, 0x96, 0x00, 0x13, 0x0f, 0xc2, 0x0e, 0x29, 0x0f,
+  0x74, 0x15, 0x7d, 0x0f, 0x1e, 0x09, 0x0f, 0x0f, 0x74, 0x01, 0x3b, 0x0f,
+  0x46, 0x02, 0x13, 0x0f, 0xa8, 0x10, 0x25, 0x0f, 0xe0, 0x01, 0x0d, 0x0f,
+  0x72, 0x04, 0x19, 0x0f, 0x00, 0x10, 0x1b, 0x0f, 0x00, 0x08, 0x43, 0x0f,
+  0x00, 0x04, 0x29, 0x0f, 0x1c, 0x08, 0x29, 0x0f, 0x00, 0x04, 0x4d, 0x0f,
+  0x34, 0x0c, 0x27, 0x0f, 0x58, 0x16, 0x27, 0x0f, 0xd8, 0x00, 0x37, 0x0f,
+  0x00, 0x04, 0xa1, 0x0f, 0xaa, 0x07, 0x0f, 0x0f, 0x86, 0x02, 0x1d, 0x0f,
+  0xba, 0x12, 0x27, 0x0f, 0xca, 0x0b, 0x23, 0x0f, 0x56, 0x14, 0x25, 0x0f,
+  0xe0, 0x08, 0x25, 0x0f, 0x00, 0x14, 0x1d, 0x0f, 0xfa, 0x01, 0x25, 0x0f,
+  0x36, 0x14, 0x29, 0x0f, 0x00, 0x0c, 0x45, 0x0f, 0x2c, 0x11, 0x65, 0x0f,
+  0x00, 0x08, 0x27, 0x0f, 0x02, 0x06, 0x2b, 0x0f, 0x00, 0x04, 0xed, 0x0f,
+  0x20, 0x03, 0x1f, 0x0f, 0x52, 0x05, 0x2d, 0x0f, 0xf4, 0x0e, 0x2b, 0x0f,
+  0xe0, 0x00, 0x39, 0x0f, 0x62, 0x19, 0x21, 0x0f, 0x00, 0x18, 0x51, 0x0f,
+  0x7a, 0x09, 0x31, 0x0f, 0x00, 0x04, 0x3f, 0x0f, 0x02, 0x1c, 0x37, 0x0f,
+  0x00, 0x04, 0x3f, 0x0f, 0x1c, 0x02, 0x07, 0x0f, 0x76, 0x0e, 0x11, 0x0f,
+  0x02, 0x04, 0x31, 0x0f, 0xfe, 0x03, 0x9f, 0x0f, 0x00, 0x20, 0x25, 0x0f,
+  0x72, 0x1f, 0x27, 0x0f, 0x8a, 0x20, 0x27, 0x0f, 0x56, 0x20, 0x2d, 0x0f,
+  0xfc, 0x15, 0x4d, 0x0f, 0x4c, 0x04, 0x39, 0x0f, 0xd4, 0x10, 0x15, 0x0f,
+  0x4a, 0x1b, 0x29, 0x0f, 0x00, 0x20, 0x65, 0x0f, 0xe0, 0x02, 0x47, 0x0f,
+  0x82, 0x23, 0x27, 0x0f, 0xb0, 0x11, 0x4b, 0x0f, 0x00, 0x04, 0x8b, 0x0f,
+  0x52, 0x28, 0xff, 0xff, 0xb7, 0x0f, 0xe6, 0x27, 0x27, 0x0f, 0x52, 0x03,
+  0x33, 0x0f, 0x66, 0x03, 0xff, 0xff, 0xd1, 0x0f, 0x02, 0x04, 0x8d, 0x0f,
+  0x7e, 0x03, 0xff, 0xff, 0xff, 0x6a, 0x0f, 0x00, 0x04, 0xff, 0xff, 0xff,
+  0xff, 0x73, 0x0f, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xa2, 0x0f, 0xee, 0x56, 0x2b, 0x0f, 0xc6, 0x55, 0x23, 0x0f, 0x4e, 0x46,
+  0x39, 0x0f, 0x4c, 0x00, 0x13, 0x0f, 0x3a, 0x00, 0x0b, 0x0f, 0xe0, 0x00,
+  0x21, 0x0f, 0x96, 0x3d, 0x29, 0x0f, 0x38, 0x00, 0x27, 0x0f, 0x3e, 0x52,
+  0x41, 0x0f, 0x88, 0x5b, 0x3f, 0x0f, 0x4e, 0x02, 0x0b, 0x0f, 0xc2, 0x01,
+  0x1d, 0x0f, 0x44, 0x4c, 0x21, 0x0f, 0x76, 0x61, 0x23, 0x0f, 0xda, 0x59,
+  0x25, 0x0f, 0x42, 0x41, 0x5d, 0x0f, 0xa4, 0x60, 0x25, 0x0f, 0x46, 0x01,
+  0x19, 0x0f, 0x1c, 0x00, 0x15, 0x0f, 0x54, 0x5e, 0x3b, 0x0f, 0x00, 0x04,
+  0x77, 0x0f, 0x96, 0x49, 0x5d, 0x0f, 0x32, 0x4f, 0x2b, 0x0f, 0x00, 0x04,
+  0x75, 0x0f, 0xc6, 0x01, 0x11, 0x0f, 0xb4, 0x02, 0x1d, 0x0f, 0xe2, 0x42,
+  0x3f, 0x0f, 0x82, 0x02, 0x27, 0x0f, 0x82, 0x01, 0x1d, 0x0f, 0xd6, 0x02,
+  0x25, 0x0f, 0x6c, 0x60, 0x31, 0x0f, 0x00, 0x04, 0xbd, 0x0f, 0x86, 0x5a,
+  0x25, 0x0f, 0x1e, 0x4e, 0x0f, 0x0f, 0x00, 0x04, 0x79, 0x0f, 0x8c, 0x01,
+  0x1d, 0x0f, 0x00, 0x04, 0x43, 0x0f, 0x84, 0x61, 0x0f, 0x0f, 0x00, 0x04,
+  0x37, 0x0f, 0x60, 0x54, 0x41, 0x0f, 0xf6, 0x02, 0x3d, 0x0f, 0xf6, 0x61,
+  0x27, 0x0f, 0xba, 0x09, 0x23, 0x0f, 0xb2, 0x51, 0x2f, 0x0f, 0x00, 0x04,
+  0x55, 0x0f, 0x12, 0x05, 0x1f, 0x0f, 0x00, 0x04, 0x5b, 0x08, 0x52, 0x4c,
+  0x0f, 0x42, 0x06, 0x05, 0x0f, 0xe4, 0x07, 0x73, 0x0f, 0x5e, 0x4e, 0x2b,
+  0x0f, 0x22, 0x4e, 0x25, 0x0f, 0x72, 0x08, 0x3b, 0x0f, 0x52, 0x04, 0x0f,
+  0x0f, 0x00, 0x04, 0x33, 0x0f, 0x0c, 0x0f, 0x4d, 0x0f, 0x82, 0x0a, 0x3d,
+  0x0f, 0x4c, 0x66, 0x39, 0x0f, 0xf8, 0x53, 0x3b, 0x0f, 0xe2, 0x0f, 0x11,
+  0x0f, 0xfe, 0x61, 0x27, 0x0f, 0x00, 0x04, 0x37, 0x0f, 0x4a, 0x58, 0x27,
+  0x0f, 0xe2, 0x03, 0x0b, 0x0f, 0x96, 0x4d, 0x3d, 0x0f, 0x9e, 0x05, 0x29,
+  0x0f, 0x76, 0x64, 0x29, 0x0f, 0x00, 0x04, 0x57, 0x0f, 0xb8, 0x0e, 0x11,
+  0x0f, 0x6a, 0x06, 0x55, 0x0f, 0xfe, 0x03, 0x3d, 0x0f, 0x82, 0x0e, 0x45,
+  0x0f, 0xf8, 0x10, 0x25, 0x0f, 0xf8, 0x57, 0x4f, 0x0f, 0x96, 0x01, 0x2b,
+  0x0f, 0xda, 0x08, 0x3b, 0x0f, 0x00, 0x08, 0x5f, 0x0f, 0x10, 0x12, 0x07,
+  0x0f, 0xf2, 0x01, 0x47, 0x0f, 0x72, 0x01, 0x23, 0x0f, 0x00, 0x04, 0x5d,
+  0x0f, 0xc0, 0x75, 0x29, 0x0f, 0x6a, 0x0a, 0x57, 0x0f, 0x00, 0x04, 0x79,
+  0x0f, 0xf2, 0x0d, 0x3b, 0x0f, 0x00, 0x08, 0x59, 0x0f, 0x00, 0x10, 0x71,
+  0x0f, 0x38, 0x03, 0x25, 0x0f, 0x00, 0x14, 0x69, 0x0f, 0x9e, 0x01, 0x41,
+  0x0f, 0x00, 0x14, 0x55, 0x0f, 0xa4, 0x6d, 0x29, 0x0f, 0xe4, 0x07, 0x3f,
+  0x0f, 0x70, 0x69, 0x6d, 0x0f, 0xac, 0x0f, 0x2f, 0x0f, 0xec, 0x6e, 0x27,
+  0x0f, 0x7a, 0x79, 0x29, 0x0f, 0x00, 0x04, 0xd9, 0x0f, 0x00, 0x18, 0x7f,
+  0x0f, 0x46, 0x06, 0x55, 0x0f, 0x8e, 0x0f, 0x27, 0x0f, 0x62, 0x02, 0x0f,
+  0x0f, 0x00, 0x04, 0xf9, 0x0f, 0x1c, 0x08, 0x23, 0x0f, 0x38, 0x00, 0x41,
+  0x0f, 0x32, 0x00, 0x11, 0x0f, 0x00, 0x10, 0x3d, 0x0f, 0xf2, 0x7c, 0x25,
+  0x0f, 0x3c, 0x0f, 0x23, 0x0f, 0x50, 0x20, 0x3d, 0x0f, 0xe2, 0x03, 0x27,
+  0x0f, 0xd6, 0x05, 0x27, 0x0f, 0xb8, 0x1d, 0x21, 0x0f, 0x0e, 0x1e, 0x29,
+  0x0f, 0x8e, 0x0f, 0x39, 0x0f, 0x00, 0x04, 0x47, 0x0f, 0x9c, 0x1e, 0x25,
+  0x0f, 0xa8, 0x5d, 0x89, 0x0f, 0x58, 0x17, 0x1f, 0x0f, 0x3a, 0x00, 0x2d,
+  0x0f, 0x00, 0x04, 0x55, 0x0f, 0x56, 0x25, 0xff, 0x48, 0x0f, 0x14, 0x01,
+  0xff, 0x1e, 0x0f, 0xa8, 0x61, 0x9d, 0x0f, 0x8c, 0x04, 0x9f, 0x0f, 0x02,
+  0x04, 0xff, 0xff, 0x6d, 0x0f, 0x74, 0x6f, 0x59, 0x0f, 0x02, 0x00, 0xff,
+  0xff, 0xff, 0x84, 0x0f, 0xb6, 0x06, 0x21, 0x0f, 0xea, 0x06, 0xff, 0x92,
+  0x0f, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xde, 0x0f, 0x10, 0x59, 0x3f, 0x0f, 0x60, 0xb5, 0x23, 0x0f,
+  0x58, 0x5f, 0x4b, 0x0f, 0xd6, 0x45, 0x25, 0x0f, 0x9e, 0x51, 0x53, 0x0f,
+  0x8e, 0x44, 0x27, 0x0f, 0x66, 0x52, 0x29, 0x0f, 0xe0, 0x01, 0x19, 0x0f,
+  0x6a, 0x59, 0x11, 0x02, 0x0c, 0x00, 0x0f, 0x30, 0x01, 0x21, 0x0f, 0x4a,
+  0x02, 0x1d, 0x0f, 0x36, 0xbb, 0x41, 0x0f, 0xbc, 0x41, 0x2f, 0x0f, 0x64,
+  0xc1, 0x21, 0x0f, 0x26, 0x54, 0x2d, 0x0f, 0x24, 0x35, 0x2f, 0x0f, 0x00,
+  0x04, 0x3b, 0x0f, 0x20, 0x00, 0x09, 0x0f, 0x92, 0x4f, 0x17, 0x0f, 0x1c,
+  0x00, 0x57, 0x0f, 0xfc, 0x44, 0x25, 0x0f, 0x00, 0x04, 0x41, 0x0f, 0xfc,
+  0xb6, 0x23, 0x0f, 0x58, 0x4c, 0x3f, 0x0f, 0x4a, 0xbd, 0x21, 0x0f, 0xa6,
+  0x4d, 0x23, 0x0f, 0x0c, 0xa8, 0x25, 0x0f, 0xe4, 0x03, 0x67, 0x0f, 0xc4,
+  0x00, 0x0b, 0x0f, 0x2c, 0xa9, 0x3d, 0x0f, 0x86, 0x03, 0x15, 0x0f, 0x26,
+  0x39, 0x5b, 0x0f, 0xe0, 0xb1, 0x2d, 0x0f, 0x00, 0x04, 0x77, 0x0f, 0x98,
+  0x06, 0x29, 0x0f, 0x8c, 0x04, 0x41, 0x0f, 0x2c, 0x4e, 0x29, 0x0f, 0x96,
+  0x53, 0x37, 0x0f, 0x00, 0x04, 0x1d, 0x0f, 0x50, 0x01, 0x0f, 0x0f, 0x2c,
+  0x0a, 0x23, 0x0f, 0xb4, 0x06, 0x23, 0x0f, 0xbe, 0x4c, 0x41, 0x0f, 0x00,
+  0x01, 0x0f, 0x06, 0x76, 0x00, 0x0f, 0x84, 0x0a, 0x37, 0x0f, 0x00, 0x04,
+  0x0d, 0x0a, 0xc6, 0x62, 0x0f, 0xca, 0x03, 0x25, 0x0f, 0x64, 0x09, 0x1f,
+  0x0f, 0x00, 0x04, 0xb7, 0x0f, 0x9c, 0x02, 0x3d, 0x0f, 0x90, 0x5b, 0x65,
+  0x0f, 0xd8, 0x02, 0x25, 0x0f, 0x00, 0x04, 0x31, 0x0f, 0x62, 0x0a, 0x25,
+  0x0f, 0x7c, 0xc8, 0x2b, 0x0f, 0x70, 0x0b, 0x27, 0x0f, 0xf4, 0x01, 0x0d,
+  0x0f, 0x36, 0x00, 0x1f, 0x06, 0x04, 0x04, 0x0f, 0x88, 0x03, 0x01, 0x0f,
+  0xbe, 0x09, 0x2f, 0x0f, 0x78, 0x00, 0x23, 0x0f, 0x00, 0x0c, 0x4d, 0x0f,
+  0x0c, 0xb9, 0x27, 0x0f, 0x74, 0x67, 0x93, 0x0f, 0x9c, 0x02, 0x21, 0x0f,
+  0x00, 0x08, 0x7f, 0x0f, 0x6e, 0x58, 0x41, 0x0f, 0x00, 0x04, 0x3b, 0x0f,
+  0xe2, 0x03, 0x25, 0x0f, 0x3c, 0x00, 0x23, 0x0f, 0x0c, 0xd1, 0x29, 0x0f,
+  0x0e, 0x07, 0x05, 0x08, 0x7e, 0x03, 0x0f, 0xa2, 0x12, 0x23, 0x0f, 0x5e,
+  0x01, 0x21, 0x0f, 0x00, 0x04, 0x6b, 0x0f, 0xde, 0xb7, 0x29, 0x0f, 0x00,
+  0x04, 0xe3, 0x0f, 0x90, 0x57, 0x45, 0x0f, 0x20, 0x59, 0x2f, 0x0f, 0xb0,
+  0x13, 0x33, 0x0f, 0x4a, 0x09, 0x1d, 0x0f, 0xe2, 0x0b, 0x2b, 0x0f, 0x86,
+  0x64, 0x2b, 0x0f, 0xf4, 0x59, 0x3b, 0x0f, 0x88, 0x03, 0x33, 0x0f, 0x78,
+  0x08, 0x23, 0x0f, 0x00, 0x0c, 0x2b, 0x0f, 0x00, 0x08, 0x61, 0x0f, 0xb8,
+  0x11, 0x41, 0x0f, 0x00, 0x18, 0x29, 0x0f, 0x36, 0x00, 0x1b, 0x0f, 0x3a,
+  0x00, 0x45, 0x0f, 0x90, 0x57, 0x2d, 0x0f, 0x6e, 0xd7, 0x25, 0x0f, 0x00,
+  0x08, 0x4f, 0x0f, 0x02, 0x6f, 0x3d, 0x0f, 0xa0, 0x11, 0x31, 0x0f, 0x1c,
+  0x04, 0x25, 0x0f, 0x00, 0x10, 0x21, 0x0f, 0xa6, 0x17, 0x33, 0x0f, 0x00,
+  0x0c, 0x7f, 0x0f, 0xb4, 0x55, 0x75, 0x0f, 0x52, 0xcc, 0x29, 0x0f, 0x72,
+  0x00, 0x47, 0x0f, 0xc6, 0x1d, 0x7b, 0x0f, 0x00, 0x10, 0x69, 0x0f, 0xf4,
+  0x5d, 0x29, 0x0f, 0xe4, 0x13, 0x3d, 0x0f, 0xbc, 0x1e, 0x2f, 0x0f, 0x00,
+  0x18, 0x27, 0x0f, 0xf2, 0x01, 0x49, 0x0f, 0xd4, 0xd0, 0x45, 0x0f, 0x04,
+  0x7e, 0x3b, 0x0f, 0x00, 0x04, 0xb5, 0x0f, 0x9a, 0x52, 0x7f, 0x0f, 0x9a,
+  0x0f, 0x51, 0x0f, 0x00, 0x14, 0x3d, 0x0f, 0xd2, 0x08, 0x11, 0x0f, 0x54,
+  0x1f, 0x2d, 0x0f, 0x02, 0x04, 0x23, 0x0f, 0x30, 0x01, 0x21, 0x0f, 0x12,
+  0x02, 0x61, 0x0f, 0x78, 0x00, 0x2f, 0x0f, 0x4a, 0x0d, 0x27, 0x0f, 0xfa,
+  0x06, 0x9b, 0x0f, 0x46, 0x56, 0xc7, 0x0f, 0x00, 0x02, 0x2f, 0x0f, 0x00,
+  0x04, 0x4f, 0x0f, 0x98, 0x01, 0x7d, 0x0f, 0x5c, 0x1c, 0x2f, 0x0f, 0x1e,
+  0x28, 0xf5, 0x0f, 0xfe, 0x29, 0xff, 0xc4, 0x0f, 0x32, 0xc1, 0xcf, 0x0f,
+  0x8a, 0xc7, 0x3b, 0x0f, 0x00, 0x04, 0xff, 0xff, 0xab, 0x0f, 0x2e, 0x09,
+  0xdf, 0x0f, 0xa0, 0x19, 0x23, 0x0f, 0x06, 0x02, 0xe3, 0x0f, 0x7e, 0x61,
+  0xff, 0xff, 0xc1, 0x0f, 0x54, 0x64, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x28, 0x0f, 0x2e, 0xbd, 0x0d, 0x0f, 0xee, 0xad, 0x29,
+  0x0f, 0xc0, 0xff, 0x09, 0x0f, 0x48, 0x00, 0x05, 0x0f, 0x24, 0x51, 0x25,
+  0x0f, 0xf0, 0xbd, 0x1d, 0x0f, 0xa4, 0xa4, 0x25, 0x0f, 0xa0, 0x00, 0x2f,
+  0x0f, 0x8c, 0xa7, 0x0b, 0x0f, 0x8e, 0x9f, 0x39, 0x0f, 0xb4, 0xfe, 0x2d,
+  0x0f, 0xca, 0x00, 0x09, 0x0f, 0xc2, 0x49, 0x3b, 0x0f, 0xc2, 0x01, 0x0b,
+  0x0f, 0x28, 0x58, 0x29, 0x0f, 0x54, 0xad, 0x45, 0x0f, 0x50, 0x00, 0x21,
+  0x0f, 0x2e, 0x01, 0x3f, 0x0f, 0xaa, 0x3d, 0x4f, 0x0f, 0x5c, 0x56, 0x3f,
+  0x0f, 0xe2, 0x5a, 0x41, 0x0f, 0x3c, 0x02, 0x0f, 0x0f, 0xce, 0x03, 0x1d,
+  0x0f, 0xc6, 0x55, 0x3b, 0x0f, 0x30, 0x4d, 0x0b, 0x0f, 0x40, 0x5f, 0x0d,
+  0x0f, 0x84, 0x01, 0x41, 0x0f, 0xae, 0x04, 0x13, 0x0f, 0xaa, 0x04, 0x39,
+  0x0f, 0x0c, 0xab, 0x2f, 0x0f, 0x00, 0x01, 0x3b, 0x0f, 0x08, 0x60, 0x29,
+  0x0f, 0x0a, 0x07, 0x1f, 0x0f, 0x34, 0x02, 0x3b, 0x0f, 0x86, 0x01, 0x0b,
+  0x0f, 0x02, 0x04, 0x39, 0x0f, 0xc2, 0xb8, 0x3f, 0x0f, 0x0c, 0x62, 0x43,
+  0x0f, 0x5e, 0x9a, 0x25, 0x0f, 0x1a, 0x00, 0x17, 0x0f, 0x86, 0x02, 0x15,
+  0x0f, 0x30, 0x51, 0x1f, 0x0f, 0x40, 0x63, 0x0f, 0x0f, 0x14, 0x0a, 0x5f,
+  0x0f, 0x46, 0x06, 0x3b, 0x0f, 0x56, 0x04, 0x17, 0x0f, 0x90, 0x00, 0x55,
+  0x0f, 0x2a, 0xa7, 0x55, 0x0f, 0x02, 0xac, 0x2f, 0x0f, 0x12, 0x02, 0x6d,
+  0x0f, 0xee, 0xb9, 0x5b, 0x0f, 0x00, 0x04, 0x59, 0x0f, 0x1a, 0x04, 0x1b,
+  0x0f, 0x00, 0x08, 0x51, 0x0f, 0x6e, 0x61, 0x3b, 0x0f, 0x88, 0x01, 0x3f,
+  0x0f, 0x38, 0x00, 0x11, 0x0f, 0x22, 0x58, 0x25, 0x0f, 0xe0, 0x00, 0x27,
+  0x0f, 0xc0, 0xce, 0x23, 0x0f, 0x14, 0x0f, 0x13, 0x0f, 0x0e, 0x03, 0x15,
+  0x0f, 0xe6, 0xab, 0x27, 0x0f, 0x86, 0x0c, 0x2b, 0x0f, 0xc8, 0x40, 0x6d,
+  0x0f, 0xf6, 0x08, 0x1d, 0x0f, 0xa8, 0x56, 0x2b, 0x0f, 0x00, 0x04, 0x37,
+  0x0f, 0xbc, 0x08, 0x21, 0x0f, 0x00, 0x10, 0x27, 0x0f, 0x6c, 0xc0, 0x11,
+  0x0f, 0xe0, 0x63, 0x41, 0x0f, 0x40, 0x4f, 0x41, 0x0f, 0x96, 0x6f, 0x25,
+  0x0f, 0x20, 0x01, 0x2d, 0x0f, 0xe0, 0x04, 0x3b, 0x0f, 0xf8, 0xb2, 0x2b,
+  0x0f, 0x00, 0x0c, 0x33, 0x0f, 0x36, 0x00, 0x13, 0x0f, 0x2e, 0x72, 0x3d,
+  0x0f, 0x90, 0x14, 0x8f, 0x0f, 0x00, 0x10, 0x3b, 0x0f, 0xcc, 0x06, 0x29,
+  0x0f, 0xd6, 0x00, 0x3b, 0x0f, 0xfa, 0x5f, 0x21, 0x0f, 0x90, 0x0e, 0x27,
+  0x0f, 0x24, 0x6f, 0x65, 0x0f, 0x56, 0x00, 0x25, 0x0f, 0xe4, 0xc5, 0x29,
+  0x0f, 0x1c, 0x00, 0x57, 0x0f, 0x72, 0x58, 0x41, 0x0f, 0x7a, 0x0f, 0x25,
+  0x0f, 0x00, 0x04, 0x6d, 0x0f, 0xf6, 0x54, 0x41, 0x0f, 0x3a, 0x02, 0x0d,
+  0x0f, 0xf2, 0x69, 0x3b, 0x0f, 0x32, 0x08, 0x37, 0x0f, 0x00, 0x04, 0x29,
+  0x04, 0x5c, 0x00, 0x1f, 0x19, 0xe4, 0xd7, 0x44, 0x0f, 0xc4, 0xcc, 0x5f,
+  0x0f, 0x8a, 0x75, 0x27, 0x0f, 0x90, 0x17, 0x51, 0x0f, 0x00, 0x04, 0xb5,
+  0x0f, 0x30, 0x16, 0x25, 0x0f, 0xfe, 0x07, 0x9d, 0x0f, 0xca, 0x00, 0x15,
+  0x0f, 0x00, 0x14, 0x37, 0x0f, 0x00, 0x08, 0x5b, 0x0f, 0x3a, 0x13, 0x2f,
+  0x0f, 0x00, 0x04, 0xeb, 0x0f, 0xc0, 0xce, 0x47, 0x0f, 0x00, 0x04, 0x6f,
+  0x0f, 0x00, 0x18, 0x0f, 0x0f, 0x00, 0x04, 0xb7, 0x0f, 0xce, 0x18, 0x2d,
+  0x0f, 0xf0, 0x00, 0x1b, 0x0f, 0xa4, 0x64, 0x5f, 0x0f, 0xb4, 0xda, 0x43,
+  0x0f, 0x38, 0xe0, 0x27, 0x0f, 0xfc, 0xd0, 0x2b, 0x0f, 0xaa, 0xe0, 0x3f,
+  0x0f, 0x28, 0x64, 0x3d, 0x0f, 0xe4, 0x03, 0x25, 0x0f, 0x00, 0x08, 0x77,
+  0x0f, 0x12, 0x05, 0x11, 0x0f, 0x00, 0x04, 0xb5, 0x0f, 0xcc, 0x1c, 0x2f,
+  0x0f, 0xf8, 0xd8, 0x35, 0x0f, 0x1e, 0x01, 0x9b, 0x0f, 0xbc, 0x1d, 0x27,
+  0x0f, 0xe4, 0x03, 0x21, 0x0f, 0x8a, 0x84, 0x49, 0x0f, 0x1a, 0x0a, 0x3d,
+  0x0f, 0x00, 0x0c, 0xab, 0x0f, 0x0e, 0x01, 0x13, 0x0f, 0x00, 0x04, 0xb5,
+  0x0f, 0xac, 0x00, 0x31, 0x0f, 0xce, 0x0f, 0x55, 0x0f, 0x00, 0x04, 0xd1,
+  0x0f, 0x00, 0x0c, 0x5b, 0x0f, 0x1a, 0x16, 0x2f, 0x0f, 0x00, 0x04, 0xff,
+  0xff, 0x1f, 0x0f, 0x18, 0x19, 0xb3, 0x0f, 0x00, 0x04, 0xd5, 0x0f, 0x52,
+  0x8e, 0x23, 0x0f, 0x08, 0x74, 0x29, 0x0f, 0x00, 0x20, 0x39, 0x0f, 0x2e,
+  0x1d, 0x25, 0x0f, 0x00, 0x04, 0x25, 0x0f, 0xe4, 0x5c, 0xa1, 0x0f, 0x90,
+  0x07, 0x9d, 0x0f, 0x02, 0x00, 0xc9, 0x0f, 0x40, 0x06, 0x43, 0x0f, 0x96,
+  0x06, 0x7b, 0x0f, 0x70, 0x02, 0x57, 0x0f, 0x70, 0x60, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x0f, 0x08, 0x5e, 0x59, 0x0f, 0x2a,
+  0xad, 0x27, 0x0f, 0xea, 0x5d, 0x5b, 0x0f, 0x3a, 0x00, 0x09, 0x0f, 0x3a,
+  0xb4, 0x11, 0x0f, 0x1a, 0x00, 0x1b, 0x0f, 0x3c, 0x00, 0x13, 0x0f, 0x8a,
+  0x01, 0x3b, 0x0f, 0x90, 0xac, 0x15, 0x0f, 0x74, 0xa8, 0x23, 0x0f, 0xe6,
+  0x00, 0x3b, 0x0f, 0xc8, 0xb9, 0x25, 0x0f, 0x70, 0x00, 0x41, 0x0f, 0x9c,
+  0x43, 0x0f, 0x0f, 0x8e, 0x01, 0x09, 0x0f, 0x00, 0x02, 0x5b, 0x0f, 0xfe,
+  0x03, 0x2f, 0x0f, 0x08, 0x5e, 0x59, 0x0f, 0xea, 0x5d, 0x7b, 0x0f, 0x88,
+  0x00, 0x29, 0x0f, 0x64, 0xba, 0x3f, 0x0f, 0x92, 0x5f, 0x5d, 0x0f, 0xcc,
+  0x00, 0x0b, 0x0f, 0xbc, 0xab, 0x29, 0x0f, 0x2c, 0x5f, 0x45, 0x0f, 0x70,
+  0x00, 0x57, 0x0f, 0xca, 0x54, 0x13, 0x0f, 0x00, 0x02, 0x71, 0x0f, 0x16,
+  0x08, 0x31, 0x0f, 0x08, 0x5e, 0x61, 0x0f, 0xea, 0x5d, 0x8b, 0x0f, 0xcc,
+  0x67, 0x13, 0x0f, 0xa8, 0x04, 0x1d, 0x0f, 0x02, 0x5f, 0x5b, 0x0f, 0x00,
+  0x08, 0x0d, 0x0f, 0x00, 0x04, 0x13, 0x0f, 0x8e, 0x05, 0x1f, 0x0f, 0xe6,
+  0x00, 0x43, 0x0f, 0x70, 0x00, 0x59, 0x0f, 0x6e, 0x07, 0x45, 0x0f, 0x00,
+  0x02, 0x5f, 0x0f, 0x04, 0x02, 0x11, 0x0f, 0x38, 0x00, 0x23, 0x0f, 0x08,
+  0x5a, 0x2f, 0x0f, 0xca, 0x06, 0x3b, 0x0f, 0x1c, 0x04, 0x1f, 0x0f, 0xcc,
+  0x4e, 0x43, 0x0f, 0xbe, 0x0d, 0x45, 0x0f, 0x64, 0x3e, 0x43, 0x0f, 0x24,
+  0x5b, 0x25, 0x0f, 0xe6, 0x00, 0x5f, 0x0f, 0x6e, 0x00, 0x5d, 0x0f, 0x74,
+  0x40, 0x0f, 0x0f, 0x1a, 0x01, 0x93, 0x0f, 0x08, 0x5a, 0x85, 0x0f, 0x06,
+  0x57, 0xa7, 0x0f, 0x72, 0x0f, 0x2b, 0x0f, 0xe0, 0x58, 0x27, 0x0f, 0xb8,
+  0xae, 0x29, 0x0f, 0xc6, 0x08, 0x3b, 0x0f, 0xe6, 0x00, 0x41, 0x0f, 0x0e,
+  0x57, 0x13, 0x0f, 0x54, 0x01, 0x3b, 0x0f, 0x44, 0xbc, 0x3d, 0x0f, 0x1a,
+  0x01, 0x5f, 0x0f, 0x02, 0x07, 0x63, 0x0f, 0x92, 0xcb, 0x2f, 0x0f, 0x00,
+  0x04, 0xc7, 0x0f, 0xc8, 0x10, 0x29, 0x0f, 0xb6, 0x4a, 0x41, 0x0f, 0xc6,
+  0x08, 0x25, 0x0f, 0x56, 0x01, 0x7d, 0x0f, 0x52, 0x01, 0x59, 0x0f, 0x20,
+  0x59, 0x65, 0x0f, 0xee, 0x4b, 0x41, 0x0f, 0x00, 0x04, 0x61, 0x0f, 0x00,
+  0x18, 0x07, 0x0f, 0x00, 0x04, 0x99, 0x0f, 0x90, 0x05, 0x29, 0x0f, 0x1c,
+  0x00, 0x3b, 0x0f, 0x00, 0xc1, 0x25, 0x0f, 0x56, 0x00, 0x11, 0x0f, 0x40,
+  0x75, 0x25, 0x0f, 0x72, 0x01, 0x47, 0x0f, 0x00, 0x04, 0xff, 0xae, 0x0f,
+  0x90, 0x0f, 0x63, 0x0f, 0x06, 0x67, 0x43, 0x0f, 0x52, 0x0d, 0x27, 0x0f,
+  0x1c, 0x00, 0x37, 0x0f, 0x8a, 0x0d, 0x31, 0x0f, 0xca, 0x12, 0x3b, 0x0f,
+  0x94, 0x4f, 0x29, 0x0f, 0x70, 0x10, 0x25, 0x0f, 0x00, 0x04, 0xff, 0xb8,
+  0x0f, 0xea, 0x62, 0x75, 0x0f, 0x00, 0x1c, 0x41, 0x0f, 0x92, 0x57, 0xbb,
+  0x0f, 0x94, 0x57, 0x77, 0x0f, 0x74, 0x00, 0x5d, 0x0f, 0x18, 0x13, 0x41,
+  0x0f, 0x00, 0x04, 0xf1, 0x0f, 0x1c, 0x08, 0x79, 0x0f, 0x70, 0x1b, 0x45,
+  0x0f, 0xa8, 0x08, 0x47, 0x0f, 0x00, 0xe5, 0x3b, 0x0f, 0xac, 0x05, 0x13,
+  0x0f, 0xc2, 0x10, 0x5b, 0x0f, 0xf0, 0xc3, 0x43, 0x0f, 0xc4, 0x08, 0x1d,
+  0x0f, 0x50, 0x17, 0x2b, 0x0f, 0x54, 0x16, 0x5b, 0x0f, 0x00, 0x04, 0xff,
+  0x7c, 0x0f, 0x00, 0x0c, 0x41, 0x0f, 0x8e, 0x00, 0x45, 0x0f, 0x92, 0x1a,
+  0x45, 0x0f, 0xb8, 0xdb, 0x3f, 0x0f, 0x70, 0x0c, 0x41, 0x0f, 0xac, 0x1b,
+  0x61, 0x0f, 0xd2, 0xdc, 0x41, 0x0f, 0x8e, 0x23, 0x2f, 0x0f, 0xce, 0x89,
+  0x2b, 0x0f, 0x3c, 0x01, 0x6f, 0x0f, 0xc6, 0x00, 0x2d, 0x0f, 0xb4, 0x2d,
+  0x85, 0x0f, 0x02, 0x00, 0xff, 0xff, 0x53, 0x0f, 0xbc, 0x5c, 0xb3, 0x0f,
+  0xf2, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28,
+  0x0f, 0x02, 0x00, 0xff, 0xfc, 0x0f, 0x5c, 0xae, 0x2f, 0x0f, 0x90, 0x5d,
+  0x71, 0x0f, 0x56, 0x00, 0x09, 0x0f, 0x18, 0x4b, 0x13, 0x0f, 0x20, 0x30,
+  0xff, 0xff, 0xe7, 0x0f, 0x02, 0x43, 0x2d, 0x0f, 0x90, 0x5d, 0x75, 0x0f,
+  0x8c, 0x00, 0x25, 0x0f, 0x00, 0x04, 0xff, 0xff, 0xef, 0x0f, 0x38, 0x04,
+  0x2b, 0x0f, 0x04, 0x42, 0x3b, 0x0f, 0xca, 0x44, 0x33, 0x0f, 0xa8, 0x08,
+  0x17, 0x0f, 0xca, 0x03, 0xff, 0xff, 0xf9, 0x0f, 0x40, 0xaa, 0x3b, 0x0f,
+  0xa8, 0x08, 0x61, 0x0f, 0x3a, 0x00, 0x25, 0x0f, 0x00, 0x0c, 0xff, 0xff,
+  0xff, 0x10, 0x0f, 0x6c, 0x0f, 0x0d, 0x0f, 0x78, 0xb2, 0xab, 0x0f, 0x00,
+  0x10, 0xff, 0xff, 0xff, 0x46, 0x0f, 0x00, 0x04, 0xff, 0xff, 0xff, 0xd8,
+  0x0f, 0xaa, 0x57, 0x77, 0x0f, 0x00, 0x04, 0xff, 0xff, 0xff, 0x4a, 0x0f,
+  0x54, 0x00, 0x3d, 0x0f, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0x67, 0x0f,
+  0x5c, 0xda, 0x27, 0x0f, 0x00, 0x18, 0xff, 0xff, 0xeb, 0x0f, 0x00, 0x04,
+  0x79, 0x0f, 0x72, 0x0c, 0x2f, 0x0f, 0x00, 0x01, 0x57, 0x0f, 0x54, 0x1c,
+  0xff, 0xff, 0xf9, 0x0f, 0xe6, 0x5e, 0x57, 0x0f, 0x36, 0x88, 0x27, 0x0f,
+  0xfe, 0x07, 0xff, 0xff, 0xed, 0x0f, 0xcc, 0x0c, 0xc1, 0x0f, 0xdc, 0x03,
+  0x1d, 0x0f, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xcc, 0x0f, 0xfc, 0x0c, 0x5d,
+  0x0f, 0xfa, 0x03, 0xff, 0xff, 0xff, 0x68, 0x0f, 0xe0, 0x63, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0x0f, 0x02,
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xa4, 0x02, 0x01, 0x00, 0x0f, 0x00, 0x04, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xee, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+static const unsigned int darkrFontBlobLength = 3911;
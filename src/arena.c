@@ -0,0 +1,179 @@
+/*
+    Copyright (c) 2024 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ================================================================ */
+
+#include "mvp-demo.h"
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* Macro Constants ========================================================= */
+
+// clang-format off
+
+/* 프레임 단위 메모리 할당자가 반환하는 주소의 정렬 단위 */
+#define FRAME_ARENA_ALIGNMENT               16
+
+// clang-format on
+
+/* Private Variables ======================================================= */
+
+/* 프레임 단위 메모리 할당자가 사용하는 메모리 공간 */
+static unsigned char frameArenaBuffer[FRAME_ARENA_SIZE];
+
+/* 현재 프레임에서 사용 중인 메모리 공간의 크기 */
+static size_t frameArenaOffset = 0;
+
+/* 지금까지 가장 많이 사용된 메모리 공간의 크기 */
+static size_t frameArenaHighWaterMark = 0;
+
+/* 메모리 공간 부족 경고를 이미 출력했는지 여부 */
+static bool frameArenaOverflowReported = false;
+
+/* Public Functions ======================================================== */
+
+/* 프레임 단위 메모리 할당자를 초기화하는 함수 */
+void ResetFrameArena(void) {
+    frameArenaOffset = 0;
+}
+
+/* 프레임 단위 메모리 할당자로 `size` 바이트를 할당하는 함수 */
+void *AllocFrameMemory(size_t size) {
+    uintptr_t bufferAddress = (uintptr_t) frameArenaBuffer;
+
+    // 메모리 공간의 시작 주소를 기준으로 정렬된 위치 계산
+    size_t alignedOffset = (((bufferAddress + frameArenaOffset)
+                             + (FRAME_ARENA_ALIGNMENT - 1))
+                            & ~((uintptr_t) FRAME_ARENA_ALIGNMENT - 1))
+                           - bufferAddress;
+
+    if (size > FRAME_ARENA_SIZE - alignedOffset) {
+        // NOTE: 메모리 공간이 부족해도 프로그램을 종료하지 않고 `NULL`을 반환
+        if (!frameArenaOverflowReported) {
+            TraceLog(LOG_WARNING,
+                     "ARENA: Failed to allocate %u bytes (%u / %d in use)",
+                     (unsigned int) size,
+                     (unsigned int) frameArenaOffset,
+                     FRAME_ARENA_SIZE);
+
+            frameArenaOverflowReported = true;
+        }
+
+        return NULL;
+    }
+
+    frameArenaOffset = alignedOffset + size;
+
+    if (frameArenaHighWaterMark < frameArenaOffset)
+        frameArenaHighWaterMark = frameArenaOffset;
+
+    return frameArenaBuffer + alignedOffset;
+}
+
+/* 프레임 단위 메모리 할당자로 정점 `count`개를 저장할 배열을 할당하는 함수 */
+Vector3 *AllocFrameVertices(int count) {
+    if (count <= 0) return NULL;
+
+    return AllocFrameMemory(count * sizeof(Vector3));
+}
+
+/* 프레임 단위 메모리 할당자로 형식 문자열을 만드는 함수 */
+const char *FrameTextFormat(const char *text, ...) {
+    FrameStringBuilder builder = BeginFrameString(LABEL_TEXT_LENGTH * 2);
+
+    va_list args;
+
+    va_start(args, text);
+
+    AppendFrameStringV(&builder, text, args);
+
+    va_end(args);
+
+    return EndFrameString(&builder);
+}
+
+/* 프레임 단위 메모리 할당자로 최대 `capacity` 바이트의 문자열을 만들기 시작하는 함수 */
+FrameStringBuilder BeginFrameString(int capacity) {
+    FrameStringBuilder builder = { .capacity = capacity };
+
+    if (capacity > 0) builder.buffer = AllocFrameMemory(capacity);
+
+    if (builder.buffer != NULL)
+        builder.buffer[0] = '\0';
+    else
+        builder.capacity = 0;
+
+    return builder;
+}
+
+/* 만들고 있는 문자열의 끝에 형식 문자열을 덧붙이는 함수 */
+void AppendFrameString(FrameStringBuilder *builder, const char *text, ...) {
+    va_list args;
+
+    va_start(args, text);
+
+    AppendFrameStringV(builder, text, args);
+
+    va_end(args);
+}
+
+/* 만들고 있는 문자열의 끝에 형식 문자열을 덧붙이는 함수 (`va_list` 버전) */
+void AppendFrameStringV(FrameStringBuilder *builder,
+                        const char *text,
+                        va_list args) {
+    if (builder == NULL || builder->buffer == NULL || text == NULL) return;
+
+    int remaining = builder->capacity - builder->length;
+
+    if (remaining <= 1) return;
+
+    int result = vsnprintf(builder->buffer + builder->length,
+                           remaining,
+                           text,
+                           args);
+
+    if (result < 0) return;
+
+    // 문자열이 잘린 경우에는 버퍼의 끝까지만 사용
+    builder->length += (result < remaining) ? result : (remaining - 1);
+}
+
+/* 만들고 있던 문자열을 반환하는 함수 */
+const char *EndFrameString(FrameStringBuilder *builder) {
+    if (builder == NULL || builder->buffer == NULL) return "";
+
+    unsigned char *bufferEnd = (unsigned char *) builder->buffer
+                               + builder->capacity;
+
+    // 마지막으로 할당된 공간이라면, 사용하지 않은 부분을 되돌려줌
+    if (bufferEnd == frameArenaBuffer + frameArenaOffset)
+        frameArenaOffset -= (builder->capacity - (builder->length + 1));
+
+    return builder->buffer;
+}
+
+/* 프레임 단위 메모리 할당자의 최대 사용량을 반환하는 함수 */
+size_t GetFrameArenaHighWaterMark(void) {
+    return frameArenaHighWaterMark;
+}
@@ -0,0 +1,203 @@
+/*
+    Copyright (c) 2024 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ================================================================ */
+
+#include "mvp-demo.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/* Macro Constants ========================================================= */
+
+// clang-format off
+
+/* LZ4 블록 형식에서 길이 필드의 최댓값 (이 값이면 다음 바이트들을 더함) */
+#define LZ4_LENGTH_MASK                     15
+
+/* LZ4 블록 형식에서 일치하는 문자열의 최소 길이 */
+#define LZ4_MIN_MATCH_LENGTH                4
+
+/* 이미지 블롭 헤더의 크기 (바이트) */
+#define IMAGE_BLOB_HEADER_SIZE              24
+
+// clang-format on
+
+/* Private Function Prototypes ============================================= */
+
+/* LZ4 블록 형식의 가변 길이 필드를 읽는 함수 */
+static bool ReadLz4Length(const unsigned char **ip,
+                          const unsigned char *ipEnd,
+                          int *length);
+
+/* 리틀 엔디언으로 저장된 32비트 정수를 읽는 함수 */
+static unsigned int ReadUInt32LE(const unsigned char *bytes);
+
+/* Public Functions ======================================================== */
+
+/* LZ4 블록 형식으로 압축된 데이터의 압축을 해제하고, 해제된 크기를 반환하는 함수 */
+int DecompressBlobData(const unsigned char *packedData,
+                       int packedSize,
+                       unsigned char *data,
+                       int dataSize) {
+    if (packedData == NULL || packedSize <= 0 || data == NULL || dataSize < 0)
+        return -1;
+
+    const unsigned char *ip = packedData, *ipEnd = packedData + packedSize;
+
+    unsigned char *op = data, *opEnd = data + dataSize;
+
+    for (;;) {
+        if (ip >= ipEnd) return -1;
+
+        int token = *ip++;
+
+        // 그대로 복사할 문자열 (literal)의 길이
+        int literalLength = token >> 4;
+
+        if (literalLength == LZ4_LENGTH_MASK
+            && !ReadLz4Length(&ip, ipEnd, &literalLength))
+            return -1;
+
+        if (literalLength > ipEnd - ip || literalLength > opEnd - op)
+            return -1;
+
+        memcpy(op, ip, literalLength);
+
+        ip += literalLength, op += literalLength;
+
+        // NOTE: 마지막 시퀀스는 항상 문자열만으로 끝남
+        if (ip == ipEnd) break;
+
+        if (ipEnd - ip < 2) return -1;
+
+        int offset = ip[0] | (ip[1] << 8);
+
+        ip += 2;
+
+        if (offset == 0 || offset > op - data) return -1;
+
+        // 앞에서 찾은 문자열과 일치하는 부분 (match)의 길이
+        int matchLength = token & LZ4_LENGTH_MASK;
+
+        if (matchLength == LZ4_LENGTH_MASK
+            && !ReadLz4Length(&ip, ipEnd, &matchLength))
+            return -1;
+
+        matchLength += LZ4_MIN_MATCH_LENGTH;
+
+        if (matchLength > opEnd - op) return -1;
+
+        const unsigned char *match = op - offset;
+
+        // NOTE: 두 영역이 겹칠 수 있으므로, 한 바이트씩 복사
+        for (int i = 0; i < matchLength; i++)
+            op[i] = match[i];
+
+        op += matchLength;
+    }
+
+    return (int) (op - data);
+}
+
+/* 미리 디코딩한 이미지 블롭으로 이미지를 만드는 함수 */
+Image LoadImageFromBlob(const unsigned char *blob, int blobSize) {
+    Image result = { 0 };
+
+    if (blob == NULL || blobSize < IMAGE_BLOB_HEADER_SIZE) return result;
+
+    ImageBlobHeader header = { .width = ReadUInt32LE(blob + 4),
+                               .height = ReadUInt32LE(blob + 8),
+                               .format = ReadUInt32LE(blob + 12),
+                               .dataSize = ReadUInt32LE(blob + 16),
+                               .packedSize = ReadUInt32LE(blob + 20) };
+
+    memcpy(header.magic, blob, sizeof header.magic);
+
+    const unsigned char *packedData = blob + IMAGE_BLOB_HEADER_SIZE;
+
+    // NOTE: 앞에서 `blobSize`가 헤더보다 크거나 같은지 이미 확인했음
+    unsigned int packedSize = (unsigned int) (blobSize
+                                              - IMAGE_BLOB_HEADER_SIZE);
+
+    bool isHeaderValid =
+        (memcmp(header.magic, IMAGE_BLOB_MAGIC, sizeof header.magic) == 0
+         && header.width > 0 && header.width <= INT16_MAX
+         && header.height > 0 && header.height <= INT16_MAX
+         && header.format >= PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+         && header.format <= PIXELFORMAT_UNCOMPRESSED_R32G32B32A32
+         && header.packedSize == packedSize
+         && (int) header.dataSize == GetPixelDataSize(header.width,
+                                                       header.height,
+                                                       header.format));
+
+    if (!isHeaderValid) {
+        TraceLog(LOG_WARNING, "BLOB: Invalid image blob header");
+
+        return result;
+    }
+
+    unsigned char *data = RL_MALLOC(header.dataSize);
+
+    if (data == NULL) return result;
+
+    // NOTE: 이미지 디코더를 거치지 않고, 압축만 해제하여 바로 업로드할 수 있음
+    if (DecompressBlobData(packedData, header.packedSize, data, header.dataSize)
+        != (int) header.dataSize) {
+        TraceLog(LOG_WARNING, "BLOB: Failed to decompress image blob");
+
+        RL_FREE(data);
+
+        return result;
+    }
+
+    result = (Image) { .data = data,
+                       .width = header.width,
+                       .height = header.height,
+                       .mipmaps = 1,
+                       .format = header.format };
+
+    return result;
+}
+
+/* Private Functions ======================================================= */
+
+/* LZ4 블록 형식의 가변 길이 필드를 읽는 함수 */
+static bool ReadLz4Length(const unsigned char **ip,
+                          const unsigned char *ipEnd,
+                          int *length) {
+    int byte = 0;
+
+    do {
+        if (*ip >= ipEnd || *length > INT32_MAX - 255) return false;
+
+        byte = *(*ip)++, *length += byte;
+    } while (byte == 255);
+
+    return true;
+}
+
+/* 리틀 엔디언으로 저장된 32비트 정수를 읽는 함수 */
+static unsigned int ReadUInt32LE(const unsigned char *bytes) {
+    return (unsigned int) bytes[0] | ((unsigned int) bytes[1] << 8)
+           | ((unsigned int) bytes[2] << 16) | ((unsigned int) bytes[3] << 24);
+}
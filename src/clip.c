@@ -42,56 +42,34 @@ void InitClipSpace(void) {
     projMat = MatrixIdentity();
 }
 
-/* 프레임버퍼에 "클립 공간"을 그리는 함수 */
-void UpdateClipSpace(RenderTexture renderTexture) {
-    /* TODO: ... */
+/* "클립 공간"을 그리는 명령들을 기록하는 함수 */
+void RecordClipSpace(DrawCommandList *commandList) {
+    Camera *virtualCamera = GetVirtualCamera();
 
-    // 렌더 텍스처 (프레임버퍼) 초기화
-    BeginTextureMode(renderTexture);
+    commandList->camera = *virtualCamera;
 
-    {
-        ClearBackground(WHITE);
+    AddDrawCommand(commandList, (DrawCommand) { .type = DRAW_COMMAND_AXES });
 
-        {
-            Camera *virtualCamera = GetVirtualCamera();
+    for (int i = 0; i < OBJ_TYPE_COUNT_; i++) {
+        if (i == OBJ_TYPE_CAMERA) continue;
 
-            BeginMode3D(*virtualCamera);
-
-            projMat = rlGetMatrixProjection();
-
-            if (shouldUpdateProjMat) {
-                UpdateProjMatrix(false);
-
-                shouldUpdateProjMat = false;
-            }
-
-            DrawAxes();
-
-            for (int i = 0; i < OBJ_TYPE_COUNT_; i++) {
-                if (i == OBJ_TYPE_CAMERA) continue;
-
-                DrawGameObject(GetGameObject(i),
-                               renderTexture,
-                               MVP_RENDER_CLIP);
-            }
-
-            DrawInfiniteGrid(virtualCamera);
-
-            EndMode3D();
-        }
+        AddDrawCommand(commandList,
+                       (DrawCommand) { .type = DRAW_COMMAND_GAME_OBJECT,
+                                       .objectIndex = i });
+    }
 
-        DrawPlayerVertices(renderTexture, MVP_RENDER_CLIP);
+    AddDrawCommand(commandList,
+                   (DrawCommand) { .type = DRAW_COMMAND_INFINITE_GRID });
 
-        // NOTE: 알파 값이 높은 (불투명한) 물체일수록 먼저 그려야 함
-        DrawRectangleRec((Rectangle) { .width = renderTexture.texture.width,
-                                       .height = renderTexture.texture.height },
-                         ColorAlpha(DARKBLUE, 0.05f));
+    AddDrawCommand(commandList,
+                   (DrawCommand) { .type = DRAW_COMMAND_PLAYER_VERTICES });
 
-        DrawFPS(8, 8);
-    }
+    // NOTE: 알파 값이 높은 (불투명한) 물체일수록 먼저 그려야 함
+    AddDrawCommand(commandList,
+                   (DrawCommand) { .type = DRAW_COMMAND_TINT,
+                                   .color = ColorAlpha(DARKBLUE, 0.05f) });
 
-    // 기본 프레임버퍼 상태로 되돌아가기
-    EndTextureMode();
+    AddDrawCommand(commandList, (DrawCommand) { .type = DRAW_COMMAND_FPS });
 }
 
 /* "클립 공간"에 필요한 메모리 공간을 해제하는 함수 */
@@ -101,6 +79,26 @@ void DeinitClipSpace(void) {
 
 /* ========================================================================= */
 
+/* 가상 카메라로 만들어지는 "투영 행렬"을 다시 계산하는 함수 */
+void UpdateVirtualCameraProjMat(float aspect) {
+    Camera *virtualCamera = GetVirtualCamera();
+
+    /*
+        NOTE: "클립 공간"이 렌더 그래프에서 제외되어도 "투영 행렬"은 항상
+        최신 상태여야 하므로, `BeginMode3D()`와 같은 방법으로 직접 계산함
+    */
+    projMat = MatrixPerspective(virtualCamera->fovy * DEG2RAD,
+                                aspect,
+                                rlGetCullDistanceNear(),
+                                rlGetCullDistanceFar());
+
+    if (shouldUpdateProjMat) {
+        UpdateProjMatrix(false);
+
+        shouldUpdateProjMat = false;
+    }
+}
+
 /* 가상 카메라로 만들어지는 "투영 행렬"을 반환하는 함수 */
 Matrix GetVirtualCameraProjMat(bool fromGUI) {
     // GUI에서 FOV 값을 업데이트할 때마다 "투영 행렬"도 같이 업데이트
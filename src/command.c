@@ -0,0 +1,289 @@
+/*
+    Copyright (c) 2024 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ================================================================ */
+
+#include "mvp-demo.h"
+
+/* Macro Constants ========================================================= */
+
+// clang-format off
+
+/* 정렬 키에서 그리기 단계, 셰이더와 텍스처 번호가 시작하는 비트 위치 */
+#define DRAW_KEY_LAYER_SHIFT                60
+#define DRAW_KEY_SHADER_SHIFT               44
+#define DRAW_KEY_TEXTURE_SHIFT              28
+
+/* 정렬 키에 저장할 셰이더와 텍스처 번호의 마스크 */
+#define DRAW_KEY_ID_MASK                    0xFFFFULL
+
+// clang-format on
+
+/* Typedefs ================================================================ */
+
+/* 그리기 명령이 실행되는 단계 (순서대로 실행됨) */
+typedef enum DrawCommandLayer_ {
+    DRAW_LAYER_OPAQUE,   // 불투명한 3D 물체 (상태 순으로 정렬)
+    DRAW_LAYER_BLENDED,  // 반투명한 3D 물체 (기록한 순서대로)
+    DRAW_LAYER_TEXT,     // SDF 글꼴로 그리는 문자열 (기록한 순서대로)
+    DRAW_LAYER_OVERLAY,  // 2D 도형 (기록한 순서대로)
+    DRAW_LAYER_COUNT_    // (총 몇 가지?)
+} DrawCommandLayer;
+
+/* Private Variables ======================================================= */
+
+/* 각 그리기 명령이 실행되는 단계 */
+static const DrawCommandLayer drawCommandLayers[DRAW_COMMAND_COUNT_] = {
+    [DRAW_COMMAND_AXES] = DRAW_LAYER_OPAQUE,
+    [DRAW_COMMAND_GAME_OBJECT] = DRAW_LAYER_OPAQUE,
+    [DRAW_COMMAND_INFINITE_GRID] = DRAW_LAYER_BLENDED,
+    [DRAW_COMMAND_PLAYER_VERTICES] = DRAW_LAYER_TEXT,
+    [DRAW_COMMAND_CAMERA_HINT_TEXT] = DRAW_LAYER_TEXT,
+    [DRAW_COMMAND_TINT] = DRAW_LAYER_OVERLAY,
+    [DRAW_COMMAND_FPS] = DRAW_LAYER_OVERLAY
+};
+
+/* 그리기 명령 개수 초과 경고를 이미 출력했는지 여부 */
+static bool drawCommandOverflowReported = false;
+
+/* Private Function Prototypes ============================================= */
+
+/* 그리기 명령의 정렬 키를 계산하는 함수 */
+static unsigned long long ComputeDrawCommandKey(const DrawCommand *command,
+                                                int sequence);
+
+/* 정렬 키에서 그리기 단계를 꺼내는 함수 */
+static DrawCommandLayer GetDrawCommandLayer(const DrawCommand *command);
+
+/* 그리기 단계를 바꾸는 함수 */
+static void SetDrawCommandLayer(const DrawCommandList *commandList,
+                                int oldLayer,
+                                int newLayer);
+
+/* 그리기 명령 하나를 실행하는 함수 */
+static void ExecuteDrawCommand(const DrawCommandList *commandList,
+                               const DrawCommand *command,
+                               RenderTexture renderTexture);
+
+/* 그리기 명령들을 정렬 키 순으로 정렬하는 함수 */
+static void SortDrawCommands(DrawCommandList *commandList);
+
+/* Public Functions ======================================================== */
+
+/* `width` x `height` 크기의 공간을 그릴 명령 목록을 초기화하는 함수 */
+void ResetDrawCommandList(DrawCommandList *commandList,
+                          MvpRenderMode renderMode,
+                          int width,
+                          int height) {
+    if (commandList == NULL) return;
+
+    commandList->count = 0;
+
+    commandList->renderMode = renderMode;
+
+    commandList->width = width, commandList->height = height;
+
+    commandList->clearColor = WHITE;
+}
+
+/* 명령 목록에 그리기 명령을 기록하는 함수 */
+void AddDrawCommand(DrawCommandList *commandList, DrawCommand command) {
+    if (commandList == NULL || command.type < 0
+        || command.type >= DRAW_COMMAND_COUNT_)
+        return;
+
+    if (commandList->count >= DRAW_COMMAND_LIST_CAPACITY) {
+        // NOTE: 명령 목록이 가득 차도 프로그램을 종료하지 않고 명령을 무시함
+        if (!drawCommandOverflowReported) {
+            TraceLog(LOG_WARNING,
+                     "COMMAND: Too many draw commands in a single list (%d)",
+                     DRAW_COMMAND_LIST_CAPACITY);
+
+            drawCommandOverflowReported = true;
+        }
+
+        return;
+    }
+
+    // NOTE: 기록하는 동안에는 GPU 자원을 사용하지 않고, 정렬 키만 계산함
+    command.sortKey = ComputeDrawCommandKey(&command, commandList->count);
+
+    commandList->commands[commandList->count++] = command;
+}
+
+/* 기록된 그리기 명령들을 정렬한 다음, 렌더 텍스처에 그리는 함수 */
+void SubmitDrawCommandList(DrawCommandList *commandList,
+                           RenderTexture renderTexture) {
+    if (commandList == NULL) return;
+
+    SortDrawCommands(commandList);
+
+    // 렌더 텍스처 (프레임버퍼) 초기화
+    BeginTextureMode(renderTexture);
+
+    ClearBackground(commandList->clearColor);
+
+    int layer = -1;
+
+    for (int i = 0; i < commandList->count; i++) {
+        const DrawCommand *command = &commandList->commands[i];
+
+        int newLayer = GetDrawCommandLayer(command);
+
+        // NOTE: 단계가 바뀔 때만 카메라와 셰이더 프로그램을 바꿈
+        if (layer != newLayer)
+            SetDrawCommandLayer(commandList, layer, newLayer),
+            layer = newLayer;
+
+        ExecuteDrawCommand(commandList, command, renderTexture);
+    }
+
+    SetDrawCommandLayer(commandList, layer, -1);
+
+    // 기본 프레임버퍼 상태로 되돌아가기
+    EndTextureMode();
+}
+
+/* Private Functions ======================================================= */
+
+/* 그리기 명령의 정렬 키를 계산하는 함수 */
+static unsigned long long ComputeDrawCommandKey(const DrawCommand *command,
+                                                int sequence) {
+    DrawCommandLayer layer = drawCommandLayers[command->type];
+
+    unsigned long long result = ((unsigned long long) layer
+                                 << DRAW_KEY_LAYER_SHIFT);
+
+    /*
+        NOTE: 반투명한 물체와 2D 도형은 그리는 순서에 따라 결과가 달라지므로,
+        불투명한 3D 물체만 셰이더 프로그램과 텍스처 순으로 정렬함
+    */
+    if (layer == DRAW_LAYER_OPAQUE
+        && command->type == DRAW_COMMAND_GAME_OBJECT) {
+        const Model *model = &(GetGameObject(command->objectIndex)->model);
+
+        if (model->materialCount > 0) {
+            const Material *material = &model->materials[0];
+
+            unsigned int shaderId = material->shader.id;
+            unsigned int textureId =
+                material->maps[MATERIAL_MAP_DIFFUSE].texture.id;
+
+            result |= ((shaderId & DRAW_KEY_ID_MASK) << DRAW_KEY_SHADER_SHIFT)
+                      | ((textureId & DRAW_KEY_ID_MASK)
+                         << DRAW_KEY_TEXTURE_SHIFT);
+        }
+    }
+
+    // 정렬 키가 같다면, 기록한 순서대로 실행
+    return result | (unsigned long long) sequence;
+}
+
+/* 정렬 키에서 그리기 단계를 꺼내는 함수 */
+static DrawCommandLayer GetDrawCommandLayer(const DrawCommand *command) {
+    return (DrawCommandLayer) (command->sortKey >> DRAW_KEY_LAYER_SHIFT);
+}
+
+/* 그리기 단계를 바꾸는 함수 */
+static void SetDrawCommandLayer(const DrawCommandList *commandList,
+                                int oldLayer,
+                                int newLayer) {
+    bool wasMode3D = (oldLayer == DRAW_LAYER_OPAQUE
+                      || oldLayer == DRAW_LAYER_BLENDED);
+    bool isMode3D = (newLayer == DRAW_LAYER_OPAQUE
+                     || newLayer == DRAW_LAYER_BLENDED);
+
+    if (oldLayer == DRAW_LAYER_TEXT) EndSdfText();
+
+    if (wasMode3D && !isMode3D) EndMode3D();
+
+    if (!wasMode3D && isMode3D) BeginMode3D(commandList->camera);
+
+    // NOTE: 모든 문자열을 하나의 그리기 호출로 묶어서 그림
+    if (newLayer == DRAW_LAYER_TEXT) BeginSdfText();
+}
+
+/* 그리기 명령 하나를 실행하는 함수 */
+static void ExecuteDrawCommand(const DrawCommandList *commandList,
+                               const DrawCommand *command,
+                               RenderTexture renderTexture) {
+    switch (command->type) {
+        case DRAW_COMMAND_AXES:
+            DrawAxes();
+
+            break;
+
+        case DRAW_COMMAND_GAME_OBJECT:
+            DrawGameObject(GetGameObject(command->objectIndex),
+                           renderTexture,
+                           commandList->renderMode);
+
+            break;
+
+        case DRAW_COMMAND_INFINITE_GRID:
+            DrawInfiniteGrid(&commandList->camera);
+
+            break;
+
+        case DRAW_COMMAND_PLAYER_VERTICES:
+            DrawPlayerVertices(commandList->renderMode);
+
+            break;
+
+        case DRAW_COMMAND_CAMERA_HINT_TEXT:
+            DrawCameraHintText(renderTexture);
+
+            break;
+
+        case DRAW_COMMAND_TINT:
+            DrawRectangleRec((Rectangle) { .width = commandList->width,
+                                           .height = commandList->height },
+                             command->color);
+
+            break;
+
+        case DRAW_COMMAND_FPS:
+            DrawFPS(8, 8);
+
+            break;
+
+        default:
+            break;
+    }
+}
+
+/* 그리기 명령들을 정렬 키 순으로 정렬하는 함수 */
+static void SortDrawCommands(DrawCommandList *commandList) {
+    DrawCommand *commands = commandList->commands;
+
+    // NOTE: 명령 목록이 짧고 대부분 이미 정렬되어 있으므로, 삽입 정렬을 사용
+    for (int i = 1; i < commandList->count; i++) {
+        DrawCommand command = commands[i];
+
+        int j = i - 1;
+
+        for (; j >= 0 && commands[j].sortKey > command.sortKey; j--)
+            commands[j + 1] = commands[j];
+
+        commands[j + 1] = command;
+    }
+}
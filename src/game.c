@@ -33,6 +33,8 @@
 #include "images/atlas_192x96.h"
 #include "styles/raygui_style_darkr.h"
 
+#include <pthread.h>
+
 /* Macro Constants ========================================================= */
 
 // clang-format off
@@ -96,19 +98,107 @@
 #define GUI_VERTEX_SHOWN_TEXT               "Vertices: Shown"
 #define GUI_VERTEX_HIDDEN_TEXT              "Vertices: Hidden"
 
-// clang-format on
+/* ========================================================================= */
 
-/* Constants =============================================================== */
+#define GUI_TIMELINE_HINT_TEXT              "%s (Press 'P', 'K', '[', ']')"
 
-/* 게임 화면의 왼쪽 (GUI 패널) 영역 */
-static const Rectangle guiArea = { .width = 0.2f * SCREEN_WIDTH,
-                                   .height = SCREEN_HEIGHT };
+#define GUI_TIMELINE_EMPTY_TEXT             "Timeline: Empty"
+#define GUI_TIMELINE_PLAYING_TEXT           "Timeline: Playing (%.2fs / %.2fs)"
+#define GUI_TIMELINE_PAUSED_TEXT            "Timeline: Paused (%.2fs / %.2fs)"
 
-/* 게임 화면의 오른쪽 (MVP 시각화) 영역 */
-static const Rectangle mvpArea = { .x = 0.2f * SCREEN_WIDTH,
-                                   .y = 0.0f,
-                                   .width = 0.8f * SCREEN_WIDTH,
-                                   .height = SCREEN_HEIGHT };
+/* ========================================================================= */
+
+/* NOTE: 한글 글꼴 파일이 있을 때만 아래의 안내 문자열을 사용함 */
+
+#define GUI_KO_RENDER_MODE_HINT_TEXT        "%s ([0-4] 키)"
+
+#define GUI_KO_RENDER_MODE_00_TEXT          "모든 공간"
+#define GUI_KO_RENDER_MODE_01_TEXT          "로컬 공간"
+#define GUI_KO_RENDER_MODE_02_TEXT          "월드 공간"
+#define GUI_KO_RENDER_MODE_03_TEXT          "뷰 공간"
+#define GUI_KO_RENDER_MODE_04_TEXT          "클립 공간"
+
+#define GUI_KO_VERTEX_VISIBILITY_HINT_TEXT  "%s ('V' 키)"
+
+#define GUI_KO_VERTEX_SHOWN_TEXT            "정점: 보이기"
+#define GUI_KO_VERTEX_HIDDEN_TEXT           "정점: 숨기기"
+
+#define GUI_KO_TIMELINE_HINT_TEXT           "%s ('P', 'K', '[', ']' 키)"
+
+#define GUI_KO_TIMELINE_EMPTY_TEXT          "타임라인: 비어 있음"
+#define GUI_KO_TIMELINE_PLAYING_TEXT        "타임라인: 재생 중 (%.2f초 / %.2f초)"
+#define GUI_KO_TIMELINE_PAUSED_TEXT         "타임라인: 일시 정지 (%.2f초 / %.2f초)"
+
+/* 타임라인의 현재 시간을 1초에 몇 초씩 앞뒤로 옮길지 설정 */
+#define TIMELINE_SCRUB_SPEED                1.0f
+
+/* ========================================================================= */
+
+#define GUI_AREA_WIDTH                      (0.2f * SCREEN_WIDTH)
+
+#define GUI_DEFAULT_PADDING_SIZE            6.0f
+
+#define GUI_MAT_ENTRY_AREA_WIDTH            48.0f
+#define GUI_MAT_ENTRY_AREA_HEIGHT           24.0f
+
+#define GUI_LAYOUT_NODE_COUNT               128
+
+/* ========================================================================= */
+
+#define GUI_STARTUP_TEXT                    "Loading... (%d / %d)"
+
+#define GUI_STARTUP_FONT_SIZE               20
+#define GUI_STARTUP_BAR_HEIGHT              8.0f
+
+// clang-format on
+
+/* Typedefs ================================================================ */
+
+/* GUI 패널에 그릴 위젯의 종류 */
+typedef enum GuiWidgetId_ {
+    WIDGET_NONE,                         // (위젯 없음)
+    WIDGET_MODEL_MAT,                    // "모델 행렬" 패널
+    WIDGET_MODEL_MAT_RESET_BTN,          // "모델 행렬" 초기화 버튼
+    WIDGET_MODEL_MAT_ENTRY,              // "모델 행렬"의 각 요소 (16개)
+    WIDGET_MODEL_MAT_SCALE = WIDGET_MODEL_MAT_ENTRY + 16,
+    WIDGET_MODEL_MAT_SCALE_VALUE_BOX,    // (3개)
+    WIDGET_MODEL_MAT_TRANS = WIDGET_MODEL_MAT_SCALE_VALUE_BOX + 3,
+    WIDGET_MODEL_MAT_TRANS_VALUE_BOX,    // (3개)
+    WIDGET_MODEL_MAT_ROTATE = WIDGET_MODEL_MAT_TRANS_VALUE_BOX + 3,
+    WIDGET_MODEL_MAT_ROTATE_VALUE_BOX,   // (3개)
+    WIDGET_VIEW_MAT = WIDGET_MODEL_MAT_ROTATE_VALUE_BOX + 3,
+    WIDGET_VIEW_MAT_ENTRY,               // "뷰 행렬"의 각 요소 (16개)
+    WIDGET_VIEW_MAT_EYE = WIDGET_VIEW_MAT_ENTRY + 16,
+    WIDGET_VIEW_MAT_EYE_VALUE_BOX,       // (3개)
+    WIDGET_VIEW_MAT_AT = WIDGET_VIEW_MAT_EYE_VALUE_BOX + 3,
+    WIDGET_VIEW_MAT_AT_VALUE_BOX,        // (3개)
+    WIDGET_VIEW_MAT_UP = WIDGET_VIEW_MAT_AT_VALUE_BOX + 3,
+    WIDGET_VIEW_MAT_UP_VALUE_BOX,        // (3개)
+    WIDGET_PROJ_MAT = WIDGET_VIEW_MAT_UP_VALUE_BOX + 3,
+    WIDGET_PROJ_MAT_ENTRY,               // "투영 행렬"의 각 요소 (16개)
+    WIDGET_PROJ_MAT_FOV = WIDGET_PROJ_MAT_ENTRY + 16,
+    WIDGET_PROJ_MAT_FOV_MINUS_BTN,       // "FOV" 감소 버튼
+    WIDGET_PROJ_MAT_FOV_VALUE_BOX,       // "FOV" 입력 상자
+    WIDGET_PROJ_MAT_FOV_PLUS_BTN,        // "FOV" 증가 버튼
+    WIDGET_PROJ_MAT_ASPECT,              // "Aspect" 레이블
+    WIDGET_PROJ_MAT_ASPECT_VALUE_BOX,    // "Aspect" 입력 상자
+    WIDGET_PROJ_MAT_NEAR_FAR,            // "Near/Far Distance" 레이블
+    WIDGET_PROJ_MAT_NEAR_FAR_VALUE_BOX,  // (2개)
+    WIDGET_RESERVED = WIDGET_PROJ_MAT_NEAR_FAR_VALUE_BOX + 2,
+    WIDGET_COUNT_                        // (총 몇 가지?)
+} GuiWidgetId;
+
+/* 게임 화면의 초기화 단계 */
+typedef enum StartupStage_ {
+    STARTUP_STAGE_GUI_STYLE,             // GUI 스타일과 글꼴
+    STARTUP_STAGE_GUI_AREAS,             // GUI 레이아웃과 렌더 텍스처
+    STARTUP_STAGE_SHADER,                // 공용 셰이더 프로그램
+    STARTUP_STAGE_ATLAS,                 // 텍스처 아틀라스
+    STARTUP_STAGE_MODELS,                // 게임 세계의 물체 모델
+    STARTUP_STAGE_COUNT_                 // (총 몇 단계?)
+} StartupStage;
+
+/* Constants =============================================================== */
 
 /* "<물체 / 세계 / 카메라 / 클립> 공간"을 초기화하는 함수들 */
 static const InitSpaceFunc initSpaceFuncs[MVP_RENDER_COUNT_] = {
@@ -118,12 +208,19 @@ static const InitSpaceFunc initSpaceFuncs[MVP_RENDER_COUNT_] = {
     [MVP_RENDER_CLIP] = InitClipSpace
 };
 
-/* 프레임버퍼에 "<물체 / 세계 / 카메라 / 클립> 공간"을 그리는 함수들 */
-static const UpdateSpaceFunc updateSpaceFuncs[MVP_RENDER_COUNT_] = {
-    [MVP_RENDER_LOCAL] = UpdateLocalSpace,
-    [MVP_RENDER_WORLD] = UpdateWorldSpace,
-    [MVP_RENDER_VIEW] = UpdateViewSpace,
-    [MVP_RENDER_CLIP] = UpdateClipSpace
+/* "<물체 / 세계 / 카메라> 공간"의 마우스 및 키보드 입력을 처리하는 함수들 */
+static const InputSpaceFunc inputSpaceFuncs[MVP_RENDER_COUNT_] = {
+    [MVP_RENDER_LOCAL] = HandleLocalSpaceInput,
+    [MVP_RENDER_WORLD] = HandleWorldSpaceInput,
+    [MVP_RENDER_VIEW] = HandleViewSpaceInput
+};
+
+/* "<물체 / 세계 / 카메라 / 클립> 공간"을 그리는 명령들을 기록하는 함수들 */
+static const RecordSpaceFunc recordSpaceFuncs[MVP_RENDER_COUNT_] = {
+    [MVP_RENDER_LOCAL] = RecordLocalSpace,
+    [MVP_RENDER_WORLD] = RecordWorldSpace,
+    [MVP_RENDER_VIEW] = RecordViewSpace,
+    [MVP_RENDER_CLIP] = RecordClipSpace
 };
 
 /* "<물체 / 세계 / 카메라 / 클립> 공간"에 필요한 메모리 공간을 해제하는 함수들 */
@@ -153,29 +250,22 @@ static const char magicNumbers[] = { 0x04, 0x08, 0x0f, 0x10, 0x17, 0x2a,
 
 /* Private Variables ======================================================= */
 
-/* GUI 패널의 "모델 행렬" 영역 */
-static Rectangle guiModelMatArea;
+/* 게임 화면의 왼쪽 (GUI 패널) 영역 */
+static Rectangle guiArea;
 
-/* "모델 행렬"의 초기화 버튼 영역*/
-static Rectangle guiModelMatResetBtnArea;
+/* 게임 화면의 오른쪽 (MVP 시각화) 영역 */
+static Rectangle mvpArea;
 
-/* "모델 행렬"의 각 요소를 그릴 영역 */
-static Rectangle guiModelMatEntryArea[16];
+/* ========================================================================= */
 
 /* "모델 행렬"의 각 요소를 나타내는 문자열 */
 static char guiModelMatEntryText[16][MATRIX_VALUE_TEXT_LENGTH];
 
 /* ========================================================================= */
 
-/* "모델 행렬"의 크기 변환 영역 */
-static Rectangle guiModelMatScaleArea;
-
 /* "모델 행렬"의 크기 변환 레이블 영역 */
 static char guiModelMatScaleLabelText[LABEL_TEXT_LENGTH];
 
-/* "모델 행렬"의 크기 변환을 위한 입력 상자 영역 */
-static Rectangle guiModelMatScaleValueBoxArea[3];
-
 /* "모델 행렬"의 크기 변환을 위한 입력 상자의 활성화 여부 */
 static bool guiModelMatScaleValueBoxEnabled[3];
 
@@ -187,15 +277,9 @@ static float guiModelMatScaleValues[3] = { 1.0f, 1.0f, 1.0f };
 
 /* ========================================================================= */
 
-/* "모델 행렬"의 이동 변환 영역 */
-static Rectangle guiModelMatTransArea;
-
 /* "모델 행렬"의 이동 변환 레이블 영역 */
 static char guiModelMatTransLabelText[LABEL_TEXT_LENGTH];
 
-/* "모델 행렬"의 이동 변환을 위한 입력 상자 영역 */
-static Rectangle guiModelMatTransValueBoxArea[3];
-
 /* "모델 행렬"의 이동 변환을 위한 입력 상자의 활성화 여부 */
 static bool guiModelMatTransValueBoxEnabled[3];
 
@@ -207,15 +291,9 @@ static float guiModelMatTransValues[3] = { 2.0f, 0.5f, 2.0f };
 
 /* ========================================================================= */
 
-/* "모델 행렬"의 회전 변환 영역 */
-static Rectangle guiModelMatRotateArea;
-
 /* "모델 행렬"의 회전 변환 레이블 영역 */
 static char guiModelMatRotateLabelText[LABEL_TEXT_LENGTH];
 
-/* "모델 행렬"의 회전 변환을 위한 입력 상자 영역 */
-static Rectangle guiModelMatRotateValueBoxArea[3];
-
 /* "모델 행렬"의 회전 변환을 위한 입력 상자의 활성화 여부 */
 static bool guiModelMatRotateValueBoxEnabled[3];
 
@@ -227,26 +305,14 @@ static float guiModelMatRotateValues[3] = { 0.0f, 0.0f, 0.0f };
 
 /* ========================================================================= */
 
-/* GUI 패널의 "뷰 행렬" 영역 */
-static Rectangle guiViewMatArea;
-
-/* "뷰 행렬"의 각 요소를 그릴 영역 */
-static Rectangle guiViewMatEntryArea[16];
-
 /* "뷰 행렬"의 각 요소를 나타내는 문자열 */
 static char guiViewMatEntryText[16][MATRIX_VALUE_TEXT_LENGTH];
 
 /* ========================================================================= */
 
-/* "뷰 행렬"의 "EYE" 벡터 영역 */
-static Rectangle guiViewMatEyeArea;
-
 /* "뷰 행렬"의 "EYE" 벡터 레이블 영역 */
 static char guiViewMatEyeLabelText[LABEL_TEXT_LENGTH];
 
-/* "뷰 행렬"의 "EYE" 벡터를 위한 입력 상자 영역 */
-static Rectangle guiViewMatEyeValueBoxArea[3];
-
 /* "뷰 행렬"의 "EYE" 벡터를 위한 입력 상자의 활성화 여부 */
 static bool guiViewMatEyeValueBoxEnabled[3];
 
@@ -258,15 +324,9 @@ static float guiViewMatEyeValues[3] = { -3.0f, 2.25f, -0.5f };
 
 /* ========================================================================= */
 
-/* "뷰 행렬"의 "AT" 벡터 영역 */
-static Rectangle guiViewMatAtArea;
-
 /* "뷰 행렬"의 "AT" 벡터 레이블 영역 */
 static char guiViewMatAtLabelText[LABEL_TEXT_LENGTH];
 
-/* "뷰 행렬"의 "AT" 벡터를 위한 입력 상자 영역 */
-static Rectangle guiViewMatAtValueBoxArea[3];
-
 /* "뷰 행렬"의 "AT" 벡터를 위한 입력 상자의 활성화 여부 */
 static bool guiViewMatAtValueBoxEnabled[3];
 
@@ -278,15 +338,9 @@ static float guiViewMatAtValues[3] = { 0.0f, 0.0f, 0.0f };
 
 /* ========================================================================= */
 
-/* "뷰 행렬"의 "UP" 벡터 영역 */
-static Rectangle guiViewMatUpArea;
-
 /* "뷰 행렬"의 "UP" 벡터 레이블 영역 */
 static char guiViewMatUpLabelText[LABEL_TEXT_LENGTH];
 
-/* "뷰 행렬"의 "UP" 벡터를 위한 입력 상자 영역 */
-static Rectangle guiViewMatUpValueBoxArea[3];
-
 /* "뷰 행렬"의 "UP" 벡터를 위한 입력 상자의 활성화 여부 */
 static bool guiViewMatUpValueBoxEnabled[3];
 
@@ -298,52 +352,28 @@ static float guiViewMatUpValues[3] = { 0.0f, 1.0f, 0.0f };
 
 /* ========================================================================= */
 
-/* GUI 패널의 "투영 행렬" 영역 */
-static Rectangle guiProjMatArea;
-
-/* "투영 행렬"의 각 요소를 그릴 영역 */
-static Rectangle guiProjMatEntryArea[16];
-
 /* "투영 행렬"의 각 요소를 나타내는 문자열 */
 static char guiProjMatEntryText[16][MATRIX_VALUE_TEXT_LENGTH];
 
 /* ========================================================================= */
 
-/* "투영 행렬"의 "FOV" 영역 */
-static Rectangle guiProjMatFovArea;
-
 /* "투영 행렬"의 "FOV" 레이블 영역 */
 static char guiProjMatFovLabelText[LABEL_TEXT_LENGTH];
 
-/* "투영 행렬"의 "FOV" 감소 버튼을 위한 영역 */
-static Rectangle guiProjMatFovMinusBtnArea;
-
-/* "투영 행렬"의 "FOV"를 위한 입력 상자 영역 */
-static Rectangle guiProjMatFovValueBoxArea[1];
-
 /* "투영 행렬"의 "FOV"를 위한 입력 상자의 활성화 여부 */
 static bool guiProjMatFovValueBoxEnabled[1];
 
 /* "투영 행렬"의 "FOV"를 나타내는 문자열 */
 static char guiProjMatFovValueText[1][MATRIX_VALUE_TEXT_LENGTH];
 
-/* "투영 행렬"의 "FOV" 증가 버튼을 위한 영역 */
-static Rectangle guiProjMatFovPlusBtnArea;
-
 /* "투영 행렬"의 "FOV" 정보가 저장될 배열 */
 static float guiProjMatFovValues[1] = { 60.0f };
 
 /* ========================================================================= */
 
-/* "투영 행렬"의 "Aspect" 영역 */
-static Rectangle guiProjMatAspectArea;
-
 /* "투영 행렬"의 "Aspect" 레이블 영역 */
 static char guiProjMatAspectLabelText[LABEL_TEXT_LENGTH];
 
-/* "투영 행렬"의 "Aspect"를 위한 입력 상자 영역 */
-static Rectangle guiProjMatAspectValueBoxArea[1];
-
 /* "투영 행렬"의 "Aspect"를 나타내는 문자열 */
 static char guiProjMatAspectValueText[1][MATRIX_VALUE_TEXT_LENGTH];
 
@@ -352,15 +382,9 @@ static float guiProjMatAspectValues[1];
 
 /* ========================================================================= */
 
-/* "투영 행렬"의 "Near/Far Distance" 영역 */
-static Rectangle guiProjMatNearFarArea;
-
 /* "투영 행렬"의 "Near/Far Distance" 레이블 영역 */
 static char guiProjMatNearFarLabelText[LABEL_TEXT_LENGTH];
 
-/* "투영 행렬"의 "Near/Far Distance"을 위한 입력 상자 영역 */
-static Rectangle guiProjMatNearFarValueBoxArea[2];
-
 /* "투영 행렬"의 "Near/Far Distance"를 위한 입력 상자의 활성화 여부 */
 static bool guiProjMatNearFarValueBoxEnabled[2];
 
@@ -373,8 +397,40 @@ static float guiProjMatNearFarValues[2] = { CULL_DISTANCE_NEAR_MIN_VALUE,
 
 /* ========================================================================= */
 
-/* GUI 패널에서 예약된 영역 */
-static Rectangle guiReservedArea;
+/* 타임라인의 각 채널의 값이 반영될 배열 */
+static float *const timelineTargetValues[TIMELINE_CHANNEL_COUNT_] = {
+    [TIMELINE_CHANNEL_MODEL_SCALE] = guiModelMatScaleValues,
+    [TIMELINE_CHANNEL_MODEL_TRANS] = guiModelMatTransValues,
+    [TIMELINE_CHANNEL_MODEL_ROTATE] = guiModelMatRotateValues,
+    [TIMELINE_CHANNEL_VIEW_EYE] = guiViewMatEyeValues,
+    [TIMELINE_CHANNEL_VIEW_AT] = guiViewMatAtValues,
+    [TIMELINE_CHANNEL_VIEW_UP] = guiViewMatUpValues,
+    [TIMELINE_CHANNEL_PROJ_FOV] = guiProjMatFovValues,
+    [TIMELINE_CHANNEL_PROJ_NEAR_FAR] = guiProjMatNearFarValues
+};
+
+/* 타임라인의 각 채널의 값이 반영될 배열의 크기 */
+static const int timelineTargetSizes[TIMELINE_CHANNEL_COUNT_] = {
+    [TIMELINE_CHANNEL_MODEL_SCALE] = 3,
+    [TIMELINE_CHANNEL_MODEL_TRANS] = 3,
+    [TIMELINE_CHANNEL_MODEL_ROTATE] = 3,
+    [TIMELINE_CHANNEL_VIEW_EYE] = 3,
+    [TIMELINE_CHANNEL_VIEW_AT] = 3,
+    [TIMELINE_CHANNEL_VIEW_UP] = 3,
+    [TIMELINE_CHANNEL_PROJ_FOV] = 1,
+    [TIMELINE_CHANNEL_PROJ_NEAR_FAR] = 2
+};
+
+/* ========================================================================= */
+
+/* GUI 패널의 레이아웃을 구성하는 노드들 */
+static GuiLayoutNode guiLayoutNodes[GUI_LAYOUT_NODE_COUNT];
+
+/* GUI 패널의 레이아웃 */
+static GuiLayout guiLayout;
+
+/* GUI 패널에 그릴 위젯들의 영역 */
+static Rectangle guiWidgetAreas[WIDGET_COUNT_];
 
 /* ========================================================================= */
 
@@ -383,9 +439,6 @@ static GameObject gameObjects[OBJ_TYPE_COUNT_] = { { .type = OBJ_TYPE_CAMERA },
                                                    { .type = OBJ_TYPE_PLAYER },
                                                    { .type = OBJ_TYPE_ENEMY } };
 
-/* 게임 화면의 오른쪽 영역을 4개로 분할하고, 렌더 텍스처를 그림 */
-static RenderTexture renderTextures[MVP_RENDER_COUNT_];
-
 /* MVP 영역에 그릴 화면의 종류 */
 static MvpRenderMode renderMode = MVP_RENDER_ALL;
 
@@ -401,17 +454,87 @@ static float renderModeCounter = 0.0f;
 /* 플레이어 모델의 정점 표시 여부 */
 static bool showPlayerVertices = false;
 
+/* GUI 패널을 미리 그려 놓을 렌더 텍스처 */
+static RenderTexture guiAreaTexture;
+
+/* GUI 패널을 다시 그려야 하는지 여부 */
+static bool shouldRedrawGuiArea = true;
+
+/* 안내 문자열을 한글로 보여줄지 여부 (한글 글꼴 파일이 있을 때만 활성화) */
+static bool useHangulHintText = false;
+
+/* ========================================================================= */
+
+/* 게임 화면의 현재 초기화 단계 */
+static StartupStage startupStage = STARTUP_STAGE_GUI_STYLE;
+
+/* 텍스처 아틀라스 이미지를 디코딩하는 워커 스레드 */
+static pthread_t atlasDecoderThread;
+
+/* 워커 스레드가 텍스처 아틀라스 이미지를 디코딩하고 있는지 여부 */
+static bool isAtlasDecoderRunning = false;
+
+/* 워커 스레드에서 디코딩한 텍스처 아틀라스 이미지 */
+static Image atlasImage;
+
+/* 첫 번째 프레임을 그리기까지 걸린 시간 (초) */
+static double firstFrameTime = -1.0;
+
+/* 초기화가 끝난 후에 불러올 장면 스냅샷 파일의 경로 */
+static char pendingSnapshotFileName[SNAPSHOT_PATH_LENGTH];
+
 /* Private Function Prototypes ============================================= */
 
+/* GUI 레이아웃에 행렬 패널을 추가하고, 입력 상자를 추가할 노드의 번호를 반환하는 함수 */
+static int AddGuiMatrixPanel(int parent,
+                             GuiWidgetId panelId,
+                             GuiWidgetId resetBtnId,
+                             GuiWidgetId entryId);
+
+/* GUI 레이아웃에 레이블과 입력 상자 `valueBoxCount`개로 이루어진 행을 추가하는 함수 */
+static int AddGuiValueRow(int parent,
+                          GuiWidgetId labelId,
+                          const char *labelText,
+                          int valueBoxCount);
+
+/* 각 공간을 렌더 그래프의 렌더 패스로 추가하는 함수 */
+static void AddSpaceRenderPasses(void);
+
+/* 게임 화면의 다음 초기화 단계를 진행하는 함수 */
+static void AdvanceStartupStage(void);
+
+/* 타임라인의 현재 샘플을 GUI 패널의 각 값에 반영하는 함수 */
+static void ApplyTimelineSamples(void);
+
+/* 워커 스레드에서 텍스처 아틀라스 이미지를 디코딩하는 함수 */
+static void *DecodeAtlasImage(void *arg);
+
 /* 게임 화면의 왼쪽 영역을 그리는 함수 */
 static void DrawGuiArea(void);
 
+/* 렌더 텍스처에 미리 그려 놓은 GUI 패널을 그리는 함수 */
+static void DrawCachedGuiArea(void);
+
 /* MVP 영역에 그릴 화면의 종류를 표시하는 함수 */
 static void DrawRenderModeText(void);
 
+/* 행렬 값 입력 상자를 그리고, 행렬을 업데이트해야 하는지 확인하는 함수 */
+static bool DrawMatrixValueBox(Rectangle bounds,
+                               char *textValue,
+                               float *value,
+                               float minValue,
+                               float maxValue,
+                               bool *editMode);
+
 /* 게임 화면의 오른쪽 영역을 그리는 함수 */
 static void DrawMvpArea(void);
 
+/* 게임 화면을 초기화하는 동안 보여줄 화면을 그리는 함수 */
+static void DrawStartupScreen(void);
+
+/* 타임라인의 재생 상태를 보여주는 함수 */
+static void DrawTimelineText(void);
+
 /* 플레이어 모델의 정점 표시 여부를 보여주는 함수 */
 static void DrawVertexVisibilityText(void);
 
@@ -433,64 +556,97 @@ static void HandleInputEvents(void);
 /* GUI 패널에 그릴 위젯들의 영역을 정의하는 함수 */
 static void InitGuiAreas(void);
 
+/* GUI 패널의 현재 값들을 타임라인의 현재 시간에 키프레임으로 추가하는 함수 */
+static void InsertTimelineKeyframes(bool useLinear);
+
+/* `fileName` 파일의 메시로 게임 세계의 물체 모델을 바꾸는 함수 */
+static void LoadGameObjectMesh(GameObjectType type, const char *fileName);
+
 /* "모델 행렬"을 단위 행렬로 초기화하는 함수 */
 static void ResetModelMatrix(void);
 
+/* 현재 프레임의 행렬과 카메라를 업데이트 스레드에 전달하는 함수 */
+static void SubmitFrameInput(void);
+
+/* 현재 프레임에서 바뀐 GUI 패널의 값을 기록하거나, 기록된 값을 반영하는 함수 */
+static void SyncReplayValues(void);
+
+/* 값이 바뀐 채널에 해당하는 행렬들만 업데이트하는 함수 */
+static void UpdateChannelMatrices(const bool *isChannelChanged);
+
+/* 게임 창의 크기에 맞게 각 영역과 렌더 텍스처를 다시 계산하는 함수 */
+static void UpdateGameAreas(void);
+
 /* 행렬의 각 요소를 나타내는 문자열을 업데이트하는 함수 */
 static void UpdateMatrixEntryText(char (*matEntryText)[16], Matrix matrix);
 
+/* 초기화 단계를 진행하고, 그 동안 보여줄 화면을 그리는 함수 */
+static void UpdateStartupScreen(void);
+
 /* Public Functions ======================================================== */
 
 /* 게임 화면을 초기화하는 함수 */
 void InitGameScreen(void) {
-    {
-        GuiLoadStyleDarkr();
+    /*
+        NOTE: GPU에 올려야 하는 자원은 첫 번째 프레임부터 한 단계씩 나누어
+        준비하고, 그 동안 텍스처 아틀라스 이미지는 워커 스레드에서 디코딩함
+    */
 
-        InitGuiAreas();
-    }
+    startupStage = STARTUP_STAGE_GUI_STYLE;
 
-    shaderProgram = LoadCommonShader();
+    // 워커 스레드를 만들 수 없다면, 아틀라스 단계에서 직접 디코딩
+    isAtlasDecoderRunning = (pthread_create(&atlasDecoderThread,
+                                            NULL,
+                                            DecodeAtlasImage,
+                                            NULL)
+                             == 0);
 
-    {
-        /* 모델 생성을 위한 텍스처 아틀라스 준비 */
+    InitJobSystem(), InitUpdateThread();
+}
 
-        Image atlasImage = LoadImageFromMemory(".png",
-                                               atlas192x96Png,
-                                               atlas192x96PngLength);
+/* 게임 화면을 그리고 게임 상태를 업데이트하는 함수 */
+void UpdateGameScreen(void) {
+    // 이전 프레임에서 사용한 임시 메모리 공간 초기화
+    ResetFrameArena();
 
-        textureAtlas = LoadTextureFromImage(atlasImage);
+    // 초기화가 아직 끝나지 않았다면, 다음 단계를 진행하고 로딩 화면만 그림
+    if (startupStage < STARTUP_STAGE_COUNT_) {
+        UpdateStartupScreen();
 
-        UnloadImage(atlasImage);
+        return;
     }
 
-    {
-        /* 게임 세계에 플레이어와 카메라 등의 모델 추가 */
+    // 입력을 기록하거나, 기록된 입력 재생
+    UpdateReplay();
 
-        for (int i = 0; i < OBJ_TYPE_COUNT_; i++) {
-            if (i == OBJ_TYPE_CAMERA)
-                gameObjects[i].model = GenerateCameraModel();
-            else if (i == OBJ_TYPE_PLAYER)
-                gameObjects[i].model = GeneratePlayerModel();
-            else
-                gameObjects[i].model = GenerateEnemyModel();
-        }
-    }
+    // 게임 창의 크기가 바뀌었다면, 각 영역과 렌더 텍스처를 다시 계산
+    if (IsWindowResized()) UpdateGameAreas(), UpdateProjMatrix(true);
 
-    UpdateModelMatrix(true), UpdateViewMatrix(true), UpdateProjMatrix(true);
+    // 오랫동안 사용되지 않은 렌더 텍스처 해제
+    TrimRenderTexturePool();
 
-    for (int i = MVP_RENDER_ALL + 1; i < MVP_RENDER_COUNT_; i++) {
-        if (initSpaceFuncs[i] == NULL) continue;
+    // 마우스 및 키보드 입력 처리
+    HandleInputEvents();
 
-        renderTextures[i] = LoadRenderTexture(mvpArea.width, mvpArea.height);
+    // NOTE: 관찰자 카메라를 먼저 움직여야 스냅샷이 같은 프레임의 카메라를 사용함
+    for (int i = MVP_RENDER_ALL + 1; i < MVP_RENDER_COUNT_; i++)
+        if (inputSpaceFuncs[i] != NULL) inputSpaceFuncs[i]();
 
-        initSpaceFuncs[i]();
-    }
-}
+    // 타임라인의 시간이 바뀌었다면, 그 시간의 샘플을 각 행렬에 반영
+    if (UpdateTimeline(GetReplayFrameTime())) ApplyTimelineSamples();
 
-/* 게임 화면을 그리고 게임 상태를 업데이트하는 함수 */
-void UpdateGameScreen(void) {
-    // 마우스 및 키보드 입력 처리
-    HandleInputEvents();
+    // NOTE: MVP 영역에 어떤 공간을 그리든, "투영 행렬"은 매 프레임마다 다시 계산
+    UpdateVirtualCameraProjMat(mvpArea.width / mvpArea.height);
+
+    // 바뀐 노드들의 "세계 행렬"만 다시 계산하여 각 물체의 모델에 반영
+    UpdateSceneGraph();
+
+    for (int i = 0; i < OBJ_TYPE_COUNT_; i++)
+        gameObjects[i].model.transform = GetSceneNodeWorldMat(
+            gameObjects[i].sceneNode);
+
+    // 정점 변환과 좌표 문자열 배치는 업데이트 스레드에 맡기고, 현재 프레임의 결과를 그림
+    SubmitFrameInput(), AcquireFrameSnapshot();
 
     // 프레임버퍼 초기화
     BeginDrawing();
@@ -498,35 +654,71 @@ void UpdateGameScreen(void) {
     {
         ClearBackground(RAYWHITE);
 
-        DrawMvpArea(), DrawGuiArea();
+        DrawMvpArea(), DrawCachedGuiArea();
 
         DrawRenderModeText(), DrawVertexVisibilityText();
+
+        DrawTimelineText();
+
+        /*
+            NOTE: 위에서 그린 글리프들은 `EndDrawing()`에서 한 번에 그려지므로,
+            그 전에 이번 프레임에 새로 추가된 글리프들을 한 번에 업로드
+        */
+        UpdateGlyphCache();
     }
 
     // 이중 버퍼링 (double buffering) 기법으로 프레임버퍼 교체
     EndDrawing();
+
+    // 현재 프레임에서 바뀐 GUI 패널의 값 기록 또는 재생
+    SyncReplayValues();
 }
 
 /* 게임 화면에 필요한 메모리 공간을 해제하는 함수 */
 void DeinitGameScreen(void) {
+    // NOTE: 초기화가 끝나기 전에 게임 창이 닫힐 수도 있음
+    if (isAtlasDecoderRunning)
+        pthread_join(atlasDecoderThread, NULL), isAtlasDecoderRunning = false;
+
+    // NOTE: 업데이트 스레드가 글꼴을 사용하므로, 글꼴보다 먼저 종료해야 함
+    DeinitUpdateThread(), DeinitJobSystem();
+
+    UnloadImage(atlasImage), atlasImage = (Image) { 0 };
+
     UnloadFont(GuiGetFont());
 
-    UnloadShader(shaderProgram);
+    UnloadGlyphCache();
+
+    UnloadSdfFont();
+
+    UnloadShaderVariant(shaderProgram);
 
     UnloadTexture(textureAtlas);
 
     {
-        for (int i = 0; i < OBJ_TYPE_COUNT_; i++)
-            UnloadModel(gameObjects[i].model);
+        for (int i = 0; i < OBJ_TYPE_COUNT_; i++) {
+            if (gameObjects[i].isModelCached)
+                UnloadCachedModel(gameObjects[i].model);
+            else
+                UnloadModel(gameObjects[i].model);
+        }
+
+        UnloadMeshCache();
+
+        ResetSceneGraph();
     }
 
     for (int i = MVP_RENDER_ALL + 1; i < MVP_RENDER_COUNT_; i++) {
         if (deinitSpaceFuncs[i] == NULL) continue;
 
-        UnloadRenderTexture(renderTextures[i]);
-
         deinitSpaceFuncs[i]();
     }
+
+    ResetRenderGraph();
+
+    ReleaseRenderTexture(guiAreaTexture);
+
+    UnloadRenderTexturePool();
 }
 
 /* ========================================================================= */
@@ -571,37 +763,153 @@ bool IsVertexVisibilityModeEnabled(void) {
     return showPlayerVertices;
 }
 
+/* `fileName` 파일의 장면 스냅샷으로 게임 상태를 되돌리는 함수 */
+bool LoadGameSnapshot(const char *fileName) {
+    // 초기화가 끝나지 않았다면, 파일 경로만 기억해 두었다가 나중에 불러옴
+    if (startupStage < STARTUP_STAGE_COUNT_) {
+        if (fileName == NULL || !FileExists(fileName)) return false;
+
+        strncpy(pendingSnapshotFileName,
+                fileName,
+                SNAPSHOT_PATH_LENGTH - 1);
+
+        return true;
+    }
+
+    SceneSnapshot snapshot;
+
+    if (!ReadSceneSnapshot(fileName, &snapshot)) return false;
+
+    for (int i = 0; i < TIMELINE_CHANNEL_COUNT_; i++)
+        memcpy(timelineTargetValues[i],
+               snapshot.guiValues[i],
+               timelineTargetSizes[i] * sizeof *(timelineTargetValues[i]));
+
+    *GetVirtualCamera() = snapshot.virtualCamera;
+
+    *GetLocalObserverCamera() = snapshot.observerCameras[MVP_RENDER_LOCAL];
+    *GetWorldObserverCamera() = snapshot.observerCameras[MVP_RENDER_WORLD];
+    *GetViewObserverCamera() = snapshot.observerCameras[MVP_RENDER_VIEW];
+
+    if (snapshot.renderMode >= MVP_RENDER_ALL
+        && snapshot.renderMode < MVP_RENDER_COUNT_)
+        renderMode = snapshot.renderMode, renderModeCounter = 0.0f;
+
+    showPlayerVertices = snapshot.showPlayerVertices;
+
+    for (int i = 0; i < OBJ_TYPE_COUNT_; i++) {
+        snapshot.meshPaths[i][SNAPSHOT_PATH_LENGTH - 1] = '\0';
+
+        // NOTE: 이미 불러온 메시 파일은 메시 캐시에서 바로 가져옴
+        if (snapshot.meshPaths[i][0] != '\0') {
+            LoadGameObjectMesh(i, snapshot.meshPaths[i]);
+        } else if (gameObjects[i].isModelCached) {
+            // 메시 파일을 사용하지 않는 스냅샷이라면, 정육면체 모델로 되돌림
+            UnloadCachedModel(gameObjects[i].model);
+
+            gameObjects[i].model = (i == OBJ_TYPE_PLAYER)
+                                       ? GeneratePlayerModel()
+                                       : GenerateEnemyModel();
+
+            gameObjects[i].isModelCached = false;
+        }
+
+        SetSceneNodeLocalMat(gameObjects[i].sceneNode,
+                             snapshot.objectTransforms[i]);
+    }
+
+    UpdateModelMatrix(true), UpdateViewMatrix(true), UpdateProjMatrix(true);
+
+    TraceLog(LOG_INFO, "SNAPSHOT: Loaded '%s'", fileName);
+
+    return true;
+}
+
+/* `fileName` 파일에 현재 게임 상태를 장면 스냅샷으로 저장하는 함수 */
+bool SaveGameSnapshot(const char *fileName) {
+    SceneSnapshot snapshot;
+
+    // NOTE: 구조체를 그대로 저장하므로, 패딩 (padding)까지 초기화
+    memset(&snapshot, 0, sizeof snapshot);
+
+    for (int i = 0; i < TIMELINE_CHANNEL_COUNT_; i++)
+        memcpy(snapshot.guiValues[i],
+               timelineTargetValues[i],
+               timelineTargetSizes[i] * sizeof *(timelineTargetValues[i]));
+
+    snapshot.virtualCamera = *GetVirtualCamera();
+
+    snapshot.observerCameras[MVP_RENDER_LOCAL] = *GetLocalObserverCamera();
+    snapshot.observerCameras[MVP_RENDER_WORLD] = *GetWorldObserverCamera();
+    snapshot.observerCameras[MVP_RENDER_VIEW] = *GetViewObserverCamera();
+
+    snapshot.renderMode = renderMode;
+
+    snapshot.showPlayerVertices = showPlayerVertices;
+
+    for (int i = 0; i < OBJ_TYPE_COUNT_; i++) {
+        // NOTE: 모든 물체가 루트 노드이므로, "세계 행렬"이 곧 "로컬 행렬"임
+        snapshot.objectTransforms[i] = GetSceneNodeWorldMat(
+            gameObjects[i].sceneNode);
+
+        const char *meshPath = gameObjects[i].isModelCached
+                                   ? GetCachedModelFileName(
+                                         gameObjects[i].model)
+                                   : NULL;
+
+        if (meshPath != NULL)
+            strncpy(snapshot.meshPaths[i], meshPath, SNAPSHOT_PATH_LENGTH - 1);
+    }
+
+    bool result = WriteSceneSnapshot(fileName, &snapshot);
+
+    if (result) TraceLog(LOG_INFO, "SNAPSHOT: Saved '%s'", fileName);
+
+    return result;
+}
+
 /* "모델 행렬"을 업데이트하는 함수 */
 void UpdateModelMatrix(bool fromGUI) {
+    int sceneNode = gameObjects[OBJ_TYPE_PLAYER].sceneNode;
+
     if (fromGUI) {
-        Matrix scaleMat = MatrixScale(guiModelMatScaleValues[0],
-                                      guiModelMatScaleValues[1],
-                                      guiModelMatScaleValues[2]);
-        Matrix rotationMat = MatrixRotateXYZ(
-            (Vector3) { .x = DEG2RAD * guiModelMatRotateValues[0],
-                        .y = DEG2RAD * guiModelMatRotateValues[1],
-                        .z = DEG2RAD * guiModelMatRotateValues[2] });
-        Matrix transMat = MatrixTranslate(guiModelMatTransValues[0],
-                                          guiModelMatTransValues[1],
-                                          guiModelMatTransValues[2]);
-
-        gameObjects[OBJ_TYPE_PLAYER].model.transform =
-            MatrixMultiply(MatrixMultiply(scaleMat, rotationMat), transMat);
+        Vector3 scale = { .x = guiModelMatScaleValues[0],
+                          .y = guiModelMatScaleValues[1],
+                          .z = guiModelMatScaleValues[2] };
+        Vector3 angle = { .x = DEG2RAD * guiModelMatRotateValues[0],
+                          .y = DEG2RAD * guiModelMatRotateValues[1],
+                          .z = DEG2RAD * guiModelMatRotateValues[2] };
+        Vector3 translation = { .x = guiModelMatTransValues[0],
+                                .y = guiModelMatTransValues[1],
+                                .z = guiModelMatTransValues[2] };
+
+        // NOTE: 오일러 각을 사원수로 바꾸지 않고 "로컬 행렬"을 직접 계산
+        SetSceneNodeLocalMat(sceneNode,
+                             ComposeEulerTRSMat(translation, angle, scale));
     }
 
+    // NOTE: 플레이어 노드가 바뀐 경우에만 "세계 행렬"을 다시 계산함
+    gameObjects[OBJ_TYPE_PLAYER].model.transform = GetSceneNodeWorldMat(
+        sceneNode);
+
+    shouldRedrawGuiArea = true;
+
     UpdateMatrixEntryText(guiModelMatEntryText,
                           gameObjects[OBJ_TYPE_PLAYER].model.transform);
 
     for (int i = 0; i < 3; i++) {
-        strncpy(guiModelMatScaleValueText[i],
-                TextFormat("%.1f", guiModelMatScaleValues[i]),
-                MATRIX_VALUE_TEXT_LENGTH);
-        strncpy(guiModelMatTransValueText[i],
-                TextFormat("%.1f", guiModelMatTransValues[i]),
-                MATRIX_VALUE_TEXT_LENGTH);
-        strncpy(guiModelMatRotateValueText[i],
-                TextFormat("%.1f", guiModelMatRotateValues[i]),
-                MATRIX_VALUE_TEXT_LENGTH);
+        FormatFixedFloat(guiModelMatScaleValueText[i],
+                         MATRIX_VALUE_TEXT_LENGTH,
+                         guiModelMatScaleValues[i],
+                         MATRIX_VALUE_PRECISION);
+        FormatFixedFloat(guiModelMatTransValueText[i],
+                         MATRIX_VALUE_TEXT_LENGTH,
+                         guiModelMatTransValues[i],
+                         MATRIX_VALUE_PRECISION);
+        FormatFixedFloat(guiModelMatRotateValueText[i],
+                         MATRIX_VALUE_TEXT_LENGTH,
+                         guiModelMatRotateValues[i],
+                         MATRIX_VALUE_PRECISION);
     }
 }
 
@@ -627,21 +935,29 @@ void UpdateViewMatrix(bool fromGUI) {
         virtualCamera->up = up;
     }
 
-    gameObjects[OBJ_TYPE_CAMERA].model.transform = GetVirtualCameraModelMat(
-        false);
+    SetSceneNodeLocalMat(gameObjects[OBJ_TYPE_CAMERA].sceneNode,
+                         GetVirtualCameraModelMat(false));
+
+    gameObjects[OBJ_TYPE_CAMERA].model.transform = GetSceneNodeWorldMat(
+        gameObjects[OBJ_TYPE_CAMERA].sceneNode);
+
+    shouldRedrawGuiArea = true;
 
     UpdateMatrixEntryText(guiViewMatEntryText, GetVirtualCameraViewMat(true));
 
     for (int i = 0; i < 3; i++) {
-        strncpy(guiViewMatEyeValueText[i],
-                TextFormat("%.1f", guiViewMatEyeValues[i]),
-                MATRIX_VALUE_TEXT_LENGTH);
-        strncpy(guiViewMatAtValueText[i],
-                TextFormat("%.1f", guiViewMatAtValues[i]),
-                MATRIX_VALUE_TEXT_LENGTH);
-        strncpy(guiViewMatUpValueText[i],
-                TextFormat("%.1f", guiViewMatUpValues[i]),
-                MATRIX_VALUE_TEXT_LENGTH);
+        FormatFixedFloat(guiViewMatEyeValueText[i],
+                         MATRIX_VALUE_TEXT_LENGTH,
+                         guiViewMatEyeValues[i],
+                         MATRIX_VALUE_PRECISION);
+        FormatFixedFloat(guiViewMatAtValueText[i],
+                         MATRIX_VALUE_TEXT_LENGTH,
+                         guiViewMatAtValues[i],
+                         MATRIX_VALUE_PRECISION);
+        FormatFixedFloat(guiViewMatUpValueText[i],
+                         MATRIX_VALUE_TEXT_LENGTH,
+                         guiViewMatUpValues[i],
+                         MATRIX_VALUE_PRECISION);
     }
 }
 
@@ -657,26 +973,293 @@ void UpdateProjMatrix(bool fromGUI) {
         rlSetClipPlanes(guiProjMatNearFarValues[0], guiProjMatNearFarValues[1]);
     }
 
+    shouldRedrawGuiArea = true;
+
     UpdateMatrixEntryText(guiProjMatEntryText, GetVirtualCameraProjMat(true));
 
-    strncpy(guiProjMatFovValueText[0],
-            TextFormat("%.1f", guiProjMatFovValues[0]),
-            MATRIX_VALUE_TEXT_LENGTH);
+    FormatFixedFloat(guiProjMatFovValueText[0],
+                     MATRIX_VALUE_TEXT_LENGTH,
+                     guiProjMatFovValues[0],
+                     MATRIX_VALUE_PRECISION);
+
+    FormatFixedFloat(guiProjMatAspectValueText[0],
+                     MATRIX_VALUE_TEXT_LENGTH,
+                     guiProjMatAspectValues[0],
+                     MATRIX_VALUE_PRECISION);
+
+    FormatFixedFloat(guiProjMatNearFarValueText[0],
+                     MATRIX_VALUE_TEXT_LENGTH,
+                     guiProjMatNearFarValues[0],
+                     MATRIX_VALUE_PRECISION);
+
+    FormatFixedFloat(guiProjMatNearFarValueText[1],
+                     MATRIX_VALUE_TEXT_LENGTH,
+                     guiProjMatNearFarValues[1],
+                     MATRIX_VALUE_PRECISION);
+}
+
+/* Private Functions ======================================================= */
+
+/* GUI 레이아웃에 행렬 패널을 추가하고, 입력 상자를 추가할 노드의 번호를 반환하는 함수 */
+static int AddGuiMatrixPanel(int parent,
+                             GuiWidgetId panelId,
+                             GuiWidgetId resetBtnId,
+                             GuiWidgetId entryId) {
+    int panelNode = AddGuiLayoutNode(
+        &guiLayout,
+        parent,
+        (GuiLayoutNode) { .alignment = GUI_LAYOUT_ALIGN_CENTER,
+                          .padding = { .bottom = 2.0f
+                                                 * GUI_DEFAULT_PADDING_SIZE },
+                          .spacing = 1.25f * GUI_DEFAULT_PADDING_SIZE,
+                          .widgetId = panelId });
+
+    {
+        /* 패널의 상태 표시줄 (초기화 버튼) */
+
+        int headerNode = AddGuiLayoutNode(
+            &guiLayout,
+            panelNode,
+            (GuiLayoutNode) {
+                .direction = GUI_LAYOUT_ROW,
+                .width = GUI_LAYOUT_WEIGHT(1.0f),
+                .height = GUI_LAYOUT_FIXED(
+                    RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT) });
+
+        if (resetBtnId != WIDGET_NONE) {
+            AddGuiLayoutNode(&guiLayout,
+                             headerNode,
+                             (GuiLayoutNode) {
+                                 .width = GUI_LAYOUT_WEIGHT(1.0f) });
+
+            AddGuiLayoutNode(&guiLayout,
+                             headerNode,
+                             (GuiLayoutNode) {
+                                 .width = GUI_LAYOUT_FIXED(
+                                     RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT),
+                                 .widgetId = resetBtnId });
+        }
+    }
+
+    int contentNode = AddGuiLayoutNode(
+        &guiLayout,
+        panelNode,
+        (GuiLayoutNode) { .spacing = GUI_DEFAULT_PADDING_SIZE });
+
+    {
+        /* 행렬의 각 요소 (열 우선 순서) */
+
+        int gridNode = AddGuiLayoutNode(
+            &guiLayout,
+            contentNode,
+            (GuiLayoutNode) { .direction = GUI_LAYOUT_ROW,
+                              .spacing = GUI_DEFAULT_PADDING_SIZE });
+
+        for (int i = 0; i < 4; i++) {
+            int columnNode = AddGuiLayoutNode(
+                &guiLayout,
+                gridNode,
+                (GuiLayoutNode) { .spacing = GUI_DEFAULT_PADDING_SIZE });
+
+            for (int j = 0; j < 4; j++)
+                AddGuiLayoutNode(
+                    &guiLayout,
+                    columnNode,
+                    (GuiLayoutNode) {
+                        .width = GUI_LAYOUT_FIXED(GUI_MAT_ENTRY_AREA_WIDTH),
+                        .height = GUI_LAYOUT_FIXED(GUI_MAT_ENTRY_AREA_HEIGHT),
+                        .widgetId = entryId + (4 * i) + j });
+        }
+    }
+
+    return contentNode;
+}
+
+/* GUI 레이아웃에 레이블과 입력 상자 `valueBoxCount`개로 이루어진 행을 추가하는 함수 */
+static int AddGuiValueRow(int parent,
+                          GuiWidgetId labelId,
+                          const char *labelText,
+                          int valueBoxCount) {
+    Vector2 textAreaSize = MeasureTextEx(GuiGetFont(),
+                                         labelText,
+                                         GuiGetFont().baseSize,
+                                         -2.0f);
+
+    int rowNode = AddGuiLayoutNode(
+        &guiLayout,
+        parent,
+        (GuiLayoutNode) {
+            .direction = GUI_LAYOUT_ROW,
+            .height = GUI_LAYOUT_FIXED(GUI_MAT_ENTRY_AREA_HEIGHT),
+            .spacing = GUI_DEFAULT_PADDING_SIZE });
+
+    AddGuiLayoutNode(&guiLayout,
+                     rowNode,
+                     (GuiLayoutNode) { .width = GUI_LAYOUT_FIXED(
+                                           textAreaSize.x),
+                                       .widgetId = labelId });
+
+    // NOTE: 각 입력 상자의 번호는 레이블의 번호 바로 다음부터 시작해야 함
+    for (int i = 0; i < valueBoxCount; i++)
+        AddGuiLayoutNode(&guiLayout,
+                         rowNode,
+                         (GuiLayoutNode) { .width = GUI_LAYOUT_WEIGHT(1.0f),
+                                           .widgetId = labelId + 1 + i });
+
+    return rowNode;
+}
+
+/* 각 공간을 렌더 그래프의 렌더 패스로 추가하는 함수 */
+static void AddSpaceRenderPasses(void) {
+    static const char *spaceNames[MVP_RENDER_COUNT_] = {
+        [MVP_RENDER_LOCAL] = GUI_RENDER_MODE_01_TEXT,
+        [MVP_RENDER_WORLD] = GUI_RENDER_MODE_02_TEXT,
+        [MVP_RENDER_VIEW] = GUI_RENDER_MODE_03_TEXT,
+        [MVP_RENDER_CLIP] = GUI_RENDER_MODE_04_TEXT
+    };
+
+    /*
+        NOTE: 각 공간은 입력 없이 자신의 렌더 타깃에만 그리고, 렌더 그래프가
+        추가된 순서대로 MVP 영역에 합성함
+    */
+    for (int i = MVP_RENDER_ALL + 1; i < MVP_RENDER_COUNT_; i++) {
+        if (recordSpaceFuncs[i] == NULL) continue;
 
-    strncpy(guiProjMatAspectValueText[0],
-            TextFormat("%.1f", guiProjMatAspectValues[0]),
-            MATRIX_VALUE_TEXT_LENGTH);
+        int target = AddRenderGraphTarget(spaceNames[i]);
 
-    strncpy(guiProjMatNearFarValueText[0],
-            TextFormat("%.1f", guiProjMatNearFarValues[0]),
-            MATRIX_VALUE_TEXT_LENGTH);
+        if (target < 0) continue;
 
-    strncpy(guiProjMatNearFarValueText[1],
-            TextFormat("%.1f", guiProjMatNearFarValues[1]),
-            MATRIX_VALUE_TEXT_LENGTH);
+        AddRenderGraphPass((RenderGraphPassDesc) {
+            .name = spaceNames[i],
+            .recordFunc = recordSpaceFuncs[i],
+            .renderMode = i,
+            .target = target,
+            .isPresented = true });
+    }
 }
 
-/* Private Functions ======================================================= */
+/* 게임 화면의 다음 초기화 단계를 진행하는 함수 */
+static void AdvanceStartupStage(void) {
+    switch (startupStage) {
+        case STARTUP_STAGE_GUI_STYLE:
+            GuiLoadStyleDarkr();
+
+            // NOTE: 글꼴 파일이 없으면 GUI 기본 글꼴과 영어 문자열만 사용함
+            useHangulHintText = InitGlyphCache(
+                TextFormat(GLYPH_FONT_FILE_NAME, GetApplicationDirectory()),
+                GuiGetFont().baseSize);
+
+            break;
+
+        case STARTUP_STAGE_GUI_AREAS:
+            UpdateGameAreas(), InitGuiAreas();
+
+            break;
+
+        case STARTUP_STAGE_SHADER:
+            shaderProgram = LoadCommonShader();
+
+            {
+                // GUI 글꼴의 글리프들로 SDF 글꼴 아틀라스 생성
+                Image fontImage = LoadImageFromBlob(darkrFontBlob,
+                                                    darkrFontBlobLength);
+
+                InitSdfFont(GuiGetFont(), fontImage);
+
+                UnloadImage(fontImage);
+            }
+
+            break;
+
+        case STARTUP_STAGE_ATLAS:
+            // 워커 스레드가 아직 디코딩하고 있다면, 끝날 때까지 기다림
+            if (isAtlasDecoderRunning)
+                pthread_join(atlasDecoderThread, NULL),
+                    isAtlasDecoderRunning = false;
+
+            if (atlasImage.data == NULL) DecodeAtlasImage(NULL);
+
+            textureAtlas = LoadTextureFromImage(atlasImage);
+
+            UnloadImage(atlasImage), atlasImage = (Image) { 0 };
+
+            break;
+
+        case STARTUP_STAGE_MODELS:
+            // 게임 세계에 플레이어와 카메라 등의 모델 추가
+            for (int i = 0; i < OBJ_TYPE_COUNT_; i++) {
+                if (i == OBJ_TYPE_CAMERA)
+                    gameObjects[i].model = GenerateCameraModel();
+                else if (i == OBJ_TYPE_PLAYER)
+                    gameObjects[i].model = GeneratePlayerModel();
+                else
+                    gameObjects[i].model = GenerateEnemyModel();
+
+                // 각 물체를 장면 그래프의 루트 노드로 추가
+                gameObjects[i].sceneNode = CreateSceneNode(-1);
+
+                SetSceneNodeLocalMat(gameObjects[i].sceneNode,
+                                     gameObjects[i].model.transform);
+            }
+
+            UpdateModelMatrix(true), UpdateViewMatrix(true);
+
+            UpdateProjMatrix(true);
+
+            for (int i = MVP_RENDER_ALL + 1; i < MVP_RENDER_COUNT_; i++)
+                if (initSpaceFuncs[i] != NULL) initSpaceFuncs[i]();
+
+            AddSpaceRenderPasses();
+
+            break;
+
+        default:
+            break;
+    }
+
+    if (++startupStage < STARTUP_STAGE_COUNT_) return;
+
+    TraceLog(LOG_INFO,
+             "GAME: First frame in %.2f ms, ready in %.2f ms",
+             1000.0 * firstFrameTime,
+             1000.0 * GetTime());
+
+    if (pendingSnapshotFileName[0] != '\0')
+        LoadGameSnapshot(pendingSnapshotFileName);
+}
+
+/* 타임라인의 현재 샘플을 GUI 패널의 각 값에 반영하는 함수 */
+static void ApplyTimelineSamples(void) {
+    bool isChannelChanged[TIMELINE_CHANNEL_COUNT_] = { false };
+
+    for (int i = 0; i < TIMELINE_CHANNEL_COUNT_; i++) {
+        Vector3 sample = { 0 };
+
+        if (!GetTimelineSample(i, &sample)) continue;
+
+        const float sampleValues[3] = { sample.x, sample.y, sample.z };
+
+        for (int j = 0; j < timelineTargetSizes[i]; j++) {
+            if (timelineTargetValues[i][j] == sampleValues[j]) continue;
+
+            timelineTargetValues[i][j] = sampleValues[j];
+
+            isChannelChanged[i] = true;
+        }
+    }
+
+    UpdateChannelMatrices(isChannelChanged);
+}
+
+/* 워커 스레드에서 텍스처 아틀라스 이미지를 디코딩하는 함수 */
+static void *DecodeAtlasImage(void *arg) {
+    (void) arg;
+
+    // NOTE: 미리 디코딩해 둔 픽셀 데이터이므로, 압축만 해제하면 바로 업로드 가능
+    atlasImage = LoadImageFromBlob(atlas192x96Blob, atlas192x96BlobLength);
+
+    return NULL;
+}
 
 /* 게임 화면의 왼쪽 영역을 그리는 함수 */
 static void DrawGuiArea(void) {
@@ -695,10 +1278,11 @@ static void DrawGuiArea(void) {
         Matrix modelMat = gameObjects[OBJ_TYPE_PLAYER].model.transform;
 
         {
-            GuiPanel(guiModelMatArea, GUI_MODEL_MAT_PANEL_TEXT);
+            GuiPanel(guiWidgetAreas[WIDGET_MODEL_MAT],
+                     GUI_MODEL_MAT_PANEL_TEXT);
 
             {
-                if (GuiLabelButton(guiModelMatResetBtnArea,
+                if (GuiLabelButton(guiWidgetAreas[WIDGET_MODEL_MAT_RESET_BTN],
                                    GuiIconText(ICON_UNDO, NULL)))
                     ResetModelMatrix();
             }
@@ -707,7 +1291,7 @@ static void DrawGuiArea(void) {
                 GuiDisable();
 
                 for (int i = 0; i < 16; i++)
-                    GuiTextBox(guiModelMatEntryArea[i],
+                    GuiTextBox(guiWidgetAreas[WIDGET_MODEL_MAT_ENTRY + i],
                                guiModelMatEntryText[i],
                                MATRIX_VALUE_TEXT_LENGTH,
                                false);
@@ -715,69 +1299,54 @@ static void DrawGuiArea(void) {
                 GuiEnable();
             }
 
-            GuiLabel(guiModelMatScaleArea, guiModelMatScaleLabelText);
+            GuiLabel(guiWidgetAreas[WIDGET_MODEL_MAT_SCALE],
+                     guiModelMatScaleLabelText);
 
             for (int i = 0; i < 3; i++)
-                if (GuiDraggableValueBoxFloat(
-                        guiModelMatScaleValueBoxArea[i],
-                        NULL,
+                if (DrawMatrixValueBox(
+                        guiWidgetAreas[WIDGET_MODEL_MAT_SCALE_VALUE_BOX + i],
                         guiModelMatScaleValueText[i],
                         &guiModelMatScaleValues[i],
                         0.01f,
                         8.0f,
-                        guiModelMatScaleValueBoxEnabled[i])) {
-                    if (guiModelMatScaleValueBoxEnabled[i])
-                        UpdateModelMatrix(true);
-
-                    guiModelMatScaleValueBoxEnabled[i] =
-                        !guiModelMatScaleValueBoxEnabled[i];
-                }
+                        &guiModelMatScaleValueBoxEnabled[i]))
+                    UpdateModelMatrix(true);
 
-            GuiLabel(guiModelMatTransArea, guiModelMatTransLabelText);
+            GuiLabel(guiWidgetAreas[WIDGET_MODEL_MAT_TRANS],
+                     guiModelMatTransLabelText);
 
             for (int i = 0; i < 3; i++)
-                if (GuiDraggableValueBoxFloat(
-                        guiModelMatTransValueBoxArea[i],
-                        NULL,
+                if (DrawMatrixValueBox(
+                        guiWidgetAreas[WIDGET_MODEL_MAT_TRANS_VALUE_BOX + i],
                         guiModelMatTransValueText[i],
                         &guiModelMatTransValues[i],
                         -4.0f,
                         4.0f,
-                        guiModelMatTransValueBoxEnabled[i])) {
-                    if (guiModelMatTransValueBoxEnabled[i])
-                        UpdateModelMatrix(true);
-
-                    guiModelMatTransValueBoxEnabled[i] =
-                        !guiModelMatTransValueBoxEnabled[i];
-                }
+                        &guiModelMatTransValueBoxEnabled[i]))
+                    UpdateModelMatrix(true);
 
-            GuiLabel(guiModelMatRotateArea, guiModelMatRotateLabelText);
+            GuiLabel(guiWidgetAreas[WIDGET_MODEL_MAT_ROTATE],
+                     guiModelMatRotateLabelText);
 
             for (int i = 0; i < 3; i++)
-                if (GuiDraggableValueBoxFloat(
-                        guiModelMatRotateValueBoxArea[i],
-                        NULL,
+                if (DrawMatrixValueBox(
+                        guiWidgetAreas[WIDGET_MODEL_MAT_ROTATE_VALUE_BOX + i],
                         guiModelMatRotateValueText[i],
                         &guiModelMatRotateValues[i],
                         0.0f,
                         360.0f,
-                        guiModelMatRotateValueBoxEnabled[i])) {
-                    if (guiModelMatRotateValueBoxEnabled[i])
-                        UpdateModelMatrix(true);
-
-                    guiModelMatRotateValueBoxEnabled[i] =
-                        !guiModelMatRotateValueBoxEnabled[i];
-                }
+                        &guiModelMatRotateValueBoxEnabled[i]))
+                    UpdateModelMatrix(true);
         }
 
         {
-            GuiPanel(guiViewMatArea, GUI_VIEW_MAT_PANEL_TEXT);
+            GuiPanel(guiWidgetAreas[WIDGET_VIEW_MAT], GUI_VIEW_MAT_PANEL_TEXT);
 
             {
                 GuiDisable();
 
                 for (int i = 0; i < 16; i++)
-                    GuiTextBox(guiViewMatEntryArea[i],
+                    GuiTextBox(guiWidgetAreas[WIDGET_VIEW_MAT_ENTRY + i],
                                guiViewMatEntryText[i],
                                MATRIX_VALUE_TEXT_LENGTH,
                                false);
@@ -785,64 +1354,52 @@ static void DrawGuiArea(void) {
                 GuiEnable();
             }
 
-            GuiLabel(guiViewMatEyeArea, guiViewMatEyeLabelText);
+            GuiLabel(guiWidgetAreas[WIDGET_VIEW_MAT_EYE],
+                     guiViewMatEyeLabelText);
 
             for (int i = 0; i < 3; i++)
-                if (GuiDraggableValueBoxFloat(
-                        guiViewMatEyeValueBoxArea[i],
-                        NULL,
+                if (DrawMatrixValueBox(
+                        guiWidgetAreas[WIDGET_VIEW_MAT_EYE_VALUE_BOX + i],
                         guiViewMatEyeValueText[i],
                         &guiViewMatEyeValues[i],
                         -4.0f,
                         4.0f,
-                        guiViewMatEyeValueBoxEnabled[i])) {
-                    if (guiViewMatEyeValueBoxEnabled[i]) UpdateViewMatrix(true);
+                        &guiViewMatEyeValueBoxEnabled[i]))
+                    UpdateViewMatrix(true);
 
-                    guiViewMatEyeValueBoxEnabled[i] =
-                        !guiViewMatEyeValueBoxEnabled[i];
-                }
-
-            GuiLabel(guiViewMatAtArea, guiViewMatAtLabelText);
+            GuiLabel(guiWidgetAreas[WIDGET_VIEW_MAT_AT], guiViewMatAtLabelText);
 
             for (int i = 0; i < 3; i++)
-                if (GuiDraggableValueBoxFloat(guiViewMatAtValueBoxArea[i],
-                                              NULL,
-                                              guiViewMatAtValueText[i],
-                                              &guiViewMatAtValues[i],
-                                              -4.0f,
-                                              4.0f,
-                                              guiViewMatAtValueBoxEnabled[i])) {
-                    if (guiViewMatAtValueBoxEnabled[i]) UpdateViewMatrix(true);
-
-                    guiViewMatAtValueBoxEnabled[i] =
-                        !guiViewMatAtValueBoxEnabled[i];
-                }
+                if (DrawMatrixValueBox(
+                        guiWidgetAreas[WIDGET_VIEW_MAT_AT_VALUE_BOX + i],
+                        guiViewMatAtValueText[i],
+                        &guiViewMatAtValues[i],
+                        -4.0f,
+                        4.0f,
+                        &guiViewMatAtValueBoxEnabled[i]))
+                    UpdateViewMatrix(true);
 
-            GuiLabel(guiViewMatUpArea, guiViewMatUpLabelText);
+            GuiLabel(guiWidgetAreas[WIDGET_VIEW_MAT_UP], guiViewMatUpLabelText);
 
             for (int i = 0; i < 3; i++)
-                if (GuiDraggableValueBoxFloat(guiViewMatUpValueBoxArea[i],
-                                              NULL,
-                                              guiViewMatUpValueText[i],
-                                              &guiViewMatUpValues[i],
-                                              -4.0f,
-                                              4.0f,
-                                              guiViewMatUpValueBoxEnabled[i])) {
-                    if (guiViewMatUpValueBoxEnabled[i]) UpdateViewMatrix(true);
-
-                    guiViewMatUpValueBoxEnabled[i] =
-                        !guiViewMatUpValueBoxEnabled[i];
-                }
+                if (DrawMatrixValueBox(
+                        guiWidgetAreas[WIDGET_VIEW_MAT_UP_VALUE_BOX + i],
+                        guiViewMatUpValueText[i],
+                        &guiViewMatUpValues[i],
+                        -4.0f,
+                        4.0f,
+                        &guiViewMatUpValueBoxEnabled[i]))
+                    UpdateViewMatrix(true);
         }
 
         {
-            GuiPanel(guiProjMatArea, GUI_PROJ_MAT_PANEL_TEXT);
+            GuiPanel(guiWidgetAreas[WIDGET_PROJ_MAT], GUI_PROJ_MAT_PANEL_TEXT);
 
             {
                 GuiDisable();
 
                 for (int i = 0; i < 16; i++)
-                    GuiTextBox(guiProjMatEntryArea[i],
+                    GuiTextBox(guiWidgetAreas[WIDGET_PROJ_MAT_ENTRY + i],
                                guiProjMatEntryText[i],
                                MATRIX_VALUE_TEXT_LENGTH,
                                false);
@@ -850,10 +1407,11 @@ static void DrawGuiArea(void) {
                 GuiEnable();
             }
 
-            GuiLabel(guiProjMatFovArea, guiProjMatFovLabelText);
+            GuiLabel(guiWidgetAreas[WIDGET_PROJ_MAT_FOV],
+                     guiProjMatFovLabelText);
 
             for (int i = 0; i < 1; i++) {
-                if (GuiButton(guiProjMatFovMinusBtnArea,
+                if (GuiButton(guiWidgetAreas[WIDGET_PROJ_MAT_FOV_MINUS_BTN],
                               GuiIconText(ICON_ARROW_LEFT, NULL))) {
                     guiProjMatFovValues[i] = Clamp(guiProjMatFovValues[i]
                                                        - 15.0f,
@@ -863,21 +1421,16 @@ static void DrawGuiArea(void) {
                     UpdateProjMatrix(true);
                 }
 
-                if (GuiDraggableValueBoxFloat(
-                        guiProjMatFovValueBoxArea[i],
-                        NULL,
+                if (DrawMatrixValueBox(
+                        guiWidgetAreas[WIDGET_PROJ_MAT_FOV_VALUE_BOX + i],
                         guiProjMatFovValueText[i],
                         &guiProjMatFovValues[i],
                         CAMERA_FOV_MIN_VALUE,
                         CAMERA_FOV_MAX_VALUE,
-                        guiProjMatFovValueBoxEnabled[i])) {
-                    if (guiProjMatFovValueBoxEnabled[i]) UpdateProjMatrix(true);
-
-                    guiProjMatFovValueBoxEnabled[i] =
-                        !guiProjMatFovValueBoxEnabled[i];
-                }
+                        &guiProjMatFovValueBoxEnabled[i]))
+                    UpdateProjMatrix(true);
 
-                if (GuiButton(guiProjMatFovPlusBtnArea,
+                if (GuiButton(guiWidgetAreas[WIDGET_PROJ_MAT_FOV_PLUS_BTN],
                               GuiIconText(ICON_ARROW_RIGHT, NULL))) {
                     guiProjMatFovValues[i] = Clamp(guiProjMatFovValues[i]
                                                        + 15.0f,
@@ -888,40 +1441,37 @@ static void DrawGuiArea(void) {
                 }
             }
 
-            GuiLabel(guiProjMatAspectArea, guiProjMatAspectLabelText);
+            GuiLabel(guiWidgetAreas[WIDGET_PROJ_MAT_ASPECT],
+                     guiProjMatAspectLabelText);
 
             {
                 GuiDisable();
 
                 for (int i = 0; i < 1; i++)
-                    GuiValueBoxFloat(guiProjMatAspectValueBoxArea[i],
-                                     NULL,
-                                     guiProjMatAspectValueText[i],
-                                     &guiProjMatAspectValues[i],
-                                     false);
+                    GuiValueBoxFloat(
+                        guiWidgetAreas[WIDGET_PROJ_MAT_ASPECT_VALUE_BOX + i],
+                        NULL,
+                        guiProjMatAspectValueText[i],
+                        &guiProjMatAspectValues[i],
+                        false);
 
                 GuiEnable();
             }
 
-            GuiLabel(guiProjMatNearFarArea, guiProjMatNearFarLabelText);
+            GuiLabel(guiWidgetAreas[WIDGET_PROJ_MAT_NEAR_FAR],
+                     guiProjMatNearFarLabelText);
 
             for (int i = 0; i < 2; i++)
-                if (GuiDraggableValueBoxFloat(
-                        guiProjMatNearFarValueBoxArea[i],
-                        NULL,
+                if (DrawMatrixValueBox(
+                        guiWidgetAreas[WIDGET_PROJ_MAT_NEAR_FAR_VALUE_BOX + i],
                         guiProjMatNearFarValueText[i],
                         &guiProjMatNearFarValues[i],
                         (i == 0) ? CULL_DISTANCE_NEAR_MIN_VALUE
                                  : CULL_DISTANCE_FAR_MIN_VALUE,
                         (i == 0) ? CULL_DISTANCE_NEAR_MAX_VALUE
                                  : CULL_DISTANCE_FAR_MAX_VALUE,
-                        guiProjMatNearFarValueBoxEnabled[i])) {
-                    if (guiProjMatNearFarValueBoxEnabled[i])
-                        UpdateProjMatrix(true);
-
-                    guiProjMatNearFarValueBoxEnabled[i] =
-                        !guiProjMatNearFarValueBoxEnabled[i];
-                }
+                        &guiProjMatNearFarValueBoxEnabled[i]))
+                    UpdateProjMatrix(true);
         }
 
         {
@@ -929,7 +1479,7 @@ static void DrawGuiArea(void) {
 
             GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
 
-            GuiLabelButton(guiReservedArea, magicNumbers + 6)
+            GuiLabelButton(guiWidgetAreas[WIDGET_RESERVED], magicNumbers + 6)
                 ? OpenURL(magicNumbers + 32)
                 : 0;
 
@@ -938,6 +1488,84 @@ static void DrawGuiArea(void) {
     }
 }
 
+/* 렌더 텍스처에 미리 그려 놓은 GUI 패널을 그리는 함수 */
+static void DrawCachedGuiArea(void) {
+    static bool wasWindowFocused = true;
+
+    bool isWindowFocused = IsWindowFocused();
+
+    /*
+        NOTE: GUI 패널이 잠금 해제된 동안 (= 마우스 커서가 GUI 패널 위에 있는 동안)
+        에는 위젯의 상태가 매 프레임마다 바뀔 수 있으므로, 항상 다시 그려야 함
+    */
+    if (!GuiIsLocked() || (isWindowFocused != wasWindowFocused))
+        shouldRedrawGuiArea = true;
+
+    wasWindowFocused = isWindowFocused;
+
+    if (shouldRedrawGuiArea) {
+        // NOTE: `guiArea`는 게임 화면의 왼쪽 위에서 시작하므로, 좌표 변환이 필요 없음
+        BeginTextureMode(guiAreaTexture);
+
+        {
+            ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+
+            DrawGuiArea();
+        }
+
+        EndTextureMode();
+
+        shouldRedrawGuiArea = false;
+    }
+
+    /*
+        NOTE: 렌더 텍스처에 반투명한 글자를 그리면 알파 값까지 섞이므로,
+        GUI 패널을 그릴 때는 색상 혼합 기능을 비활성화함
+    */
+    rlDrawRenderBatchActive(), rlDisableColorBlend();
+
+    DrawTextureRec(GetRenderTextureStorage(guiAreaTexture),
+                   (Rectangle) { .width = guiArea.width,
+                                 .height = -guiArea.height },
+                   (Vector2) { .x = guiArea.x, .y = guiArea.y },
+                   WHITE);
+
+    rlDrawRenderBatchActive(), rlEnableColorBlend();
+}
+
+/* 행렬 값 입력 상자를 그리고, 행렬을 업데이트해야 하는지 확인하는 함수 */
+static bool DrawMatrixValueBox(Rectangle bounds,
+                               char *textValue,
+                               float *value,
+                               float minValue,
+                               float maxValue,
+                               bool *editMode) {
+    float oldValue = *value;
+
+    bool shouldUpdate = false;
+
+    if (GuiDraggableValueBoxFloat(bounds,
+                                  NULL,
+                                  textValue,
+                                  value,
+                                  minValue,
+                                  maxValue,
+                                  *editMode)) {
+        // 편집 모드가 끝날 때 입력된 값 반영
+        shouldUpdate = *editMode;
+
+        *editMode = !(*editMode);
+    }
+
+    /*
+        NOTE: 마우스 오른쪽 버튼으로 값을 드래그하는 동안에는 (텍스트 입력과 달리)
+        입력 중인 문자열이 없으므로, 값이 바뀔 때마다 행렬을 바로 업데이트함
+    */
+    if (guiControlExclusiveMode && (*value != oldValue)) shouldUpdate = true;
+
+    return shouldUpdate;
+}
+
 /* MVP 영역에 그릴 화면의 종류를 보여주는 함수 */
 static void DrawRenderModeText(void) {
     static const char *renderModeTitles[MVP_RENDER_COUNT_] = {
@@ -948,25 +1576,37 @@ static void DrawRenderModeText(void) {
         GUI_RENDER_MODE_04_TEXT
     };
 
-    const char *renderModeHintText = TextFormat(GUI_RENDER_MODE_HINT_TEXT,
-                                                renderModeTitles[renderMode]);
+    static const char *hangulRenderModeTitles[MVP_RENDER_COUNT_] = {
+        GUI_KO_RENDER_MODE_00_TEXT,
+        GUI_KO_RENDER_MODE_01_TEXT,
+        GUI_KO_RENDER_MODE_02_TEXT,
+        GUI_KO_RENDER_MODE_03_TEXT,
+        GUI_KO_RENDER_MODE_04_TEXT
+    };
+
+    const char *renderModeHintText = FrameTextFormat(
+        useHangulHintText ? GUI_KO_RENDER_MODE_HINT_TEXT
+                          : GUI_RENDER_MODE_HINT_TEXT,
+        useHangulHintText ? hangulRenderModeTitles[renderMode]
+                          : renderModeTitles[renderMode]);
 
-    Vector2 renderModeHintTextSize = MeasureTextEx(GuiGetFont(),
-                                                   renderModeHintText,
-                                                   (GuiGetFont().baseSize),
-                                                   0.0f);
+    Vector2 renderModeHintTextSize = MeasureGlyphText(GuiGetFont(),
+                                                      renderModeHintText,
+                                                      (GuiGetFont().baseSize),
+                                                      0.0f);
 
     float renderModeAlpha = 1.0f
                             - (renderModeCounter
                                / RENDER_MODE_ANIMATION_DURATION);
 
-    DrawTextEx(GuiGetFont(),
-               renderModeHintText,
-               (Vector2) { .x = SCREEN_WIDTH - renderModeHintTextSize.x,
-                           .y = 8.0f },
-               (GuiGetFont().baseSize),
-               0.0f,
-               ColorAlpha(ColorBrightness(PURPLE, 0.15f), renderModeAlpha));
+    DrawGlyphText(GuiGetFont(),
+                  renderModeHintText,
+                  (Vector2) { .x = (mvpArea.x + mvpArea.width)
+                                   - renderModeHintTextSize.x,
+                              .y = 8.0f },
+                  (GuiGetFont().baseSize),
+                  0.0f,
+                  ColorAlpha(ColorBrightness(PURPLE, 0.15f), renderModeAlpha));
 }
 
 /* 게임 화면의 오른쪽 영역을 그리는 함수 */
@@ -974,59 +1614,21 @@ static void DrawMvpArea(void) {
     {
         // MVP 영역에 그릴 화면의 종류를 잠시 동안 보여주기
         if (renderModeCounter < RENDER_MODE_ANIMATION_DURATION)
-            renderModeCounter += GetFrameTime();
-    }
-
-    {
-        for (int i = MVP_RENDER_ALL + 1; i < MVP_RENDER_COUNT_; i++) {
-            if (updateSpaceFuncs[i] == NULL) continue;
-
-            updateSpaceFuncs[i](renderTextures[i]);
-
-            // 텍스처 필터링 (이중 선형 필터링)
-            SetTextureFilter(renderTextures[i].texture,
-                             TEXTURE_FILTER_BILINEAR);
-        }
+            renderModeCounter += GetReplayFrameTime();
     }
 
-    // 전부 다 그리기 vs. 하나만 그리기
-    if (renderMode == MVP_RENDER_ALL) {
-        for (int i = MVP_RENDER_ALL + 1; i < MVP_RENDER_COUNT_; i++) {
-            float halfWidth = 0.5f * mvpArea.width;
-            float halfHeight = 0.5f * mvpArea.height;
-
-            /*
-                첫 번째 행에는 "물체 공간"과 "세계 공간",
-                두 번째 행에는 "카메라 (뷰) 공간"과 "클립 공간"
-            */
-            DrawTexturePro(renderTextures[i].texture,
-                           (Rectangle) { .width = mvpArea.width,
-                                         .height = -mvpArea.height },
-                           (Rectangle) {
-                               .x = mvpArea.x + ((!(i & 1)) * halfWidth),
-                               .y = mvpArea.y
-                                    + ((i > MVP_RENDER_WORLD) * halfHeight),
-                               .width = 0.5f * mvpArea.width,
-                               .height = 0.5f * mvpArea.height },
-                           Vector2Zero(),
-                           0.0f,
-                           WHITE);
-        }
-    } else {
-        DrawTexturePro(renderTextures[renderMode].texture,
-                       (Rectangle) { .width = mvpArea.width,
-                                     .height = -mvpArea.height },
-                       mvpArea,
-                       Vector2Zero(),
-                       0.0f,
-                       WHITE);
-    }
+    /*
+        NOTE: 렌더 그래프가 화면의 종류에 따라 필요한 공간만 그리고, 그려진
+        공간들을 MVP 영역에 합성함 (전부 다 그리기 vs. 하나만 그리기)
+    */
+    ExecuteRenderGraph(renderMode, mvpArea);
 
     {
         /* GUI 영역과 MVP 영역 사이의 경계선 */
 
-        DrawLineEx((Vector2) { .x = mvpArea.x, .y = 0.0f * SCREEN_HEIGHT },
-                   (Vector2) { .x = mvpArea.x, .y = 1.0f * SCREEN_HEIGHT },
+        DrawLineEx((Vector2) { .x = mvpArea.x, .y = mvpArea.y },
+                   (Vector2) { .x = mvpArea.x,
+                               .y = mvpArea.y + mvpArea.height },
                    1.0f,
                    GRAY);
     }
@@ -1038,40 +1640,138 @@ static void DrawMvpArea(void) {
                               .y = mvpArea.y + (0.5f * mvpArea.height) };
 
         DrawLineEx((Vector2) { .x = mvpCenter.x, .y = mvpArea.y },
-                   (Vector2) { .x = mvpCenter.x, .y = 1.0f * SCREEN_HEIGHT },
+                   (Vector2) { .x = mvpCenter.x,
+                               .y = mvpArea.y + mvpArea.height },
                    1.0f,
                    GRAY);
 
         DrawLineEx((Vector2) { .x = mvpArea.x, .y = mvpCenter.y },
-                   (Vector2) { .x = 1.0f * SCREEN_WIDTH, .y = mvpCenter.y },
+                   (Vector2) { .x = mvpArea.x + mvpArea.width,
+                               .y = mvpCenter.y },
                    1.0f,
                    GRAY);
     }
 }
 
+/* 게임 화면을 초기화하는 동안 보여줄 화면을 그리는 함수 */
+static void DrawStartupScreen(void) {
+    int screenWidth = GetScreenWidth(), screenHeight = GetScreenHeight();
+
+    const char *startupText = FrameTextFormat(GUI_STARTUP_TEXT,
+                                              startupStage,
+                                              STARTUP_STAGE_COUNT_);
+
+    int startupTextWidth = MeasureText(startupText, GUI_STARTUP_FONT_SIZE);
+
+    // NOTE: GUI 스타일을 불러오기 전이므로, 기본 글꼴과 색상만 사용
+    Rectangle placeholderArea = { .x = GUI_AREA_WIDTH,
+                                  .width = screenWidth - GUI_AREA_WIDTH,
+                                  .height = screenHeight };
+
+    Vector2 center = { .x = placeholderArea.x + 0.5f * placeholderArea.width,
+                       .y = 0.5f * placeholderArea.height };
+
+    Rectangle progressBarArea = { .x = center.x
+                                       - 0.25f * placeholderArea.width,
+                                  .y = center.y + GUI_STARTUP_FONT_SIZE,
+                                  .width = 0.5f * placeholderArea.width,
+                                  .height = GUI_STARTUP_BAR_HEIGHT };
+
+    ClearBackground(RAYWHITE);
+
+    DrawRectangleRec((Rectangle) { .width = GUI_AREA_WIDTH,
+                                   .height = screenHeight },
+                     DARKGRAY);
+
+    DrawText(startupText,
+             center.x - 0.5f * startupTextWidth,
+             center.y - GUI_STARTUP_FONT_SIZE,
+             GUI_STARTUP_FONT_SIZE,
+             GRAY);
+
+    DrawRectangleLinesEx(progressBarArea, 1.0f, GRAY);
+
+    progressBarArea.width *= (float) startupStage / STARTUP_STAGE_COUNT_;
+
+    DrawRectangleRec(progressBarArea, GRAY);
+}
+
+/* 타임라인의 재생 상태를 보여주는 함수 */
+static void DrawTimelineText(void) {
+    const char *timelineStateText = useHangulHintText
+                                        ? GUI_KO_TIMELINE_EMPTY_TEXT
+                                        : GUI_TIMELINE_EMPTY_TEXT;
+
+    if (GetTimelineKeyframeCount() > 0) {
+        if (useHangulHintText)
+            timelineStateText = FrameTextFormat(
+                IsTimelinePlaying() ? GUI_KO_TIMELINE_PLAYING_TEXT
+                                    : GUI_KO_TIMELINE_PAUSED_TEXT,
+                GetTimelineTime(),
+                GetTimelineDuration());
+        else
+            timelineStateText = FrameTextFormat(
+                IsTimelinePlaying() ? GUI_TIMELINE_PLAYING_TEXT
+                                    : GUI_TIMELINE_PAUSED_TEXT,
+                GetTimelineTime(),
+                GetTimelineDuration());
+    }
+
+    const char *timelineHintText = FrameTextFormat(
+        useHangulHintText ? GUI_KO_TIMELINE_HINT_TEXT : GUI_TIMELINE_HINT_TEXT,
+        timelineStateText);
+
+    Font guiFont = GuiGetFont();
+
+    Vector2 timelineHintTextSize = MeasureGlyphText(guiFont,
+                                                    timelineHintText,
+                                                    guiFont.baseSize,
+                                                    0.0f);
+
+    DrawGlyphText(guiFont,
+                  timelineHintText,
+                  (Vector2) { .x = mvpArea.x + 8.0f,
+                              .y = (mvpArea.y + mvpArea.height)
+                                   - (timelineHintTextSize.y + 8.0f) },
+                  guiFont.baseSize,
+                  0.0f,
+                  ColorBrightness(SKYBLUE,
+                                  (!IsTimelinePlaying() ? -0.22f : 0.05f)));
+}
+
 /* 플레이어 모델의 정점 표시 여부를 보여주는 함수 */
 static void DrawVertexVisibilityText(void) {
     if (renderMode != MVP_RENDER_ALL) return;
 
-    const char *vertexVisibilityHintText = TextFormat(
-        GUI_VERTEX_VISIBILITY_HINT_TEXT,
-        (showPlayerVertices ? GUI_VERTEX_SHOWN_TEXT : GUI_VERTEX_HIDDEN_TEXT));
+    const char *vertexVisibilityText = NULL;
+
+    if (useHangulHintText)
+        vertexVisibilityText = showPlayerVertices ? GUI_KO_VERTEX_SHOWN_TEXT
+                                                  : GUI_KO_VERTEX_HIDDEN_TEXT;
+    else
+        vertexVisibilityText = showPlayerVertices ? GUI_VERTEX_SHOWN_TEXT
+                                                  : GUI_VERTEX_HIDDEN_TEXT;
+
+    const char *vertexVisibilityHintText = FrameTextFormat(
+        useHangulHintText ? GUI_KO_VERTEX_VISIBILITY_HINT_TEXT
+                          : GUI_VERTEX_VISIBILITY_HINT_TEXT,
+        vertexVisibilityText);
 
     Font guiFont = GuiGetFont();
 
-    Vector2 vertexVisibilityHintTextSize = MeasureTextEx(
+    Vector2 vertexVisibilityHintTextSize = MeasureGlyphText(
         guiFont, vertexVisibilityHintText, guiFont.baseSize, 0.0f);
 
-    DrawTextEx(guiFont,
-               vertexVisibilityHintText,
-               (Vector2) { .x = SCREEN_WIDTH
-                                - (vertexVisibilityHintTextSize.x + 8.0f),
-                           .y = SCREEN_HEIGHT
-                                - (vertexVisibilityHintTextSize.y + 8.0f) },
-               guiFont.baseSize,
-               0.0f,
-               ColorBrightness(GetColor(0xBFFF00FF),
-                               (!showPlayerVertices ? -0.22f : 0.05f)));
+    DrawGlyphText(guiFont,
+                  vertexVisibilityHintText,
+                  (Vector2) { .x = (mvpArea.x + mvpArea.width)
+                                   - (vertexVisibilityHintTextSize.x + 8.0f),
+                              .y = (mvpArea.y + mvpArea.height)
+                                   - (vertexVisibilityHintTextSize.y + 8.0f) },
+                  guiFont.baseSize,
+                  0.0f,
+                  ColorBrightness(GetColor(0xBFFF00FF),
+                                  (!showPlayerVertices ? -0.22f : 0.05f)));
 }
 
 /* 카메라 모델을 생성하는 함수 */
@@ -1272,10 +1972,15 @@ static void HandleInputEvents(void) {
 
         Vector2 mousePosition = GetMousePosition();
 
+        bool wasGuiLocked = GuiIsLocked();
+
         if (CheckCollisionPointRec(mousePosition, guiArea))
             SetMouseCursor(MOUSE_CURSOR_DEFAULT), GuiUnlock();
         else
             SetMouseCursor(GetMouseCursor()), GuiLock();
+
+        // 마우스 커서가 GUI 패널을 벗어나면, 위젯 상태를 되돌리기 위해 다시 그림
+        if (GuiIsLocked() != wasGuiLocked) shouldRedrawGuiArea = true;
     }
 
     {
@@ -1295,591 +2000,478 @@ static void HandleInputEvents(void) {
             /* 플레이어 모델의 정점 표시 여부 변경 */
 
             if (keyCode == KEY_V) showPlayerVertices = !showPlayerVertices;
-        }
-    }
-}
 
-/* GUI 패널에 그릴 위젯들의 영역을 정의하는 함수 */
-static void InitGuiAreas(void) {
-    float guiDefaultPaddingSize = 6.0f;
-
-    float guiMatEntryAreaWidth = 48.0f;
-    float guiMatEntryAreaHeight = 24.0f;
-
-    guiModelMatArea = (Rectangle) {
-        .x = 0.0f,
-        .y = (guiArea.y + RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT)
-             + guiDefaultPaddingSize,
-        .width = guiArea.width,
-        .height = ((guiArea.y + RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT)
-                   + (2.5f * guiDefaultPaddingSize))
-                  + ((4.0f * guiMatEntryAreaHeight)
-                     + (4.0f * guiDefaultPaddingSize))
-    };
+            /* 타임라인 재생, 키프레임 추가 및 제거 */
 
-    float guiMatEntryOffsetX = 0.5f
-                               * (guiModelMatArea.width
-                                  - ((4.0f * guiMatEntryAreaWidth)
-                                     + (3.0f * guiDefaultPaddingSize)));
+            if (keyCode == KEY_P) SetTimelinePlaying(!IsTimelinePlaying());
 
-    {
-        guiModelMatResetBtnArea = (Rectangle) {
-            .x = (guiModelMatArea.x + guiModelMatArea.width)
-                 - RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT,
-            .y = guiModelMatArea.y,
-            .width = RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT,
-            .height = RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT
-        };
-    }
+            // NOTE: 'Shift' 키를 누른 상태라면, 선형 보간을 사용
+            if (keyCode == KEY_K)
+                InsertTimelineKeyframes(IsKeyDown(KEY_LEFT_SHIFT)
+                                        || IsKeyDown(KEY_RIGHT_SHIFT));
 
-    {
-        for (int i = 0,
-                 j = sizeof guiModelMatEntryArea / sizeof *guiModelMatEntryArea;
-             i < j;
-             i++) {
-            float guiMatEntryPaddingWidth = ((i / 4)
-                                             * (guiMatEntryAreaWidth
-                                                + guiDefaultPaddingSize));
-
-            float guiMatEntryPaddingHeight = ((i % 4)
-                                              * (guiMatEntryAreaHeight
-                                                 + guiDefaultPaddingSize));
-
-            guiModelMatEntryArea[i] = (Rectangle) {
-                .x = (guiModelMatArea.x + guiMatEntryOffsetX)
-                     + guiMatEntryPaddingWidth,
-                .y = (guiModelMatArea.y
-                      + (RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT
-                         + (1.25f * guiDefaultPaddingSize)))
-                     + guiMatEntryPaddingHeight,
-                .width = guiMatEntryAreaWidth,
-                .height = guiMatEntryAreaHeight
-            };
+            if (keyCode == KEY_BACKSPACE) ClearTimeline();
+
+            /* 장면 스냅샷 (프리셋) 저장 및 불러오기 */
+
+            if (keyCode >= KEY_F1 && keyCode < KEY_F1 + SNAPSHOT_PRESET_COUNT) {
+                const char *fileName = FrameTextFormat(
+                    SNAPSHOT_PRESET_FILE_NAME,
+                    (keyCode - KEY_F1) + 1);
+
+                // NOTE: 'Shift' 키를 누른 상태라면, 현재 상태를 프리셋으로 저장
+                if (IsKeyDown(KEY_LEFT_SHIFT) || IsKeyDown(KEY_RIGHT_SHIFT))
+                    SaveGameSnapshot(fileName);
+                else
+                    LoadGameSnapshot(fileName);
+            }
+
+            /* 타임라인의 현재 시간 변경 */
+
+            float scrubDirection = (float) IsKeyDown(KEY_RIGHT_BRACKET)
+                                   - (float) IsKeyDown(KEY_LEFT_BRACKET);
+
+            if (scrubDirection != 0.0f) {
+                SetTimelinePlaying(false);
+
+                SetTimelineTime(GetTimelineTime()
+                                + (scrubDirection * TIMELINE_SCRUB_SPEED
+                                   * GetReplayFrameTime()));
+            }
         }
     }
 
-    {
-        guiModelMatScaleArea = (Rectangle) {
-            .x = guiModelMatArea.x + guiMatEntryOffsetX,
-            .y = (guiModelMatArea.y
-                  + (RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT
-                     + (1.5f * guiDefaultPaddingSize)))
-                 + 4.0f * (guiMatEntryAreaHeight + guiDefaultPaddingSize),
-            .width = ((4.0f * guiMatEntryAreaWidth)
-                      + (3.0f * guiDefaultPaddingSize)),
-            .height = guiMatEntryAreaHeight
-        };
+    if (IsFileDropped()) {
+        /* 끌어다 놓은 메시 파일로 플레이어 (또는 적) 모델 변경 */
 
-        strncpy(guiModelMatScaleLabelText,
-                GuiIconText(ICON_CURSOR_SCALE, GUI_MODEL_MAT_SCALE_LABEL_TEXT),
-                LABEL_TEXT_LENGTH);
+        FilePathList filePaths = LoadDroppedFiles();
 
-        Vector2 textAreaSize = MeasureTextEx(GuiGetFont(),
-                                             guiModelMatScaleLabelText,
-                                             GuiGetFont().baseSize,
-                                             -2.0f);
+        // NOTE: 'Shift' 키를 누른 상태라면, 적 모델을 변경
+        GameObjectType type = (IsKeyDown(KEY_LEFT_SHIFT)
+                               || IsKeyDown(KEY_RIGHT_SHIFT))
+                                  ? OBJ_TYPE_ENEMY
+                                  : OBJ_TYPE_PLAYER;
 
-        float valueBoxWidth = (((guiModelMatScaleArea.width - textAreaSize.x)
-                                - guiDefaultPaddingSize)
-                               - (2.0f * guiDefaultPaddingSize))
-                              / 3.0f;
-
-        float valueBoxHeight = guiModelMatScaleArea.height;
-
-        for (int i = 0; i < 3; i++)
-            guiModelMatScaleValueBoxArea[i] = (Rectangle) {
-                .x = (guiModelMatScaleArea.x + textAreaSize.x)
-                     + guiDefaultPaddingSize
-                     + (i * (valueBoxWidth + guiDefaultPaddingSize)),
-                .y = guiModelMatScaleArea.y,
-                .width = valueBoxWidth,
-                .height = valueBoxHeight
-            };
+        if (filePaths.count > 0) LoadGameObjectMesh(type, filePaths.paths[0]);
 
-        for (int i = 0; i < 3; i++)
-            strncpy(guiModelMatScaleValueText[i],
-                    TextFormat("%.1f", guiModelMatScaleValues[i]),
-                    LABEL_TEXT_LENGTH);
+        UnloadDroppedFiles(filePaths);
     }
+}
 
+/* GUI 패널에 그릴 위젯들의 영역을 정의하는 함수 */
+static void InitGuiAreas(void) {
     {
-        guiModelMatTransArea = (Rectangle) {
-            .x = guiModelMatScaleArea.x,
-            .y = (guiModelMatScaleArea.y + guiModelMatScaleArea.height)
-                 + guiDefaultPaddingSize,
-            .width = guiModelMatScaleArea.width,
-            .height = guiMatEntryAreaHeight
-        };
+        /* 각 레이블의 문자열 준비 */
+
+        strncpy(guiModelMatScaleLabelText,
+                GuiIconText(ICON_CURSOR_SCALE, GUI_MODEL_MAT_SCALE_LABEL_TEXT),
+                LABEL_TEXT_LENGTH);
 
         strncpy(guiModelMatTransLabelText,
                 GuiIconText(ICON_CURSOR_MOVE, GUI_MODEL_MAT_TRANS_LABEL_TEXT),
                 LABEL_TEXT_LENGTH);
 
-        Vector2 textAreaSize = MeasureTextEx(GuiGetFont(),
-                                             guiModelMatTransLabelText,
-                                             GuiGetFont().baseSize,
-                                             -2.0f);
-
-        float valueBoxWidth = (((guiModelMatTransArea.width - textAreaSize.x)
-                                - guiDefaultPaddingSize)
-                               - (2.0f * guiDefaultPaddingSize))
-                              / 3.0f;
-
-        float valueBoxHeight = guiModelMatTransArea.height;
-
-        for (int i = 0; i < 3; i++)
-            guiModelMatTransValueBoxArea[i] = (Rectangle) {
-                .x = (guiModelMatTransArea.x + textAreaSize.x)
-                     + guiDefaultPaddingSize
-                     + (i * (valueBoxWidth + guiDefaultPaddingSize)),
-                .y = guiModelMatTransArea.y,
-                .width = valueBoxWidth,
-                .height = valueBoxHeight
-            };
+        strncpy(guiModelMatRotateLabelText,
+                GuiIconText(ICON_ROTATE, GUI_MODEL_MAT_ROTATE_LABEL_TEXT),
+                LABEL_TEXT_LENGTH);
 
-        for (int i = 0; i < 3; i++)
-            strncpy(guiModelMatTransValueText[i],
-                    TextFormat("%.1f", guiModelMatTransValues[i]),
-                    LABEL_TEXT_LENGTH);
-    }
+        strncpy(guiViewMatEyeLabelText,
+                GuiIconText(ICON_EYE_ON, GUI_VIEW_MAT_EYE_LABEL_TEXT),
+                LABEL_TEXT_LENGTH);
 
-    {
-        guiModelMatRotateArea = (Rectangle) {
-            .x = guiModelMatTransArea.x,
-            .y = (guiModelMatTransArea.y + guiModelMatTransArea.height)
-                 + guiDefaultPaddingSize,
-            .width = guiModelMatTransArea.width,
-            .height = guiMatEntryAreaHeight
-        };
+        strncpy(guiViewMatAtLabelText,
+                GuiIconText(ICON_TARGET, GUI_VIEW_MAT_AT_LABEL_TEXT),
+                LABEL_TEXT_LENGTH);
 
-        strncpy(guiModelMatRotateLabelText,
-                GuiIconText(ICON_ROTATE, GUI_MODEL_MAT_ROTATE_LABEL_TEXT),
+        strncpy(guiViewMatUpLabelText,
+                GuiIconText(ICON_ARROW_UP, GUI_VIEW_MAT_UP_LABEL_TEXT),
                 LABEL_TEXT_LENGTH);
 
-        Vector2 textAreaSize = MeasureTextEx(GuiGetFont(),
-                                             guiModelMatRotateLabelText,
-                                             GuiGetFont().baseSize,
-                                             -2.0f);
+        strncpy(guiProjMatFovLabelText,
+                GuiIconText(ICON_LENS_BIG, GUI_PROJ_MAT_FOV_LABEL_TEXT),
+                LABEL_TEXT_LENGTH);
 
-        float valueBoxWidth = (((guiModelMatRotateArea.width - textAreaSize.x)
-                                - guiDefaultPaddingSize)
-                               - (2.0f * guiDefaultPaddingSize))
-                              / 3.0f;
-
-        float valueBoxHeight = guiModelMatRotateArea.height;
-
-        for (int i = 0; i < 3; i++)
-            guiModelMatRotateValueBoxArea[i] = (Rectangle) {
-                .x = (guiModelMatRotateArea.x + textAreaSize.x)
-                     + guiDefaultPaddingSize
-                     + (i * (valueBoxWidth + guiDefaultPaddingSize)),
-                .y = guiModelMatRotateArea.y,
-                .width = valueBoxWidth,
-                .height = valueBoxHeight
-            };
+        strncpy(guiProjMatAspectLabelText,
+                GuiIconText(ICON_ZOOM_ALL, GUI_PROJ_MAT_ASPECT_LABEL_TEXT),
+                LABEL_TEXT_LENGTH);
 
-        for (int i = 0; i < 3; i++)
-            strncpy(guiModelMatRotateValueText[i],
-                    TextFormat("%.1f", guiModelMatRotateValues[i]),
-                    LABEL_TEXT_LENGTH);
+        strncpy(guiProjMatNearFarLabelText,
+                GuiIconText(ICON_CUBE, GUI_PROJ_MAT_NEAR_FAR_LABEL_TEXT),
+                LABEL_TEXT_LENGTH);
     }
 
+    InitGuiLayout(&guiLayout, guiLayoutNodes, GUI_LAYOUT_NODE_COUNT);
+
+    // NOTE: 각 패널의 테두리가 서로 겹치도록 패널 사이의 간격을 음수로 설정
+    int rootNode = AddGuiLayoutNode(
+        &guiLayout,
+        -1,
+        (GuiLayoutNode) { .padding = { .top = RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT
+                                              + GUI_DEFAULT_PADDING_SIZE,
+                                       .bottom =
+                                           RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT },
+                          .spacing = -GUI_DEFAULT_PADDING_SIZE });
+
     {
-        guiModelMatArea.height += 3.0f
-                                  * (guiMatEntryAreaHeight
-                                     + guiDefaultPaddingSize);
+        int contentNode = AddGuiMatrixPanel(rootNode,
+                                            WIDGET_MODEL_MAT,
+                                            WIDGET_MODEL_MAT_RESET_BTN,
+                                            WIDGET_MODEL_MAT_ENTRY);
+
+        AddGuiValueRow(contentNode,
+                       WIDGET_MODEL_MAT_SCALE,
+                       guiModelMatScaleLabelText,
+                       3);
+
+        AddGuiValueRow(contentNode,
+                       WIDGET_MODEL_MAT_TRANS,
+                       guiModelMatTransLabelText,
+                       3);
+
+        AddGuiValueRow(contentNode,
+                       WIDGET_MODEL_MAT_ROTATE,
+                       guiModelMatRotateLabelText,
+                       3);
     }
 
-    guiViewMatArea = (Rectangle) {
-        .x = 0.0f,
-        .y = (guiModelMatArea.y + guiModelMatArea.height)
-             - guiDefaultPaddingSize,
-        .width = guiArea.width,
-        .height = ((guiArea.y + RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT)
-                   + (2.5f * guiDefaultPaddingSize))
-                  + ((4.0f * guiMatEntryAreaHeight)
-                     + (4.0f * guiDefaultPaddingSize))
-    };
-
     {
-        for (int i = 0,
-                 j = sizeof guiViewMatEntryArea / sizeof *guiViewMatEntryArea;
-             i < j;
-             i++) {
-            float guiMatEntryPaddingWidth = ((i / 4)
-                                             * (guiMatEntryAreaWidth
-                                                + guiDefaultPaddingSize));
-
-            float guiMatEntryPaddingHeight = ((i % 4)
-                                              * (guiMatEntryAreaHeight
-                                                 + guiDefaultPaddingSize));
-
-            guiViewMatEntryArea[i] = (Rectangle) {
-                .x = (guiViewMatArea.x + guiMatEntryOffsetX)
-                     + guiMatEntryPaddingWidth,
-                .y = (guiViewMatArea.y
-                      + (RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT
-                         + (1.25f * guiDefaultPaddingSize)))
-                     + guiMatEntryPaddingHeight,
-                .width = guiMatEntryAreaWidth,
-                .height = guiMatEntryAreaHeight
-            };
-        }
+        int contentNode = AddGuiMatrixPanel(rootNode,
+                                            WIDGET_VIEW_MAT,
+                                            WIDGET_NONE,
+                                            WIDGET_VIEW_MAT_ENTRY);
+
+        AddGuiValueRow(contentNode,
+                       WIDGET_VIEW_MAT_EYE,
+                       guiViewMatEyeLabelText,
+                       3);
+
+        AddGuiValueRow(contentNode,
+                       WIDGET_VIEW_MAT_AT,
+                       guiViewMatAtLabelText,
+                       3);
+
+        AddGuiValueRow(contentNode,
+                       WIDGET_VIEW_MAT_UP,
+                       guiViewMatUpLabelText,
+                       3);
     }
 
     {
-        guiViewMatEyeArea = (Rectangle) {
-            .x = guiViewMatArea.x + guiMatEntryOffsetX,
-            .y = (guiViewMatArea.y
-                  + (RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT
-                     + (1.5f * guiDefaultPaddingSize)))
-                 + 4.0f * (guiMatEntryAreaHeight + guiDefaultPaddingSize),
-            .width = ((4.0f * guiMatEntryAreaWidth)
-                      + (3.0f * guiDefaultPaddingSize)),
-            .height = guiMatEntryAreaHeight
-        };
+        int contentNode = AddGuiMatrixPanel(rootNode,
+                                            WIDGET_PROJ_MAT,
+                                            WIDGET_NONE,
+                                            WIDGET_PROJ_MAT_ENTRY);
 
-        strncpy(guiViewMatEyeLabelText,
-                GuiIconText(ICON_EYE_ON, GUI_VIEW_MAT_EYE_LABEL_TEXT),
-                LABEL_TEXT_LENGTH);
+        {
+            int rowNode = AddGuiValueRow(contentNode,
+                                         WIDGET_PROJ_MAT_FOV,
+                                         guiProjMatFovLabelText,
+                                         0);
+
+            AddGuiLayoutNode(&guiLayout,
+                             rowNode,
+                             (GuiLayoutNode) {
+                                 .width = GUI_LAYOUT_WEIGHT(0.22f),
+                                 .widgetId = WIDGET_PROJ_MAT_FOV_MINUS_BTN });
+
+            AddGuiLayoutNode(&guiLayout,
+                             rowNode,
+                             (GuiLayoutNode) {
+                                 .width = GUI_LAYOUT_WEIGHT(0.56f),
+                                 .widgetId = WIDGET_PROJ_MAT_FOV_VALUE_BOX });
+
+            AddGuiLayoutNode(&guiLayout,
+                             rowNode,
+                             (GuiLayoutNode) {
+                                 .width = GUI_LAYOUT_WEIGHT(0.22f),
+                                 .widgetId = WIDGET_PROJ_MAT_FOV_PLUS_BTN });
+        }
 
-        Vector2 textAreaSize = MeasureTextEx(GuiGetFont(),
-                                             guiViewMatEyeLabelText,
-                                             GuiGetFont().baseSize,
-                                             -2.0f);
+        AddGuiValueRow(contentNode,
+                       WIDGET_PROJ_MAT_ASPECT,
+                       guiProjMatAspectLabelText,
+                       1);
 
-        float valueBoxWidth = (((guiViewMatEyeArea.width - textAreaSize.x)
-                                - guiDefaultPaddingSize)
-                               - (2.0f * guiDefaultPaddingSize))
-                              / 3.0f;
-
-        float valueBoxHeight = guiViewMatEyeArea.height;
-
-        for (int i = 0; i < 3; i++)
-            guiViewMatEyeValueBoxArea[i] = (Rectangle) {
-                .x = (guiViewMatEyeArea.x + textAreaSize.x)
-                     + guiDefaultPaddingSize
-                     + (i * (valueBoxWidth + guiDefaultPaddingSize)),
-                .y = guiViewMatEyeArea.y,
-                .width = valueBoxWidth,
-                .height = valueBoxHeight
-            };
+        AddGuiValueRow(contentNode,
+                       WIDGET_PROJ_MAT_NEAR_FAR,
+                       guiProjMatNearFarLabelText,
+                       2);
     }
 
     {
-        guiViewMatAtArea = (Rectangle) { .x = guiViewMatEyeArea.x,
-                                         .y = (guiViewMatEyeArea.y
-                                               + guiViewMatEyeArea.height)
-                                              + guiDefaultPaddingSize,
-                                         .width = guiViewMatEyeArea.width,
-                                         .height = guiMatEntryAreaHeight };
-
-        strncpy(guiViewMatAtLabelText,
-                GuiIconText(ICON_TARGET, GUI_VIEW_MAT_AT_LABEL_TEXT),
-                LABEL_TEXT_LENGTH);
-
         Vector2 textAreaSize = MeasureTextEx(GuiGetFont(),
-                                             guiViewMatAtLabelText,
+                                             magicNumbers + 6,
                                              GuiGetFont().baseSize,
                                              -2.0f);
 
-        float valueBoxWidth = (((guiViewMatAtArea.width - textAreaSize.x)
-                                - guiDefaultPaddingSize)
-                               - (2.0f * guiDefaultPaddingSize))
-                              / 3.0f;
-
-        float valueBoxHeight = guiViewMatAtArea.height;
-
-        for (int i = 0; i < 3; i++)
-            guiViewMatAtValueBoxArea[i] = (Rectangle) {
-                .x = (guiViewMatAtArea.x + textAreaSize.x)
-                     + guiDefaultPaddingSize
-                     + (i * (valueBoxWidth + guiDefaultPaddingSize)),
-                .y = guiViewMatAtArea.y,
-                .width = valueBoxWidth,
-                .height = valueBoxHeight
-            };
+        int footerNode = AddGuiLayoutNode(
+            &guiLayout,
+            rootNode,
+            (GuiLayoutNode) {
+                .height = GUI_LAYOUT_WEIGHT(1.0f),
+                .padding = { .right = GUI_DEFAULT_PADDING_SIZE,
+                             .left = GUI_DEFAULT_PADDING_SIZE } });
+
+        // 남은 공간의 3/4 지점에 예약된 영역 배치
+        AddGuiLayoutNode(&guiLayout,
+                         footerNode,
+                         (GuiLayoutNode) { .height = GUI_LAYOUT_WEIGHT(3.0f) });
+
+        AddGuiLayoutNode(&guiLayout,
+                         footerNode,
+                         (GuiLayoutNode) {
+                             .height = GUI_LAYOUT_FIXED(textAreaSize.y),
+                             .widgetId = WIDGET_RESERVED });
+
+        AddGuiLayoutNode(&guiLayout,
+                         footerNode,
+                         (GuiLayoutNode) { .height = GUI_LAYOUT_WEIGHT(1.0f) });
     }
 
-    {
-        guiViewMatUpArea = (Rectangle) { .x = guiViewMatAtArea.x,
-                                         .y = (guiViewMatAtArea.y
-                                               + guiViewMatAtArea.height)
-                                              + guiDefaultPaddingSize,
-                                         .width = guiViewMatAtArea.width,
-                                         .height = guiMatEntryAreaHeight };
+    SolveGuiLayout(&guiLayout, guiArea, guiWidgetAreas, WIDGET_COUNT_);
+}
 
-        strncpy(guiViewMatUpLabelText,
-                GuiIconText(ICON_ARROW_UP, GUI_VIEW_MAT_UP_LABEL_TEXT),
-                LABEL_TEXT_LENGTH);
+/* GUI 패널의 현재 값들을 타임라인의 현재 시간에 키프레임으로 추가하는 함수 */
+static void InsertTimelineKeyframes(bool useLinear) {
+    for (int i = 0; i < TIMELINE_CHANNEL_COUNT_; i++) {
+        float values[3] = { 0.0f };
 
-        Vector2 textAreaSize = MeasureTextEx(GuiGetFont(),
-                                             guiViewMatUpLabelText,
-                                             GuiGetFont().baseSize,
-                                             -2.0f);
+        for (int j = 0; j < timelineTargetSizes[i]; j++)
+            values[j] = timelineTargetValues[i][j];
 
-        float valueBoxWidth = (((guiViewMatUpArea.width - textAreaSize.x)
-                                - guiDefaultPaddingSize)
-                               - (2.0f * guiDefaultPaddingSize))
-                              / 3.0f;
-
-        float valueBoxHeight = guiViewMatUpArea.height;
-
-        for (int i = 0; i < 3; i++)
-            guiViewMatUpValueBoxArea[i] = (Rectangle) {
-                .x = (guiViewMatUpArea.x + textAreaSize.x)
-                     + guiDefaultPaddingSize
-                     + (i * (valueBoxWidth + guiDefaultPaddingSize)),
-                .y = guiViewMatUpArea.y,
-                .width = valueBoxWidth,
-                .height = valueBoxHeight
-            };
-    }
+        // 회전 변환은 구면 선형 보간, 나머지는 3차 스플라인 보간을 기본으로 사용
+        TimelineInterpolation interpolation = TIMELINE_INTERP_LINEAR;
 
-    {
-        guiViewMatArea.height += 3.0f
-                                 * (guiMatEntryAreaHeight
-                                    + guiDefaultPaddingSize);
+        if (!useLinear)
+            interpolation = (i == TIMELINE_CHANNEL_MODEL_ROTATE)
+                                ? TIMELINE_INTERP_SLERP
+                                : TIMELINE_INTERP_CUBIC;
+
+        AddTimelineKeyframe(i,
+                            GetTimelineTime(),
+                            (Vector3) { .x = values[0],
+                                        .y = values[1],
+                                        .z = values[2] },
+                            interpolation);
     }
+}
 
-    guiProjMatArea = (Rectangle) {
-        .x = 0.0f,
-        .y = (guiViewMatArea.y + guiViewMatArea.height) - guiDefaultPaddingSize,
-        .width = guiArea.width,
-        .height = ((guiArea.y + RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT)
-                   + (2.5f * guiDefaultPaddingSize))
-                  + ((4.0f * guiMatEntryAreaHeight)
-                     + (4.0f * guiDefaultPaddingSize))
-    };
+/* `fileName` 파일의 메시로 게임 세계의 물체 모델을 바꾸는 함수 */
+static void LoadGameObjectMesh(GameObjectType type, const char *fileName) {
+    GameObject *gameObject = &gameObjects[type];
 
-    {
-        for (int i = 0,
-                 j = sizeof guiProjMatEntryArea / sizeof *guiProjMatEntryArea;
-             i < j;
-             i++) {
-            float guiMatEntryPaddingWidth = ((i / 4)
-                                             * (guiMatEntryAreaWidth
-                                                + guiDefaultPaddingSize));
-
-            float guiMatEntryPaddingHeight = ((i % 4)
-                                              * (guiMatEntryAreaHeight
-                                                 + guiDefaultPaddingSize));
-
-            guiProjMatEntryArea[i] = (Rectangle) {
-                .x = (guiProjMatArea.x + guiMatEntryOffsetX)
-                     + guiMatEntryPaddingWidth,
-                .y = (guiProjMatArea.y
-                      + (RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT
-                         + (1.25f * guiDefaultPaddingSize)))
-                     + guiMatEntryPaddingHeight,
-                .width = guiMatEntryAreaWidth,
-                .height = guiMatEntryAreaHeight
+    Model model = LoadCachedModel(fileName);
+
+    if (model.meshCount <= 0) return;
+
+    model.transform = gameObject->model.transform;
+
+    // NOTE: 불러온 메시의 크기는 1이므로, 크기가 0.5인 적 모델에 맞게 줄임
+    if (type == OBJ_TYPE_ENEMY && !gameObject->isModelCached)
+        SetSceneNodeLocalMat(gameObject->sceneNode,
+                             MatrixMultiply(MatrixScale(0.5f, 0.5f, 0.5f),
+                                            model.transform));
+
+    if (gameObject->isModelCached)
+        UnloadCachedModel(gameObject->model);
+    else
+        UnloadModel(gameObject->model);
+
+    gameObject->model = model, gameObject->isModelCached = true;
+
+    if (type == OBJ_TYPE_PLAYER) {
+        /* 정육면체 모델과 같은 순서로, 경계 상자의 꼭짓점을 정점으로 표시 */
+
+        BoundingBox box = GetModelBoundingBox(model);
+
+        for (int i = 0; i < 4; i++) {
+            gameObject->vertexData[i].position = (Vector3) {
+                .x = (i >= 2) ? box.max.x : box.min.x,
+                .y = box.max.y,
+                .z = (i == 1 || i == 2) ? box.max.z : box.min.z
+            };
+
+            gameObject->vertexData[i + 4].position = (Vector3) {
+                .x = (i == 1 || i == 2) ? box.max.x : box.min.x,
+                .y = box.min.y,
+                .z = (i >= 2) ? box.max.z : box.min.z
             };
         }
     }
+}
 
-    {
-        guiProjMatFovArea = (Rectangle) {
-            .x = guiProjMatArea.x + guiMatEntryOffsetX,
-            .y = (guiProjMatArea.y
-                  + (RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT
-                     + (1.5f * guiDefaultPaddingSize)))
-                 + 4.0f * (guiMatEntryAreaHeight + guiDefaultPaddingSize),
-            .width = ((4.0f * guiMatEntryAreaWidth)
-                      + (3.0f * guiDefaultPaddingSize)),
-            .height = guiMatEntryAreaHeight
-        };
+/* "모델 행렬"을 단위 행렬로 초기화하는 함수 */
+static void ResetModelMatrix(void) {
+    for (int i = 0; i < 3; i++) {
+        guiModelMatScaleValues[i] = 1.0f;
+        guiModelMatRotateValues[i] = 0.0f;
+        guiModelMatTransValues[i] = 0.0f;
+    }
 
-        strncpy(guiProjMatFovLabelText,
-                GuiIconText(ICON_LENS_BIG, GUI_PROJ_MAT_FOV_LABEL_TEXT),
-                LABEL_TEXT_LENGTH);
+    SetSceneNodeTRS(gameObjects[OBJ_TYPE_PLAYER].sceneNode,
+                    Vector3Zero(),
+                    QuaternionIdentity(),
+                    Vector3One());
 
-        Vector2 textAreaSize = MeasureTextEx(GuiGetFont(),
-                                             guiProjMatFovLabelText,
-                                             GuiGetFont().baseSize,
-                                             -2.0f);
+    UpdateModelMatrix(false);
+}
 
-        float guiProjMatFovSubAreaWidth = (guiProjMatFovArea.width
-                                           - textAreaSize.x)
-                                          - guiDefaultPaddingSize;
+/* 현재 프레임의 행렬과 카메라를 업데이트 스레드에 전달하는 함수 */
+static void SubmitFrameInput(void) {
+    FrameInput *input = BeginFrameInput();
 
-        guiProjMatFovMinusBtnArea = (Rectangle) {
-            .x = (guiProjMatFovArea.x + textAreaSize.x) + guiDefaultPaddingSize,
-            .y = guiProjMatFovArea.y,
-            .width = 0.22f * guiProjMatFovSubAreaWidth,
-            .height = guiProjMatFovArea.height
-        };
+    if (input == NULL) return;
 
-        guiProjMatFovValueBoxArea[0] = (Rectangle) {
-            .x = (guiProjMatFovMinusBtnArea.x + guiProjMatFovMinusBtnArea.width)
-                 + guiDefaultPaddingSize,
-            .y = guiProjMatFovArea.y,
-            .width = ceilf(guiProjMatFovSubAreaWidth
-                           - (2.0f * guiProjMatFovMinusBtnArea.width))
-                     - (2.0f * guiDefaultPaddingSize),
-            .height = guiProjMatFovArea.height
-        };
+    const GameObject *player = &gameObjects[OBJ_TYPE_PLAYER];
 
-        guiProjMatFovPlusBtnArea = (Rectangle) {
-            .x = (guiProjMatFovValueBoxArea[0].x
-                  + guiProjMatFovValueBoxArea[0].width)
-                 + guiDefaultPaddingSize,
-            .y = guiProjMatFovArea.y,
-            .width = guiProjMatFovMinusBtnArea.width,
-            .height = guiProjMatFovArea.height
-        };
-    }
+    input->modelMat = player->model.transform;
+    input->viewMat = GetVirtualCameraViewMat(false);
 
-    {
-        guiProjMatAspectArea = (Rectangle) { .x = guiProjMatFovArea.x,
-                                             .y = (guiProjMatFovArea.y
-                                                   + guiProjMatFovArea.height)
-                                                  + guiDefaultPaddingSize,
-                                             .width = guiProjMatFovArea.width,
-                                             .height = guiMatEntryAreaHeight };
+    input->cameras[MVP_RENDER_LOCAL] = *GetLocalObserverCamera();
+    input->cameras[MVP_RENDER_WORLD] = *GetWorldObserverCamera();
+    input->cameras[MVP_RENDER_VIEW] = *GetViewObserverCamera();
+    input->cameras[MVP_RENDER_CLIP] = *GetVirtualCamera();
 
-        strncpy(guiProjMatAspectLabelText,
-                GuiIconText(ICON_ZOOM_ALL, "Aspect:  "),
-                LABEL_TEXT_LENGTH);
+    input->targetSize = (Vector2) { .x = mvpArea.width, .y = mvpArea.height };
 
-        Vector2 textAreaSize = MeasureTextEx(GuiGetFont(),
-                                             guiProjMatAspectLabelText,
-                                             GuiGetFont().baseSize,
-                                             -2.0f);
+    input->nearDistance = guiProjMatNearFarValues[0];
+    input->farDistance = guiProjMatNearFarValues[1];
 
-        guiProjMatAspectValueBoxArea[0] = (Rectangle) {
-            .x = (guiProjMatAspectArea.x + textAreaSize.x)
-                 + guiDefaultPaddingSize,
-            .y = guiProjMatAspectArea.y,
-            .width = (guiProjMatAspectArea.width - textAreaSize.x)
-                     - guiDefaultPaddingSize,
-            .height = guiProjMatAspectArea.height
-        };
-    }
+    for (int i = 0; i < GAME_OBJECT_VERTEX_COUNT; i++)
+        input->vertexPositions[i] = player->vertexData[i].position;
 
-    {
-        guiProjMatNearFarArea = (Rectangle) {
-            .x = guiProjMatAspectArea.x,
-            .y = (guiProjMatAspectArea.y + guiProjMatAspectArea.height)
-                 + guiDefaultPaddingSize,
-            .width = guiProjMatAspectArea.width,
-            .height = guiMatEntryAreaHeight
-        };
+    input->fontBaseSize = GuiGetFont().baseSize;
 
-        strncpy(guiProjMatNearFarLabelText,
-                GuiIconText(ICON_CUBE, GUI_PROJ_MAT_NEAR_FAR_LABEL_TEXT),
-                LABEL_TEXT_LENGTH);
+    input->isVertexVisible = showPlayerVertices;
 
-        Vector2 textAreaSize = MeasureTextEx(GuiGetFont(),
-                                             guiProjMatNearFarLabelText,
-                                             GuiGetFont().baseSize,
-                                             -2.0f);
+    EndFrameInput();
+}
 
-        float valueBoxWidth = (((guiProjMatNearFarArea.width - textAreaSize.x)
-                                - guiDefaultPaddingSize)
-                               - (1.0f * guiDefaultPaddingSize))
-                              / 2.0f;
-
-        float valueBoxHeight = guiProjMatNearFarArea.height;
-
-        for (int i = 0; i < 2; i++)
-            guiProjMatNearFarValueBoxArea[i] = (Rectangle) {
-                .x = (guiProjMatNearFarArea.x + textAreaSize.x)
-                     + guiDefaultPaddingSize
-                     + (i * (valueBoxWidth + guiDefaultPaddingSize)),
-                .y = guiProjMatNearFarArea.y,
-                .width = valueBoxWidth,
-                .height = valueBoxHeight
-            };
-    }
+/* 현재 프레임에서 바뀐 GUI 패널의 값을 기록하거나, 기록된 값을 반영하는 함수 */
+static void SyncReplayValues(void) {
+    static float recordedValues[TIMELINE_CHANNEL_COUNT_][3];
 
-    {
-        guiProjMatArea.height += 3.0f
-                                 * (guiMatEntryAreaHeight
-                                    + guiDefaultPaddingSize);
+    static bool hasRecordedValues = false;
+
+    if (GetReplayMode() == REPLAY_MODE_RECORD) {
+        // NOTE: 첫 번째 프레임에서는 모든 값을 기록함
+        for (int i = 0; i < TIMELINE_CHANNEL_COUNT_; i++)
+            for (int j = 0; j < timelineTargetSizes[i]; j++) {
+                if (hasRecordedValues
+                    && recordedValues[i][j] == timelineTargetValues[i][j])
+                    continue;
+
+                recordedValues[i][j] = timelineTargetValues[i][j];
+
+                RecordReplayValue(i, j, recordedValues[i][j]);
+            }
+
+        hasRecordedValues = true;
+    } else if (GetReplayMode() == REPLAY_MODE_PLAY) {
+        bool isChannelChanged[TIMELINE_CHANNEL_COUNT_] = { false };
+
+        TimelineChannel channel = TIMELINE_CHANNEL_MODEL_SCALE;
+
+        int component = 0;
+
+        float value = 0.0f;
+
+        while (PollReplayValue(&channel, &component, &value)) {
+            if (channel < 0 || channel >= TIMELINE_CHANNEL_COUNT_
+                || component < 0 || component >= timelineTargetSizes[channel])
+                continue;
+
+            if (timelineTargetValues[channel][component] == value) continue;
+
+            timelineTargetValues[channel][component] = value;
+
+            isChannelChanged[channel] = true;
+        }
+
+        UpdateChannelMatrices(isChannelChanged);
     }
+}
 
-    {
-        Vector2 textAreaSize = MeasureTextEx(GuiGetFont(),
-                                             magicNumbers + 6,
-                                             GuiGetFont().baseSize,
-                                             -2.0f);
+/* 값이 바뀐 채널에 해당하는 행렬들만 업데이트하는 함수 */
+static void UpdateChannelMatrices(const bool *isChannelChanged) {
+    // NOTE: 값이 실제로 바뀐 행렬만 업데이트하여, 불필요한 문자열 변환을 피함
+    bool shouldUpdateModelMat = false;
+    bool shouldUpdateViewMat = false;
+    bool shouldUpdateProjMat = false;
 
-        guiReservedArea = (Rectangle) {
-            .x = guiDefaultPaddingSize,
-            .y = (guiArea.height - RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT)
-                 - 0.25f
-                       * ((guiArea.height - RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT)
-                          - (guiProjMatArea.y + guiProjMatArea.height)),
-            .width = guiArea.width - (2.0f * guiDefaultPaddingSize),
-            .height = textAreaSize.y
-        };
+    for (int i = 0; i < TIMELINE_CHANNEL_COUNT_; i++) {
+        if (!isChannelChanged[i]) continue;
+
+        if (i <= TIMELINE_CHANNEL_MODEL_ROTATE)
+            shouldUpdateModelMat = true;
+        else if (i <= TIMELINE_CHANNEL_VIEW_UP)
+            shouldUpdateViewMat = true;
+        else
+            shouldUpdateProjMat = true;
     }
+
+    if (shouldUpdateModelMat) UpdateModelMatrix(true);
+    if (shouldUpdateViewMat) UpdateViewMatrix(true);
+    if (shouldUpdateProjMat) UpdateProjMatrix(true);
 }
 
-/* "모델 행렬"을 단위 행렬로 초기화하는 함수 */
-static void ResetModelMatrix(void) {
-    for (int i = 0; i < 3; i++) {
-        guiModelMatScaleValues[i] = 1.0f;
-        guiModelMatRotateValues[i] = 0.0f;
-        guiModelMatTransValues[i] = 0.0f;
+/* 게임 창의 크기에 맞게 각 영역과 렌더 텍스처를 다시 계산하는 함수 */
+static void UpdateGameAreas(void) {
+    int screenWidth = GetScreenWidth(), screenHeight = GetScreenHeight();
+
+    // 게임 창이 최소화된 경우에는 아무것도 하지 않음
+    if (screenWidth <= GUI_AREA_WIDTH || screenHeight <= 0) return;
+
+    guiArea = (Rectangle) { .width = GUI_AREA_WIDTH, .height = screenHeight };
+
+    mvpArea = (Rectangle) { .x = guiArea.width,
+                            .y = 0.0f,
+                            .width = screenWidth - guiArea.width,
+                            .height = screenHeight };
+
+    {
+        /*
+            NOTE: 렌더 텍스처를 먼저 반환하고 다시 가져오므로, 크기 단위가 같다면
+            창 크기를 조절하는 동안에도 같은 렌더 텍스처가 재사용됨
+        */
+
+        ReleaseRenderTexture(guiAreaTexture);
+
+        guiAreaTexture = AcquireRenderTexture(guiArea.width, guiArea.height);
     }
 
-    gameObjects[OBJ_TYPE_PLAYER].model.transform = MatrixIdentity();
+    SolveGuiLayout(&guiLayout, guiArea, guiWidgetAreas, WIDGET_COUNT_);
 
-    UpdateModelMatrix(false);
+    shouldRedrawGuiArea = true;
 }
 
 /* 행렬의 각 요소를 나타내는 문자열을 업데이트하는 함수 */
 static void UpdateMatrixEntryText(char (*matEntryText)[16], Matrix matrix) {
     if (matEntryText == NULL) return;
 
-    strncpy(matEntryText[0],
-            TextFormat("%.1f", matrix.m0),
-            MATRIX_VALUE_TEXT_LENGTH);
-    strncpy(matEntryText[1],
-            TextFormat("%.1f", matrix.m1),
-            MATRIX_VALUE_TEXT_LENGTH);
-    strncpy(matEntryText[2],
-            TextFormat("%.1f", matrix.m2),
-            MATRIX_VALUE_TEXT_LENGTH);
-    strncpy(matEntryText[3],
-            TextFormat("%.1f", matrix.m3),
-            MATRIX_VALUE_TEXT_LENGTH);
-    strncpy(matEntryText[4],
-            TextFormat("%.1f", matrix.m4),
-            MATRIX_VALUE_TEXT_LENGTH);
-    strncpy(matEntryText[5],
-            TextFormat("%.1f", matrix.m5),
-            MATRIX_VALUE_TEXT_LENGTH);
-    strncpy(matEntryText[6],
-            TextFormat("%.1f", matrix.m6),
-            MATRIX_VALUE_TEXT_LENGTH);
-    strncpy(matEntryText[7],
-            TextFormat("%.1f", matrix.m7),
-            MATRIX_VALUE_TEXT_LENGTH);
-    strncpy(matEntryText[8],
-            TextFormat("%.1f", matrix.m8),
-            MATRIX_VALUE_TEXT_LENGTH);
-    strncpy(matEntryText[9],
-            TextFormat("%.1f", matrix.m9),
-            MATRIX_VALUE_TEXT_LENGTH);
-    strncpy(matEntryText[10],
-            TextFormat("%.1f", matrix.m10),
-            MATRIX_VALUE_TEXT_LENGTH);
-    strncpy(matEntryText[11],
-            TextFormat("%.1f", matrix.m11),
-            MATRIX_VALUE_TEXT_LENGTH);
-    strncpy(matEntryText[12],
-            TextFormat("%.1f", matrix.m12),
-            MATRIX_VALUE_TEXT_LENGTH);
-    strncpy(matEntryText[13],
-            TextFormat("%.1f", matrix.m13),
-            MATRIX_VALUE_TEXT_LENGTH);
-    strncpy(matEntryText[14],
-            TextFormat("%.1f", matrix.m14),
-            MATRIX_VALUE_TEXT_LENGTH);
-    strncpy(matEntryText[15],
-            TextFormat("%.1f", matrix.m15),
-            MATRIX_VALUE_TEXT_LENGTH);
-}
\ No newline at end of file
+    float16 matEntries = MatrixToFloatV(matrix);
+
+    for (int i = 0; i < 16; i++)
+        FormatFixedFloat(matEntryText[i],
+                         MATRIX_VALUE_TEXT_LENGTH,
+                         matEntries.v[i],
+                         MATRIX_VALUE_PRECISION);
+}
+
+/* 초기화 단계를 진행하고, 그 동안 보여줄 화면을 그리는 함수 */
+static void UpdateStartupScreen(void) {
+    // GUI 영역을 계산한 후에 게임 창의 크기가 바뀌었다면, 다시 계산
+    if (IsWindowResized() && startupStage > STARTUP_STAGE_GUI_AREAS)
+        UpdateGameAreas();
+
+    BeginDrawing();
+
+    DrawStartupScreen();
+
+    EndDrawing();
+
+    // NOTE: 첫 번째 프레임은 초기화 단계를 진행하기 전에 먼저 보여줌
+    if (firstFrameTime < 0.0) firstFrameTime = GetTime();
+
+    AdvanceStartupStage();
+}
@@ -0,0 +1,592 @@
+/*
+    Copyright (c) 2024 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ================================================================ */
+
+#include "mvp-demo.h"
+
+#include <string.h>
+
+/* Macro Constants ========================================================= */
+
+// clang-format off
+
+/* 글리프 캐시에 저장할 수 있는 글리프의 최대 개수 */
+#define GLYPH_SLOT_CAPACITY                 (GLYPH_PAGE_COUNT            \
+                                             * (GLYPH_PAGE_SIZE          \
+                                                / GLYPH_CELL_SIZE)       \
+                                             * (GLYPH_PAGE_SIZE          \
+                                                / GLYPH_CELL_SIZE))
+
+/* 코드포인트로 글리프를 찾을 때 사용할 해시 테이블의 크기 (2의 거듭제곱) */
+#define GLYPH_TABLE_CAPACITY                2048
+
+/* 한 번에 래스터화할 수 있는 글리프의 최대 개수 */
+#define GLYPH_BATCH_CAPACITY                64
+
+/* 여러 줄의 문자열을 그릴 때, 각 줄 사이의 간격 */
+#define GLYPH_LINE_SPACING                  2.0f
+
+/* 해시 테이블의 빈 칸과 삭제된 칸 */
+#define GLYPH_TABLE_EMPTY                   0
+#define GLYPH_TABLE_DELETED                 -1
+
+// clang-format on
+
+/* Typedefs ================================================================ */
+
+/* 글리프 캐시에 저장된 글리프 */
+typedef struct GlyphCacheEntry_ {
+    int codepoint;               // 글리프의 코드포인트 (0: 비어 있음)
+    Rectangle rec;               // 아틀라스 페이지에서 글리프의 영역
+    int offsetX, offsetY;        // 글리프를 그릴 위치
+    int advanceX;                // 다음 글리프까지의 거리
+    unsigned int lastUsedFrame;  // 글리프를 마지막으로 사용한 프레임
+} GlyphCacheEntry;
+
+/* 글리프 캐시의 아틀라스 페이지 */
+typedef struct GlyphCachePage_ {
+    Image image;          // 아틀라스 페이지의 픽셀 데이터
+    Texture texture;      // 아틀라스 페이지의 텍스처
+    int dirtyMinY;        // 아직 업로드하지 않은 영역의 시작 행
+    int dirtyMaxY;        // 아직 업로드하지 않은 영역의 끝 행 (포함하지 않음)
+} GlyphCachePage;
+
+/* Private Variables ======================================================= */
+
+/* 글리프를 래스터화할 글꼴 파일의 데이터 */
+static unsigned char *fontFileData = NULL;
+
+/* 글리프를 래스터화할 글꼴 파일의 크기 */
+static int fontFileSize = 0;
+
+/* 글리프를 래스터화할 글꼴의 크기 */
+static int glyphFontSize = 0;
+
+/* 글리프 캐시의 아틀라스 페이지 */
+static GlyphCachePage glyphPages[GLYPH_PAGE_COUNT];
+
+/* 글리프 캐시에 저장된 글리프 */
+static GlyphCacheEntry glyphSlots[GLYPH_SLOT_CAPACITY];
+
+/* 코드포인트로 글리프를 찾기 위한 해시 테이블 (`glyphSlots`의 인덱스 + 1) */
+static int glyphTable[GLYPH_TABLE_CAPACITY];
+
+/* 해시 테이블에서 삭제된 칸의 개수 */
+static int glyphTableDeletedCount = 0;
+
+/* 글리프 캐시의 현재 프레임 번호 */
+static unsigned int glyphFrameCounter = 1;
+
+/* 글리프 캐시가 가득 찼다는 경고를 이미 출력했는지 여부 */
+static bool glyphOverflowReported = false;
+
+/* Private Function Prototypes ============================================= */
+
+/* 글리프를 추가할 칸을 찾고, 가득 찼다면 가장 오래 사용하지 않은 글리프를 제거하는 함수 */
+static int AcquireGlyphSlot(void);
+
+/* 글리프 캐시에서 `codepoint`에 해당하는 글리프의 인덱스를 반환하는 함수 */
+static int FindGlyphSlot(int codepoint);
+
+/* `font`에 `codepoint`에 해당하는 글리프가 있는지 확인하는 함수 */
+static bool HasFontGlyph(Font font, int codepoint);
+
+/* 코드포인트의 해시 값을 계산하는 함수 */
+static unsigned int HashCodepoint(int codepoint);
+
+/* 해시 테이블에 `slot`번째 글리프를 추가하는 함수 */
+static void InsertGlyphSlot(int slot);
+
+/* 글리프 `count`개를 래스터화하여 아틀라스 페이지에 추가하는 함수 */
+static void RasterizeGlyphs(const int *codepoints, int count);
+
+/* 해시 테이블에서 삭제된 칸을 정리하는 함수 */
+static void RebuildGlyphTable(void);
+
+/* 해시 테이블에서 `slot`번째 글리프를 제거하는 함수 */
+static void RemoveGlyphSlot(int slot);
+
+/* 아직 업로드하지 않은 아틀라스 페이지의 영역을 GPU에 업로드하는 함수 */
+static void UploadGlyphPages(void);
+
+/* Public Functions ======================================================== */
+
+/* `fileName` 글꼴 파일로 글리프 캐시를 초기화하는 함수 */
+bool InitGlyphCache(const char *fileName, int fontSize) {
+    if (fontFileData != NULL) UnloadGlyphCache();
+
+    if (fileName == NULL || fontSize <= 0 || fontSize > GLYPH_CELL_SIZE)
+        return false;
+
+    // NOTE: 글꼴 파일이 없다면, 기본 글꼴에 있는 글리프만 그릴 수 있음
+    if (!FileExists(fileName)) {
+        TraceLog(LOG_WARNING,
+                 "GLYPH: [%s] Font file not found, glyph cache disabled",
+                 fileName);
+
+        return false;
+    }
+
+    fontFileData = LoadFileData(fileName, &fontFileSize);
+
+    if (fontFileData == NULL) return false;
+
+    glyphFontSize = fontSize;
+
+    for (int i = 0; i < GLYPH_PAGE_COUNT; i++) {
+        glyphPages[i].image = GenImageColor(GLYPH_PAGE_SIZE,
+                                            GLYPH_PAGE_SIZE,
+                                            BLANK);
+
+        // NOTE: 글리프의 알파 값만 필요하므로, 2바이트 픽셀 형식을 사용
+        ImageFormat(&glyphPages[i].image,
+                    PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA);
+
+        glyphPages[i].texture = LoadTextureFromImage(glyphPages[i].image);
+
+        glyphPages[i].dirtyMinY = GLYPH_PAGE_SIZE;
+        glyphPages[i].dirtyMaxY = 0;
+    }
+
+    TraceLog(LOG_INFO,
+             "GLYPH: [%s] Glyph cache initialized (%d glyphs, %d page(s))",
+             fileName,
+             GLYPH_SLOT_CAPACITY,
+             GLYPH_PAGE_COUNT);
+
+    return true;
+}
+
+/* 글리프 캐시에 필요한 메모리 공간을 해제하는 함수 */
+void UnloadGlyphCache(void) {
+    if (fontFileData == NULL) return;
+
+    for (int i = 0; i < GLYPH_PAGE_COUNT; i++) {
+        UnloadTexture(glyphPages[i].texture);
+
+        UnloadImage(glyphPages[i].image);
+    }
+
+    UnloadFileData(fontFileData), fontFileData = NULL;
+
+    fontFileSize = 0, glyphFontSize = 0;
+
+    memset(glyphPages, 0, sizeof glyphPages);
+    memset(glyphSlots, 0, sizeof glyphSlots);
+    memset(glyphTable, 0, sizeof glyphTable);
+
+    glyphTableDeletedCount = 0;
+}
+
+/* 프레임이 끝날 때, 이번 프레임에 바뀐 아틀라스 페이지를 한 번에 업로드하는 함수 */
+void UpdateGlyphCache(void) {
+    UploadGlyphPages();
+
+    glyphFrameCounter++;
+}
+
+/* `text`를 그리는 데 필요한 글리프를 글리프 캐시에 미리 추가하는 함수 */
+void CacheGlyphText(Font font, const char *text) {
+    if (fontFileData == NULL || text == NULL) return;
+
+    int missingCodepoints[GLYPH_BATCH_CAPACITY], missingCount = 0;
+
+    for (int i = 0; text[i] != '\0';) {
+        int codepointSize = 0;
+
+        int codepoint = GetCodepointNext(text + i, &codepointSize);
+
+        i += codepointSize;
+
+        if (codepoint < 0x80 || HasFontGlyph(font, codepoint)) continue;
+
+        int slot = FindGlyphSlot(codepoint);
+
+        if (slot >= 0) {
+            glyphSlots[slot].lastUsedFrame = glyphFrameCounter;
+
+            continue;
+        }
+
+        bool isDuplicate = false;
+
+        for (int j = 0; j < missingCount && !isDuplicate; j++)
+            isDuplicate = (missingCodepoints[j] == codepoint);
+
+        if (isDuplicate) continue;
+
+        missingCodepoints[missingCount++] = codepoint;
+
+        // 한 번에 래스터화할 수 있는 글리프보다 많다면, 먼저 래스터화
+        if (missingCount == GLYPH_BATCH_CAPACITY)
+            RasterizeGlyphs(missingCodepoints, missingCount), missingCount = 0;
+    }
+
+    if (missingCount > 0) RasterizeGlyphs(missingCodepoints, missingCount);
+}
+
+/* `font`에 없는 글리프는 글리프 캐시에서 가져와서 `text`를 그리는 함수 */
+void DrawGlyphText(Font font,
+                   const char *text,
+                   Vector2 position,
+                   float fontSize,
+                   float spacing,
+                   Color tint) {
+    if (text == NULL || font.baseSize <= 0) return;
+
+    /*
+        NOTE: 새로 추가된 글리프는 아틀라스 페이지의 바뀐 영역으로만 기록해두고,
+        프레임이 끝날 때 `UpdateGlyphCache()`에서 한 번에 업로드함
+    */
+    CacheGlyphText(font, text);
+
+    float scaleFactor = fontSize / font.baseSize;
+
+    float cacheScaleFactor = (glyphFontSize > 0) ? fontSize / glyphFontSize
+                                                 : 0.0f;
+
+    Vector2 offset = { 0.0f, 0.0f };
+
+    for (int i = 0; text[i] != '\0';) {
+        int codepointSize = 0;
+
+        int codepoint = GetCodepointNext(text + i, &codepointSize);
+
+        i += codepointSize;
+
+        if (codepoint == '\n') {
+            offset.x = 0.0f, offset.y += fontSize + GLYPH_LINE_SPACING;
+
+            continue;
+        }
+
+        int slot = !HasFontGlyph(font, codepoint) ? FindGlyphSlot(codepoint)
+                                                  : -1;
+
+        if (slot < 0) {
+            // 기본 글꼴에 있는 글리프 (또는 대체 글리프)
+            int index = GetGlyphIndex(font, codepoint);
+
+            if (codepoint != ' ' && codepoint != '\t')
+                DrawTextCodepoint(font,
+                                  codepoint,
+                                  Vector2Add(position, offset),
+                                  fontSize,
+                                  tint);
+
+            offset.x += ((font.glyphs[index].advanceX != 0)
+                             ? font.glyphs[index].advanceX
+                             : font.recs[index].width)
+                            * scaleFactor
+                        + spacing;
+
+            continue;
+        }
+
+        const GlyphCacheEntry *entry = &glyphSlots[slot];
+
+        int page = slot / (GLYPH_SLOT_CAPACITY / GLYPH_PAGE_COUNT);
+
+        Rectangle dstRec = {
+            .x = position.x + offset.x + entry->offsetX * cacheScaleFactor,
+            .y = position.y + offset.y + entry->offsetY * cacheScaleFactor,
+            .width = entry->rec.width * cacheScaleFactor,
+            .height = entry->rec.height * cacheScaleFactor
+        };
+
+        DrawTexturePro(glyphPages[page].texture,
+                       entry->rec,
+                       dstRec,
+                       Vector2Zero(),
+                       0.0f,
+                       tint);
+
+        offset.x += entry->advanceX * cacheScaleFactor + spacing;
+    }
+}
+
+/* `font`에 없는 글리프는 글리프 캐시에서 가져와서 `text`의 크기를 계산하는 함수 */
+Vector2 MeasureGlyphText(Font font,
+                         const char *text,
+                         float fontSize,
+                         float spacing) {
+    Vector2 result = { 0.0f, 0.0f };
+
+    if (text == NULL || text[0] == '\0' || font.baseSize <= 0) return result;
+
+    CacheGlyphText(font, text);
+
+    float scaleFactor = fontSize / font.baseSize;
+
+    float cacheScaleFactor = (glyphFontSize > 0) ? fontSize / glyphFontSize
+                                                 : 0.0f;
+
+    float lineWidth = 0.0f;
+
+    int lineGlyphCount = 0;
+
+    result.y = fontSize;
+
+    for (int i = 0; text[i] != '\0';) {
+        int codepointSize = 0;
+
+        int codepoint = GetCodepointNext(text + i, &codepointSize);
+
+        i += codepointSize;
+
+        if (codepoint == '\n') {
+            result.y += fontSize + GLYPH_LINE_SPACING;
+
+            lineWidth = 0.0f, lineGlyphCount = 0;
+
+            continue;
+        }
+
+        int slot = !HasFontGlyph(font, codepoint) ? FindGlyphSlot(codepoint)
+                                                  : -1;
+
+        if (slot < 0) {
+            int index = GetGlyphIndex(font, codepoint);
+
+            lineWidth += ((font.glyphs[index].advanceX != 0)
+                              ? font.glyphs[index].advanceX
+                              : font.recs[index].width)
+                         * scaleFactor;
+        } else {
+            lineWidth += glyphSlots[slot].advanceX * cacheScaleFactor;
+        }
+
+        lineGlyphCount++;
+
+        float width = lineWidth + (lineGlyphCount - 1) * spacing;
+
+        if (result.x < width) result.x = width;
+    }
+
+    return result;
+}
+
+/* Private Functions ======================================================= */
+
+/* 글리프를 추가할 칸을 찾고, 가득 찼다면 가장 오래 사용하지 않은 글리프를 제거하는 함수 */
+static int AcquireGlyphSlot(void) {
+    int result = -1;
+
+    for (int i = 0; i < GLYPH_SLOT_CAPACITY; i++) {
+        if (glyphSlots[i].codepoint == 0) return i;
+
+        // NOTE: 이번 프레임에서 이미 그린 글리프는 제거하지 않음
+        if (glyphSlots[i].lastUsedFrame == glyphFrameCounter) continue;
+
+        if (result < 0
+            || glyphSlots[i].lastUsedFrame < glyphSlots[result].lastUsedFrame)
+            result = i;
+    }
+
+    if (result >= 0) {
+        RemoveGlyphSlot(result);
+    } else if (!glyphOverflowReported) {
+        TraceLog(LOG_WARNING,
+                 "GLYPH: Too many glyphs in a single frame (%d)",
+                 GLYPH_SLOT_CAPACITY);
+
+        glyphOverflowReported = true;
+    }
+
+    return result;
+}
+
+/* 글리프 캐시에서 `codepoint`에 해당하는 글리프의 인덱스를 반환하는 함수 */
+static int FindGlyphSlot(int codepoint) {
+    if (fontFileData == NULL) return -1;
+
+    unsigned int index = HashCodepoint(codepoint);
+
+    for (int i = 0; i < GLYPH_TABLE_CAPACITY; i++) {
+        int value = glyphTable[index];
+
+        if (value == GLYPH_TABLE_EMPTY) break;
+
+        if (value != GLYPH_TABLE_DELETED
+            && glyphSlots[value - 1].codepoint == codepoint)
+            return value - 1;
+
+        index = (index + 1) & (GLYPH_TABLE_CAPACITY - 1);
+    }
+
+    return -1;
+}
+
+/* `font`에 `codepoint`에 해당하는 글리프가 있는지 확인하는 함수 */
+static bool HasFontGlyph(Font font, int codepoint) {
+    if (font.glyphs == NULL) return false;
+
+    int index = GetGlyphIndex(font, codepoint);
+
+    return font.glyphs[index].value == codepoint;
+}
+
+/* 코드포인트의 해시 값을 계산하는 함수 */
+static unsigned int HashCodepoint(int codepoint) {
+    return ((unsigned int) codepoint * 2654435761u)
+           & (GLYPH_TABLE_CAPACITY - 1);
+}
+
+/* 해시 테이블에 `slot`번째 글리프를 추가하는 함수 */
+static void InsertGlyphSlot(int slot) {
+    unsigned int index = HashCodepoint(glyphSlots[slot].codepoint);
+
+    while (glyphTable[index] > GLYPH_TABLE_EMPTY)
+        index = (index + 1) & (GLYPH_TABLE_CAPACITY - 1);
+
+    if (glyphTable[index] == GLYPH_TABLE_DELETED) glyphTableDeletedCount--;
+
+    glyphTable[index] = slot + 1;
+}
+
+/* 글리프 `count`개를 래스터화하여 아틀라스 페이지에 추가하는 함수 */
+static void RasterizeGlyphs(const int *codepoints, int count) {
+    // NOTE: 글꼴 파일을 한 번만 해석하도록, 새로운 글리프들을 한 번에 래스터화
+    GlyphInfo *glyphs = LoadFontData(fontFileData,
+                                     fontFileSize,
+                                     glyphFontSize,
+                                     (int *) codepoints,
+                                     count,
+                                     FONT_DEFAULT);
+
+    if (glyphs == NULL) return;
+
+    const int cellsPerRow = GLYPH_PAGE_SIZE / GLYPH_CELL_SIZE;
+    const int cellsPerPage = GLYPH_SLOT_CAPACITY / GLYPH_PAGE_COUNT;
+
+    for (int i = 0; i < count; i++) {
+        int slot = AcquireGlyphSlot();
+
+        if (slot < 0) break;
+
+        GlyphCachePage *page = &glyphPages[slot / cellsPerPage];
+
+        int cell = slot % cellsPerPage;
+
+        int cellX = (cell % cellsPerRow) * GLYPH_CELL_SIZE;
+        int cellY = (cell / cellsPerRow) * GLYPH_CELL_SIZE;
+
+        const Image *glyphImage = &glyphs[i].image;
+
+        int width = (glyphImage->width < GLYPH_CELL_SIZE) ? glyphImage->width
+                                                          : GLYPH_CELL_SIZE;
+        int height = (glyphImage->height < GLYPH_CELL_SIZE)
+                         ? glyphImage->height
+                         : GLYPH_CELL_SIZE;
+
+        unsigned char *pixels = page->image.data;
+
+        // 이전 글리프를 지우고, 새로운 글리프의 밝기를 알파 값으로 복사
+        for (int y = 0; y < GLYPH_CELL_SIZE; y++) {
+            unsigned char *dst = pixels
+                                 + 2 * ((cellY + y) * GLYPH_PAGE_SIZE + cellX);
+
+            memset(dst, 0, 2 * GLYPH_CELL_SIZE);
+
+            if (y >= height || glyphImage->data == NULL) continue;
+
+            const unsigned char *src = (const unsigned char *) glyphImage->data
+                                       + y * glyphImage->width;
+
+            for (int x = 0; x < width; x++)
+                dst[2 * x] = 0xff, dst[2 * x + 1] = src[x];
+        }
+
+        if (page->dirtyMinY > cellY) page->dirtyMinY = cellY;
+
+        if (page->dirtyMaxY < cellY + GLYPH_CELL_SIZE)
+            page->dirtyMaxY = cellY + GLYPH_CELL_SIZE;
+
+        glyphSlots[slot] = (GlyphCacheEntry) {
+            .codepoint = codepoints[i],
+            .rec = { .x = cellX, .y = cellY, .width = width, .height = height },
+            .offsetX = glyphs[i].offsetX,
+            .offsetY = glyphs[i].offsetY,
+            .advanceX = glyphs[i].advanceX,
+            .lastUsedFrame = glyphFrameCounter
+        };
+
+        InsertGlyphSlot(slot);
+    }
+
+    UnloadFontData(glyphs, count);
+}
+
+/* 해시 테이블에서 삭제된 칸을 정리하는 함수 */
+static void RebuildGlyphTable(void) {
+    memset(glyphTable, 0, sizeof glyphTable);
+
+    glyphTableDeletedCount = 0;
+
+    for (int i = 0; i < GLYPH_SLOT_CAPACITY; i++)
+        if (glyphSlots[i].codepoint != 0) InsertGlyphSlot(i);
+}
+
+/* 해시 테이블에서 `slot`번째 글리프를 제거하는 함수 */
+static void RemoveGlyphSlot(int slot) {
+    unsigned int index = HashCodepoint(glyphSlots[slot].codepoint);
+
+    for (int i = 0; i < GLYPH_TABLE_CAPACITY; i++) {
+        if (glyphTable[index] == GLYPH_TABLE_EMPTY) break;
+
+        if (glyphTable[index] == slot + 1) {
+            glyphTable[index] = GLYPH_TABLE_DELETED;
+
+            glyphTableDeletedCount++;
+
+            break;
+        }
+
+        index = (index + 1) & (GLYPH_TABLE_CAPACITY - 1);
+    }
+
+    glyphSlots[slot].codepoint = 0;
+
+    // 삭제된 칸이 너무 많아지면, 글리프를 찾는 속도가 느려지므로 정리
+    if (glyphTableDeletedCount > GLYPH_TABLE_CAPACITY / 4) RebuildGlyphTable();
+}
+
+/* 아직 업로드하지 않은 아틀라스 페이지의 영역을 GPU에 업로드하는 함수 */
+static void UploadGlyphPages(void) {
+    for (int i = 0; i < GLYPH_PAGE_COUNT; i++) {
+        GlyphCachePage *page = &glyphPages[i];
+
+        if (page->dirtyMinY >= page->dirtyMaxY) continue;
+
+        // NOTE: 바뀐 행들은 메모리에 연속으로 저장되어 있으므로, 한 번에 업로드
+        UpdateTextureRec(page->texture,
+                         (Rectangle) { .y = page->dirtyMinY,
+                                       .width = GLYPH_PAGE_SIZE,
+                                       .height = page->dirtyMaxY
+                                                 - page->dirtyMinY },
+                         (unsigned char *) page->image.data
+                             + 2 * page->dirtyMinY * GLYPH_PAGE_SIZE);
+
+        page->dirtyMinY = GLYPH_PAGE_SIZE, page->dirtyMaxY = 0;
+    }
+}
@@ -0,0 +1,417 @@
+/*
+    Copyright (c) 2024 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ================================================================ */
+
+#include "mvp-demo.h"
+
+#include <math.h>
+
+/* Typedefs ================================================================ */
+
+/* 렌더 그래프의 렌더 타깃 */
+typedef struct RenderGraphTarget_ {
+    const char *name;  // 렌더 타깃의 이름
+    int writer;        // 렌더 타깃에 그리는 렌더 패스의 번호
+    int slot;          // 실제로 사용하는 렌더 텍스처의 번호 (-1: 사용하지 않음)
+    int lastUse;       // 마지막으로 사용되는 실행 순서
+    bool isPresented;  // MVP 영역에 합성되는지 여부
+} RenderGraphTarget;
+
+/* Private Variables ======================================================= */
+
+/* 렌더 그래프에 추가된 렌더 패스들 */
+static RenderGraphPassDesc passes[RENDER_GRAPH_PASS_CAPACITY];
+
+/* 렌더 그래프에 추가된 렌더 패스의 개수 */
+static int passCount = 0;
+
+/* 렌더 그래프에 추가된 렌더 타깃들 */
+static RenderGraphTarget targets[RENDER_GRAPH_TARGET_CAPACITY];
+
+/* 렌더 그래프에 추가된 렌더 타깃의 개수 */
+static int targetCount = 0;
+
+/* 실행할 렌더 패스들의 번호 (실행 순서대로) */
+static int executionOrder[RENDER_GRAPH_PASS_CAPACITY];
+
+/* 실행할 렌더 패스의 개수 */
+static int executionCount = 0;
+
+/* 각 렌더 패스의 그리기 명령 목록 */
+static DrawCommandList commandLists[RENDER_GRAPH_PASS_CAPACITY];
+
+/* 렌더 타깃들이 나누어 사용하는 렌더 텍스처들 */
+static RenderTexture slotTextures[RENDER_GRAPH_TARGET_CAPACITY];
+
+/* 렌더 타깃들이 나누어 사용하는 렌더 텍스처의 개수 */
+static int slotCount = 0;
+
+/* 렌더 그래프를 마지막으로 컴파일할 때 사용한 화면의 종류 */
+static MvpRenderMode compiledRenderMode = MVP_RENDER_ALL;
+
+/* 렌더 그래프를 다시 컴파일해야 하는지 여부 */
+static bool isGraphDirty = true;
+
+/* Private Function Prototypes ============================================= */
+
+/* 렌더 패스들의 실행 순서를 정하고, 필요 없는 렌더 패스를 제외하는 함수 */
+static void CompileRenderGraph(MvpRenderMode renderMode);
+
+/* 렌더 패스들을 의존 관계에 따라 정렬하는 함수 */
+static bool SortRenderPasses(int *order);
+
+/* 수명이 겹치지 않는 렌더 타깃들이 같은 렌더 텍스처를 사용하도록 하는 함수 */
+static void AssignRenderTargetSlots(void);
+
+/* 화면에 합성되는 렌더 타깃들을 MVP 영역에 그리는 함수 */
+static void CompositeRenderTargets(Rectangle area);
+
+/* Public Functions ======================================================== */
+
+/* 렌더 그래프에 렌더 타깃을 추가하고, 그 번호를 반환하는 함수 */
+int AddRenderGraphTarget(const char *name) {
+    if (targetCount >= RENDER_GRAPH_TARGET_CAPACITY) {
+        TraceLog(LOG_WARNING,
+                 "GRAPH: Failed to add render target '%s' (%d / %d)",
+                 (name != NULL) ? name : "",
+                 targetCount,
+                 RENDER_GRAPH_TARGET_CAPACITY);
+
+        return -1;
+    }
+
+    targets[targetCount] = (RenderGraphTarget) { .name = name,
+                                                 .writer = -1,
+                                                 .slot = -1 };
+
+    isGraphDirty = true;
+
+    return targetCount++;
+}
+
+/* 렌더 그래프에 렌더 패스를 추가하고, 그 번호를 반환하는 함수 */
+int AddRenderGraphPass(RenderGraphPassDesc desc) {
+    if (passCount >= RENDER_GRAPH_PASS_CAPACITY) {
+        TraceLog(LOG_WARNING,
+                 "GRAPH: Failed to add render pass '%s' (%d / %d)",
+                 (desc.name != NULL) ? desc.name : "",
+                 passCount,
+                 RENDER_GRAPH_PASS_CAPACITY);
+
+        return -1;
+    }
+
+    if (desc.recordFunc == NULL || desc.target < 0
+        || desc.target >= targetCount || desc.inputCount < 0
+        || desc.inputCount > RENDER_GRAPH_PASS_INPUT_CAPACITY) {
+        TraceLog(LOG_WARNING,
+                 "GRAPH: Invalid render pass '%s'",
+                 (desc.name != NULL) ? desc.name : "");
+
+        return -1;
+    }
+
+    // NOTE: 각 렌더 타깃에는 하나의 렌더 패스만 그릴 수 있음
+    if (targets[desc.target].writer >= 0) {
+        TraceLog(LOG_WARNING,
+                 "GRAPH: Render target '%s' already has a writer",
+                 targets[desc.target].name);
+
+        return -1;
+    }
+
+    for (int i = 0; i < desc.inputCount; i++) {
+        if (desc.inputs[i] >= 0 && desc.inputs[i] < targetCount
+            && desc.inputs[i] != desc.target)
+            continue;
+
+        TraceLog(LOG_WARNING,
+                 "GRAPH: Invalid input #%d for render pass '%s'",
+                 i,
+                 (desc.name != NULL) ? desc.name : "");
+
+        return -1;
+    }
+
+    targets[desc.target].writer = passCount;
+
+    passes[passCount] = desc;
+
+    isGraphDirty = true;
+
+    return passCount++;
+}
+
+/* 렌더 그래프를 실행하여 MVP 영역 `area`에 화면의 종류 `renderMode`를 그리는 함수 */
+void ExecuteRenderGraph(MvpRenderMode renderMode, Rectangle area) {
+    if (area.width <= 0.0f || area.height <= 0.0f) return;
+
+    // NOTE: 렌더 패스나 화면의 종류가 바뀌었을 때만 다시 컴파일함
+    if (isGraphDirty || compiledRenderMode != renderMode)
+        CompileRenderGraph(renderMode);
+
+    /*
+        NOTE: 렌더 텍스처 풀은 같은 크기의 렌더 텍스처를 재사용하므로, 매 프레임
+        렌더 텍스처를 가져오고 반환해도 새로운 렌더 텍스처를 만들지 않음
+    */
+    for (int i = 0; i < slotCount; i++)
+        slotTextures[i] = AcquireRenderTexture(area.width, area.height);
+
+    // NOTE: 모든 렌더 패스의 그리기 명령을 먼저 기록한 다음, 실행 순서대로 그림
+    for (int i = 0; i < executionCount; i++) {
+        int passIndex = executionOrder[i];
+
+        const RenderGraphPassDesc *pass = &passes[passIndex];
+
+        RenderTexture renderTexture = GetRenderGraphTexture(pass->target);
+
+        if (renderTexture.id == 0) continue;
+
+        ResetDrawCommandList(&commandLists[passIndex],
+                             pass->renderMode,
+                             renderTexture.texture.width,
+                             renderTexture.texture.height);
+
+        pass->recordFunc(&commandLists[passIndex]);
+    }
+
+    for (int i = 0; i < executionCount; i++) {
+        int passIndex = executionOrder[i];
+
+        RenderTexture renderTexture = GetRenderGraphTexture(
+            passes[passIndex].target);
+
+        if (renderTexture.id == 0) continue;
+
+        SubmitDrawCommandList(&commandLists[passIndex], renderTexture);
+
+        // 텍스처 필터링 (이중 선형 필터링)
+        SetTextureFilter(renderTexture.texture, TEXTURE_FILTER_BILINEAR);
+    }
+
+    CompositeRenderTargets(area);
+
+    for (int i = 0; i < slotCount; i++)
+        ReleaseRenderTexture(slotTextures[i]),
+            slotTextures[i] = (RenderTexture) { 0 };
+}
+
+/* 렌더 타깃 `target`에 연결된 렌더 텍스처를 반환하는 함수 */
+RenderTexture GetRenderGraphTexture(int target) {
+    if (target < 0 || target >= targetCount || targets[target].slot < 0)
+        return (RenderTexture) { 0 };
+
+    return slotTextures[targets[target].slot];
+}
+
+/* 렌더 그래프의 모든 렌더 패스와 렌더 타깃을 제거하는 함수 */
+void ResetRenderGraph(void) {
+    passCount = targetCount = executionCount = slotCount = 0;
+
+    isGraphDirty = true;
+}
+
+/* Private Functions ======================================================= */
+
+/* 렌더 패스들의 실행 순서를 정하고, 필요 없는 렌더 패스를 제외하는 함수 */
+static void CompileRenderGraph(MvpRenderMode renderMode) {
+    int order[RENDER_GRAPH_PASS_CAPACITY];
+
+    compiledRenderMode = renderMode, isGraphDirty = false;
+
+    executionCount = slotCount = 0;
+
+    for (int i = 0; i < targetCount; i++)
+        targets[i].slot = -1, targets[i].lastUse = -1,
+        targets[i].isPresented = false;
+
+    if (!SortRenderPasses(order)) {
+        TraceLog(LOG_WARNING, "GRAPH: Render passes have a cycle");
+
+        return;
+    }
+
+    bool isTargetNeeded[RENDER_GRAPH_TARGET_CAPACITY] = { false };
+
+    // 하나만 그리기 모드에서는 그 화면만 MVP 영역에 합성함
+    for (int i = 0; i < passCount; i++) {
+        const RenderGraphPassDesc *pass = &passes[i];
+
+        if (!pass->isPresented) continue;
+
+        if (renderMode != MVP_RENDER_ALL && pass->renderMode != renderMode)
+            continue;
+
+        targets[pass->target].isPresented = true;
+
+        isTargetNeeded[pass->target] = true;
+    }
+
+    bool isPassNeeded[RENDER_GRAPH_PASS_CAPACITY] = { false };
+
+    /*
+        NOTE: 실행 순서의 역순으로 확인하면, 어떤 렌더 패스를 확인할 때는
+        그 렌더 패스의 결과를 읽는 렌더 패스들을 이미 모두 확인한 상태임
+    */
+    for (int i = passCount - 1; i >= 0; i--) {
+        const RenderGraphPassDesc *pass = &passes[order[i]];
+
+        if (!isTargetNeeded[pass->target]) continue;
+
+        isPassNeeded[order[i]] = true;
+
+        for (int j = 0; j < pass->inputCount; j++)
+            isTargetNeeded[pass->inputs[j]] = true;
+    }
+
+    for (int i = 0; i < passCount; i++)
+        if (isPassNeeded[order[i]]) executionOrder[executionCount++] = order[i];
+
+    AssignRenderTargetSlots();
+
+    TraceLog(LOG_DEBUG,
+             "GRAPH: Compiled %d / %d render passes into %d render textures",
+             executionCount,
+             passCount,
+             slotCount);
+}
+
+/* 렌더 패스들을 의존 관계에 따라 정렬하는 함수 */
+static bool SortRenderPasses(int *order) {
+    int dependencyCounts[RENDER_GRAPH_PASS_CAPACITY] = { 0 };
+
+    // 각 렌더 패스가 먼저 실행되어야 하는 렌더 패스의 개수 계산
+    for (int i = 0; i < passCount; i++)
+        for (int j = 0; j < passes[i].inputCount; j++)
+            if (targets[passes[i].inputs[j]].writer >= 0)
+                dependencyCounts[i]++;
+
+    bool isSorted[RENDER_GRAPH_PASS_CAPACITY] = { false };
+
+    int count = 0;
+
+    // NOTE: 의존 관계가 없는 렌더 패스들은 추가된 순서대로 실행함
+    while (count < passCount) {
+        int passIndex = -1;
+
+        for (int i = 0; i < passCount; i++) {
+            if (isSorted[i] || dependencyCounts[i] > 0) continue;
+
+            passIndex = i;
+
+            break;
+        }
+
+        if (passIndex < 0) return false;
+
+        isSorted[passIndex] = true, order[count++] = passIndex;
+
+        for (int i = 0; i < passCount; i++)
+            for (int j = 0; j < passes[i].inputCount; j++)
+                if (passes[i].inputs[j] == passes[passIndex].target)
+                    dependencyCounts[i]--;
+    }
+
+    return true;
+}
+
+/* 수명이 겹치지 않는 렌더 타깃들이 같은 렌더 텍스처를 사용하도록 하는 함수 */
+static void AssignRenderTargetSlots(void) {
+    // 각 렌더 타깃이 마지막으로 사용되는 실행 순서 계산
+    for (int i = 0; i < executionCount; i++) {
+        const RenderGraphPassDesc *pass = &passes[executionOrder[i]];
+
+        targets[pass->target].lastUse = i;
+
+        for (int j = 0; j < pass->inputCount; j++)
+            targets[pass->inputs[j]].lastUse = i;
+    }
+
+    // NOTE: 화면에 합성되는 렌더 타깃은 모든 렌더 패스가 끝날 때까지 사용됨
+    for (int i = 0; i < targetCount; i++)
+        if (targets[i].isPresented) targets[i].lastUse = executionCount;
+
+    int slotLastUses[RENDER_GRAPH_TARGET_CAPACITY];
+
+    for (int i = 0; i < executionCount; i++) {
+        RenderGraphTarget *target = &targets[passes[executionOrder[i]].target];
+
+        /*
+            NOTE: 지금 실행하는 렌더 패스보다 먼저 수명이 끝난 렌더 타깃의
+            렌더 텍스처는 다른 렌더 타깃이 재사용할 수 있음
+        */
+        for (int j = 0; j < slotCount; j++) {
+            if (slotLastUses[j] >= i) continue;
+
+            target->slot = j;
+
+            break;
+        }
+
+        if (target->slot < 0) target->slot = slotCount++;
+
+        slotLastUses[target->slot] = target->lastUse;
+    }
+}
+
+/* 화면에 합성되는 렌더 타깃들을 MVP 영역에 그리는 함수 */
+static void CompositeRenderTargets(Rectangle area) {
+    int presentedCount = 0;
+
+    for (int i = 0; i < targetCount; i++)
+        if (targets[i].isPresented && targets[i].slot >= 0) presentedCount++;
+
+    if (presentedCount <= 0) return;
+
+    /*
+        NOTE: 화면에 합성되는 렌더 타깃들을 추가된 순서대로 격자 모양으로 배치함
+        (예: "물체 공간"과 "세계 공간"은 첫 번째 행, "카메라 (뷰) 공간"과
+        "클립 공간"은 두 번째 행)
+    */
+    int columnCount = (int) ceilf(sqrtf((float) presentedCount));
+    int rowCount = (presentedCount + columnCount - 1) / columnCount;
+
+    float cellWidth = area.width / columnCount;
+    float cellHeight = area.height / rowCount;
+
+    for (int i = 0, j = 0; i < targetCount; i++) {
+        if (!targets[i].isPresented || targets[i].slot < 0) continue;
+
+        RenderTexture renderTexture = slotTextures[targets[i].slot];
+
+        DrawTexturePro(GetRenderTextureStorage(renderTexture),
+                       (Rectangle) { .width = area.width,
+                                     .height = -area.height },
+                       (Rectangle) { .x = area.x + (j % columnCount)
+                                                       * cellWidth,
+                                     .y = area.y + (j / columnCount)
+                                                       * cellHeight,
+                                     .width = cellWidth,
+                                     .height = cellHeight },
+                       Vector2Zero(),
+                       0.0f,
+                       WHITE);
+
+        j++;
+    }
+}
@@ -0,0 +1,348 @@
+/*
+    Copyright (c) 2024 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ================================================================ */
+
+#include "mvp-demo.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#if !defined(_WIN32) && !defined(PLATFORM_WEB)
+    #include <unistd.h>
+#endif
+
+/* Macro Constants ========================================================= */
+
+// clang-format off
+
+/* 작업 큐 하나에 저장할 수 있는 작업의 최대 개수 (2의 거듭제곱) */
+#define JOB_QUEUE_CAPACITY                  256
+
+/* 작업 큐에서 작업의 위치를 계산할 때 사용하는 마스크 */
+#define JOB_QUEUE_MASK                      (JOB_QUEUE_CAPACITY - 1)
+
+// clang-format on
+
+/* Typedefs ================================================================ */
+
+/* 작업 스레드가 실행할 작업 */
+typedef struct Job_ {
+    JobFunc func;       // 작업 함수
+    void *userData;     // 작업 함수에 전달할 데이터
+    int index;          // 작업의 번호
+    int *pendingCount;  // 아직 끝나지 않은 작업의 개수
+} Job;
+
+/*
+    NOTE: 주인 스레드는 큐의 아래쪽 (bottom)에서 작업을 넣고 빼며, 다른 스레드는
+    큐의 위쪽 (top)에서 작업을 훔쳐감 (Chase-Lev 작업 큐)
+*/
+
+/* 스레드 하나가 주인인 작업 큐 */
+typedef struct JobQueue_ {
+    Job jobs[JOB_QUEUE_CAPACITY];  // 작업 목록
+    long top;                      // 다른 스레드가 훔쳐갈 작업의 위치
+    long bottom;                   // 주인 스레드가 작업을 넣을 위치
+} JobQueue;
+
+/* Private Variables ======================================================= */
+
+/* 각 작업 스레드와 외부 스레드 하나의 작업 큐 */
+static JobQueue jobQueues[JOB_MAX_WORKER_COUNT + 1];
+
+/* 작업 스레드 */
+static pthread_t jobWorkers[JOB_MAX_WORKER_COUNT];
+
+/* 실행 중인 작업 스레드의 개수 */
+static int jobWorkerCount = 0;
+
+/* 현재 스레드가 사용하는 작업 큐의 번호 (-1: 외부 스레드) */
+static __thread int jobQueueIndex = -1;
+
+/* 작업 스레드를 깨울 때 사용하는 뮤텍스와 조건 변수 */
+static pthread_mutex_t jobMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t jobCond = PTHREAD_COND_INITIALIZER;
+
+/* 작업 큐에 새로운 작업이 추가될 때마다 증가하는 값 */
+static unsigned int jobGeneration = 0;
+
+/* 작업 스레드를 종료해야 하는지 여부 */
+static bool shouldJobWorkersExit = false;
+
+/* Private Function Prototypes ============================================= */
+
+/* 작업 스레드의 최대 개수를 반환하는 함수 */
+static int GetJobWorkerCount(void);
+
+/* 현재 스레드의 작업 큐를 반환하는 함수 */
+static JobQueue *GetCurrentJobQueue(void);
+
+/* 작업 큐의 아래쪽에 작업을 넣는 함수 (주인 스레드 전용) */
+static bool PushJob(JobQueue *queue, Job job);
+
+/* 작업 큐의 아래쪽에서 작업을 꺼내는 함수 (주인 스레드 전용) */
+static bool PopJob(JobQueue *queue, Job *job);
+
+/* 다른 스레드의 작업 큐 위쪽에서 작업을 훔쳐오는 함수 */
+static bool StealJob(int queueIndex, Job *job);
+
+/* 작업을 실행하고, 남은 작업의 개수를 줄이는 함수 */
+static void RunJob(const Job *job);
+
+/* 작업 스레드에서 실행되는 함수 */
+static void *RunJobWorker(void *arg);
+
+/* Public Functions ======================================================== */
+
+/* 작업 스레드들을 초기화하는 함수 */
+void InitJobSystem(void) {
+    int workerCount = GetJobWorkerCount();
+
+    shouldJobWorkersExit = false;
+
+    /*
+        NOTE: `ParallelFor()`를 호출한 스레드도 작업을 처리하므로 하나를 덜 만들고,
+        스레드를 만들 수 없는 환경에서는 호출한 스레드가 모든 작업을 처리함
+    */
+    for (int i = 0; i < workerCount - 1; i++) {
+        if (pthread_create(&jobWorkers[jobWorkerCount],
+                           NULL,
+                           RunJobWorker,
+                           (void *) (size_t) jobWorkerCount)
+            != 0)
+            break;
+
+        jobWorkerCount++;
+    }
+
+    TraceLog(LOG_INFO, "JOB: Started %d worker thread(s)", jobWorkerCount);
+}
+
+/* `func`를 `count`번 병렬로 실행하고, 모두 끝날 때까지 기다리는 함수 */
+void ParallelFor(int count, JobFunc func, void *userData) {
+    if (count <= 0 || func == NULL) return;
+
+    JobQueue *queue = GetCurrentJobQueue();
+
+    int pendingCount = count;
+
+    for (int i = 0; i < count; i++) {
+        Job job = { .func = func,
+                    .userData = userData,
+                    .index = i,
+                    .pendingCount = &pendingCount };
+
+        // 작업 큐가 가득 찼다면, 현재 스레드에서 바로 처리
+        if (!PushJob(queue, job)) RunJob(&job);
+    }
+
+    if (jobWorkerCount > 0) {
+        pthread_mutex_lock(&jobMutex);
+
+        __atomic_add_fetch(&jobGeneration, 1, __ATOMIC_RELEASE);
+
+        pthread_cond_broadcast(&jobCond);
+
+        pthread_mutex_unlock(&jobMutex);
+    }
+
+    int queueIndex = queue - jobQueues;
+
+    // NOTE: 기다리는 동안에도 남은 작업을 처리하므로, 작업 안에서 다시 호출해도 됨
+    while (__atomic_load_n(&pendingCount, __ATOMIC_ACQUIRE) > 0) {
+        Job job;
+
+        if (PopJob(queue, &job) || StealJob(queueIndex, &job))
+            RunJob(&job);
+        else
+            sched_yield();
+    }
+}
+
+/* 작업 스레드들을 종료하는 함수 */
+void DeinitJobSystem(void) {
+    pthread_mutex_lock(&jobMutex);
+
+    shouldJobWorkersExit = true;
+
+    pthread_cond_broadcast(&jobCond);
+
+    pthread_mutex_unlock(&jobMutex);
+
+    for (int i = 0; i < jobWorkerCount; i++)
+        pthread_join(jobWorkers[i], NULL);
+
+    jobWorkerCount = 0;
+}
+
+/* Private Functions ======================================================= */
+
+/* 작업 스레드의 최대 개수를 반환하는 함수 */
+static int GetJobWorkerCount(void) {
+    int workerCount = 1;
+
+#ifdef _SC_NPROCESSORS_ONLN
+    workerCount = (int) sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    if (workerCount < 1) workerCount = 1;
+
+    if (workerCount > JOB_MAX_WORKER_COUNT + 1)
+        workerCount = JOB_MAX_WORKER_COUNT + 1;
+
+    return workerCount;
+}
+
+/* 현재 스레드의 작업 큐를 반환하는 함수 */
+static JobQueue *GetCurrentJobQueue(void) {
+    /*
+        NOTE: 작업 스레드가 아닌 스레드는 마지막 작업 큐를 함께 사용하므로,
+        작업 스레드 밖에서는 한 번에 한 스레드만 (`UpdateFrameSnapshot()`에서) 호출해야 함
+    */
+    return &jobQueues[(jobQueueIndex >= 0) ? jobQueueIndex
+                                           : JOB_MAX_WORKER_COUNT];
+}
+
+/* 작업 큐의 아래쪽에 작업을 넣는 함수 (주인 스레드 전용) */
+static bool PushJob(JobQueue *queue, Job job) {
+    long bottom = __atomic_load_n(&queue->bottom, __ATOMIC_RELAXED);
+    long top = __atomic_load_n(&queue->top, __ATOMIC_ACQUIRE);
+
+    if (bottom - top >= JOB_QUEUE_CAPACITY) return false;
+
+    queue->jobs[bottom & JOB_QUEUE_MASK] = job;
+
+    // NOTE: 작업을 먼저 기록한 다음, 다른 스레드에 보이도록 위치를 옮김
+    __atomic_store_n(&queue->bottom, bottom + 1, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+/* 작업 큐의 아래쪽에서 작업을 꺼내는 함수 (주인 스레드 전용) */
+static bool PopJob(JobQueue *queue, Job *job) {
+    long bottom = __atomic_load_n(&queue->bottom, __ATOMIC_RELAXED) - 1;
+
+    __atomic_store_n(&queue->bottom, bottom, __ATOMIC_RELAXED);
+
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    long top = __atomic_load_n(&queue->top, __ATOMIC_RELAXED);
+
+    if (top > bottom) {
+        // 작업 큐가 비어 있음
+        __atomic_store_n(&queue->bottom, bottom + 1, __ATOMIC_RELAXED);
+
+        return false;
+    }
+
+    *job = queue->jobs[bottom & JOB_QUEUE_MASK];
+
+    if (top < bottom) return true;
+
+    // NOTE: 마지막 작업은 훔쳐가려는 스레드와 경쟁하므로, 위쪽 위치를 함께 옮김
+    bool result = __atomic_compare_exchange_n(&queue->top,
+                                              &top,
+                                              top + 1,
+                                              false,
+                                              __ATOMIC_SEQ_CST,
+                                              __ATOMIC_RELAXED);
+
+    __atomic_store_n(&queue->bottom, bottom + 1, __ATOMIC_RELAXED);
+
+    return result;
+}
+
+/* 다른 스레드의 작업 큐 위쪽에서 작업을 훔쳐오는 함수 */
+static bool StealJob(int queueIndex, Job *job) {
+    const int queueCount = JOB_MAX_WORKER_COUNT + 1;
+
+    for (int i = 1; i < queueCount; i++) {
+        JobQueue *queue = &jobQueues[(queueIndex + i) % queueCount];
+
+        long top = __atomic_load_n(&queue->top, __ATOMIC_ACQUIRE);
+
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+        long bottom = __atomic_load_n(&queue->bottom, __ATOMIC_ACQUIRE);
+
+        if (top >= bottom) continue;
+
+        Job result = queue->jobs[top & JOB_QUEUE_MASK];
+
+        // 다른 스레드가 먼저 가져갔다면, 다음 작업 큐를 확인
+        if (!__atomic_compare_exchange_n(&queue->top,
+                                         &top,
+                                         top + 1,
+                                         false,
+                                         __ATOMIC_SEQ_CST,
+                                         __ATOMIC_RELAXED))
+            continue;
+
+        *job = result;
+
+        return true;
+    }
+
+    return false;
+}
+
+/* 작업을 실행하고, 남은 작업의 개수를 줄이는 함수 */
+static void RunJob(const Job *job) {
+    job->func(job->userData, job->index);
+
+    __atomic_sub_fetch(job->pendingCount, 1, __ATOMIC_ACQ_REL);
+}
+
+/* 작업 스레드에서 실행되는 함수 */
+static void *RunJobWorker(void *arg) {
+    jobQueueIndex = (int) (size_t) arg;
+
+    JobQueue *queue = &jobQueues[jobQueueIndex];
+
+    for (;;) {
+        // NOTE: 작업 큐를 확인하기 전의 값과 비교하여, 깨우는 신호를 놓치지 않음
+        unsigned int generation = __atomic_load_n(&jobGeneration,
+                                                  __ATOMIC_ACQUIRE);
+
+        Job job;
+
+        if (PopJob(queue, &job) || StealJob(jobQueueIndex, &job)) {
+            RunJob(&job);
+
+            continue;
+        }
+
+        pthread_mutex_lock(&jobMutex);
+
+        while (jobGeneration == generation && !shouldJobWorkersExit)
+            pthread_cond_wait(&jobCond, &jobMutex);
+
+        bool shouldExit = shouldJobWorkersExit;
+
+        pthread_mutex_unlock(&jobMutex);
+
+        if (shouldExit) break;
+    }
+
+    return NULL;
+}
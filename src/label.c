@@ -0,0 +1,519 @@
+/*
+    Copyright (c) 2024 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ================================================================ */
+
+#include "mvp-demo.h"
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+/* Macro Constants ========================================================= */
+
+// clang-format off
+
+/* 문자열 상자를 분류할 격자 칸의 최소 크기 (픽셀) */
+#define LABEL_GRID_CELL_SIZE                16
+
+/* 격자의 가로 및 세로 방향 칸의 최대 개수 */
+#define LABEL_GRID_MAX_DIMENSION            256
+
+/* 격자 칸의 최대 개수 */
+#define LABEL_GRID_CELL_CAPACITY            (LABEL_GRID_MAX_DIMENSION \
+                                             * LABEL_GRID_MAX_DIMENSION)
+
+/* 문자열 상자 하나당 격자에 기록할 수 있는 (칸, 문자열 상자) 쌍의 평균 개수 */
+#define LABEL_GRID_NODES_PER_CANDIDATE      16
+
+/* 격자에 기록할 수 있는 (칸, 문자열 상자) 쌍의 최소 개수 */
+#define LABEL_GRID_MIN_NODE_CAPACITY        4096
+
+/* 문자열 상자를 거리 순으로 정렬할 때 사용할 구간의 개수 */
+#define LABEL_DEPTH_BUCKET_COUNT            1024
+
+/* 문자열 상자 사이의 최소 간격 (픽셀) */
+#define LABEL_PADDING                       2.0f
+
+// clang-format on
+
+/* Typedefs ================================================================ */
+
+/* 문자열 상자를 배치할 위치 */
+typedef enum LabelPlacement_ {
+    LABEL_PLACEMENT_BELOW,
+    LABEL_PLACEMENT_ABOVE,
+    LABEL_PLACEMENT_RIGHT,
+    LABEL_PLACEMENT_LEFT,
+    LABEL_PLACEMENT_COUNT_
+} LabelPlacement;
+
+/* 화면에 배치할 문자열 상자 */
+typedef struct LabelCandidate_ {
+    Vector2 anchor;  // 문자열 상자가 가리키는 화면 좌표
+    Vector2 size;    // 문자열 상자의 크기
+    float offset;    // `anchor`와 문자열 상자 사이의 거리
+    float depth;     // 카메라와의 거리 (작을수록 먼저 배치)
+    Rectangle rec;   // 배치된 문자열 상자의 영역 (여백 포함)
+    bool isPlaced;   // 문자열 상자가 배치되었는지 여부
+} LabelCandidate;
+
+/* 격자의 한 칸에 기록된 문자열 상자 */
+typedef struct LabelGridNode_ {
+    Vector2 min;  // 문자열 상자 영역의 왼쪽 위 좌표 (여백 포함)
+    Vector2 max;  // 문자열 상자 영역의 오른쪽 아래 좌표 (여백 포함)
+    int next;     // 같은 칸에 기록된 다음 노드의 번호 (-1: 없음)
+} LabelGridNode;
+
+/*
+    NOTE: 각 스레드가 서로 다른 레이블 배치 상태를 사용할 수 있도록,
+    모든 상태를 전역 변수 대신 이 구조체에 저장함
+*/
+
+/* 문자열 상자를 겹치지 않게 배치하는 레이블 배치 상태 */
+struct LabelLayout_ {
+    LabelCandidate *candidates;                      // 배치할 문자열 상자 목록
+    int *order;                                      // 거리 순으로 정렬된 번호
+    int candidateCount;                              // 문자열 상자의 개수
+    int candidateCapacity;                           // 문자열 상자의 최대 개수
+    int bucketStarts[LABEL_DEPTH_BUCKET_COUNT + 1];  // 각 구간이 시작하는 위치
+    int gridHeads[LABEL_GRID_CELL_CAPACITY];         // 각 칸의 첫 번째 노드 번호
+    LabelGridNode *gridNodes;                        // 격자에 기록된 노드 목록
+    int gridNodeCount;                               // 격자에 기록된 노드의 개수
+    int gridNodeCapacity;                            // 격자 노드의 최대 개수
+    int gridColumns, gridRows;                       // 격자의 가로 및 세로 칸 개수
+    float gridInverseCellSize;                       // 격자 칸 크기 (픽셀)의 역수
+    Vector2 screenSize;                              // 문자열 상자를 배치할 화면의 크기
+    bool isOverflowReported;                         // 너무 많다는 경고의 출력 여부
+};
+
+/* Private Function Prototypes ============================================= */
+
+/* `candidate`를 `placement` 위치에 배치했을 때의 영역을 반환하는 함수 */
+static Rectangle ComputeLabelRec(const LabelCandidate *candidate,
+                                 LabelPlacement placement);
+
+/* `rec`과 겹치는 격자 칸의 범위를 계산하는 함수 */
+static bool GetLabelGridRange(const LabelLayout *layout,
+                              Rectangle rec,
+                              int *minX,
+                              int *minY,
+                              int *maxX,
+                              int *maxY);
+
+/* 카메라와의 거리가 `depth`인 문자열 상자가 속할 구간을 반환하는 함수 */
+static int GetLabelDepthBucket(float depth, float minDepth, float depthScale);
+
+/* `point`가 이미 배치된 문자열 상자에 가려졌는지 확인하는 함수 */
+static bool IsLabelPointOccupied(const LabelLayout *layout, Vector2 point);
+
+/* `rec`이 이미 배치된 문자열 상자와 겹치는지 확인하는 함수 */
+static bool IsLabelRecOccupied(const LabelLayout *layout, Rectangle rec);
+
+/* `index`번째 문자열 상자를 격자에 기록하는 함수 */
+static bool InsertLabelRec(LabelLayout *layout, int index);
+
+/* 문자열 상자들을 카메라와의 거리 순으로 정렬하는 함수 */
+static void SortLabelCandidates(LabelLayout *layout);
+
+/* Public Functions ======================================================== */
+
+/* 문자열 상자를 최대 `capacity`개까지 배치할 수 있는 레이블 배치 상태를 만드는 함수 */
+LabelLayout *LoadLabelLayout(int capacity) {
+    if (capacity <= 0) return NULL;
+
+    LabelLayout *layout = RL_CALLOC(1, sizeof *layout);
+
+    if (layout == NULL) return NULL;
+
+    layout->candidateCapacity = capacity;
+    layout->gridNodeCapacity = LABEL_GRID_NODES_PER_CANDIDATE * capacity;
+
+    // NOTE: 문자열 상자가 적더라도, 각 상자가 여러 칸에 걸칠 수 있도록 함
+    if (layout->gridNodeCapacity < LABEL_GRID_MIN_NODE_CAPACITY)
+        layout->gridNodeCapacity = LABEL_GRID_MIN_NODE_CAPACITY;
+
+    layout->candidates = RL_MALLOC(capacity * sizeof *(layout->candidates));
+    layout->order = RL_MALLOC(capacity * sizeof *(layout->order));
+
+    layout->gridNodes = RL_MALLOC(layout->gridNodeCapacity
+                                  * sizeof *(layout->gridNodes));
+
+    if (layout->candidates == NULL || layout->order == NULL
+        || layout->gridNodes == NULL) {
+        TraceLog(LOG_WARNING,
+                 "LABEL: Failed to allocate layout for %d labels",
+                 capacity);
+
+        UnloadLabelLayout(layout);
+
+        return NULL;
+    }
+
+    layout->gridColumns = layout->gridRows = 1;
+    layout->gridInverseCellSize = 1.0f / LABEL_GRID_CELL_SIZE;
+
+    return layout;
+}
+
+/* 레이블 배치 상태에 할당된 메모리 공간을 해제하는 함수 */
+void UnloadLabelLayout(LabelLayout *layout) {
+    if (layout == NULL) return;
+
+    RL_FREE(layout->candidates);
+    RL_FREE(layout->order);
+    RL_FREE(layout->gridNodes);
+
+    RL_FREE(layout);
+}
+
+/* `width` x `height` 크기의 화면에 문자열 상자를 배치하기 시작하는 함수 */
+void BeginLabelLayout(LabelLayout *layout, int width, int height) {
+    if (layout == NULL) return;
+
+    layout->candidateCount = 0;
+
+    layout->screenSize = (Vector2) { .x = width, .y = height };
+
+    // NOTE: 화면이 크더라도 격자 칸의 개수가 일정 수준을 넘지 않도록 조정
+    int maxSize = (width > height) ? width : height;
+
+    int cellSize = (maxSize + LABEL_GRID_MAX_DIMENSION - 1)
+                   / LABEL_GRID_MAX_DIMENSION;
+
+    if (cellSize < LABEL_GRID_CELL_SIZE) cellSize = LABEL_GRID_CELL_SIZE;
+
+    layout->gridInverseCellSize = 1.0f / cellSize;
+
+    layout->gridColumns = (width + cellSize - 1) / cellSize;
+    layout->gridRows = (height + cellSize - 1) / cellSize;
+
+    if (layout->gridColumns < 1) layout->gridColumns = 1;
+    if (layout->gridRows < 1) layout->gridRows = 1;
+}
+
+/* 배치할 문자열 상자를 추가하고, 그 번호를 반환하는 함수 */
+int AddLabelCandidate(LabelLayout *layout,
+                      Vector2 anchor,
+                      Vector2 size,
+                      float offset,
+                      float depth) {
+    if (layout == NULL) return -1;
+
+    if (layout->candidateCount >= layout->candidateCapacity) {
+        if (!layout->isOverflowReported) {
+            TraceLog(LOG_WARNING,
+                     "LABEL: Too many labels in a single layout (%d)",
+                     layout->candidateCapacity);
+
+            layout->isOverflowReported = true;
+        }
+
+        return -1;
+    }
+
+    layout->candidates[layout->candidateCount] = (LabelCandidate) {
+        .anchor = anchor,
+        .size = size,
+        .offset = offset,
+        .depth = depth
+    };
+
+    return layout->candidateCount++;
+}
+
+/* 카메라와 가까운 문자열 상자부터 겹치지 않는 위치에 배치하는 함수 */
+void EndLabelLayout(LabelLayout *layout) {
+    if (layout == NULL) return;
+
+    SortLabelCandidates(layout);
+
+    for (int i = 0; i < layout->gridColumns * layout->gridRows; i++)
+        layout->gridHeads[i] = -1;
+
+    layout->gridNodeCount = 0;
+
+    for (int i = 0; i < layout->candidateCount; i++) {
+        int index = layout->order[i];
+
+        LabelCandidate *candidate = &layout->candidates[index];
+
+        // NOTE: 가리키는 지점이 이미 다른 문자열 상자에 가려졌다면, 바로 생략
+        if (IsLabelPointOccupied(layout, candidate->anchor)) continue;
+
+        // 기본 위치에 배치할 수 없다면, 다른 위치에 배치하고 그래도 안 되면 생략
+        for (int j = 0; j < LABEL_PLACEMENT_COUNT_; j++) {
+            Rectangle rec = ComputeLabelRec(candidate, j);
+
+            if (IsLabelRecOccupied(layout, rec)) continue;
+
+            candidate->rec = rec;
+
+            candidate->isPlaced = InsertLabelRec(layout, index);
+
+            break;
+        }
+    }
+}
+
+/* `index`번째 문자열 상자가 배치된 위치를 반환하는 함수 */
+bool GetLabelPosition(const LabelLayout *layout,
+                      int index,
+                      Vector2 *position) {
+    if (layout == NULL || index < 0 || index >= layout->candidateCount)
+        return false;
+
+    const LabelCandidate *candidate = &layout->candidates[index];
+
+    if (!candidate->isPlaced) return false;
+
+    if (position != NULL)
+        *position = (Vector2) { .x = candidate->rec.x + LABEL_PADDING,
+                                .y = candidate->rec.y + LABEL_PADDING };
+
+    return true;
+}
+
+/* Private Functions ======================================================= */
+
+/* `candidate`를 `placement` 위치에 배치했을 때의 영역을 반환하는 함수 */
+static Rectangle ComputeLabelRec(const LabelCandidate *candidate,
+                                 LabelPlacement placement) {
+    Vector2 position = candidate->anchor;
+
+    switch (placement) {
+        case LABEL_PLACEMENT_BELOW:
+            position.x -= 0.5f * candidate->size.x;
+            position.y += candidate->offset;
+
+            break;
+
+        case LABEL_PLACEMENT_ABOVE:
+            position.x -= 0.5f * candidate->size.x;
+            position.y -= candidate->offset + candidate->size.y;
+
+            break;
+
+        case LABEL_PLACEMENT_RIGHT:
+            position.x += candidate->offset;
+            position.y -= 0.5f * candidate->size.y;
+
+            break;
+
+        case LABEL_PLACEMENT_LEFT:
+            position.x -= candidate->offset + candidate->size.x;
+            position.y -= 0.5f * candidate->size.y;
+
+            break;
+
+        default:
+            break;
+    }
+
+    return (Rectangle) { .x = position.x - LABEL_PADDING,
+                         .y = position.y - LABEL_PADDING,
+                         .width = candidate->size.x + 2.0f * LABEL_PADDING,
+                         .height = candidate->size.y + 2.0f * LABEL_PADDING };
+}
+
+/* `rec`과 겹치는 격자 칸의 범위를 계산하는 함수 */
+static bool GetLabelGridRange(const LabelLayout *layout,
+                              Rectangle rec,
+                              int *minX,
+                              int *minY,
+                              int *maxX,
+                              int *maxY) {
+    // NOTE: 화면 밖에 있는 문자열 상자는 배치하지 않음
+    if (rec.x + rec.width <= 0.0f || rec.y + rec.height <= 0.0f
+        || rec.x >= layout->screenSize.x || rec.y >= layout->screenSize.y)
+        return false;
+
+    float inverseCellSize = layout->gridInverseCellSize;
+
+    *minX = (rec.x > 0.0f) ? (int) (rec.x * inverseCellSize) : 0;
+    *minY = (rec.y > 0.0f) ? (int) (rec.y * inverseCellSize) : 0;
+
+    *maxX = (int) ((rec.x + rec.width) * inverseCellSize);
+    *maxY = (int) ((rec.y + rec.height) * inverseCellSize);
+
+    if (*maxX >= layout->gridColumns) *maxX = layout->gridColumns - 1;
+    if (*maxY >= layout->gridRows) *maxY = layout->gridRows - 1;
+
+    return true;
+}
+
+/* 카메라와의 거리가 `depth`인 문자열 상자가 속할 구간을 반환하는 함수 */
+static int GetLabelDepthBucket(float depth, float minDepth, float depthScale) {
+    /*
+        NOTE: `NaN`이나 무한대처럼 올바르지 않은 거리 값은 가장 먼 것으로 보고
+        마지막 구간에 넣으며, 부동 소수점 수를 정수로 바꾸기 전에 확인해야 함
+    */
+    if (!isfinite(depth) || depth < minDepth)
+        return LABEL_DEPTH_BUCKET_COUNT - 1;
+
+    float result = (depth - minDepth) * depthScale;
+
+    return (result < LABEL_DEPTH_BUCKET_COUNT - 1)
+               ? (int) result
+               : LABEL_DEPTH_BUCKET_COUNT - 1;
+}
+
+/* `point`가 이미 배치된 문자열 상자에 가려졌는지 확인하는 함수 */
+static bool IsLabelPointOccupied(const LabelLayout *layout, Vector2 point) {
+    // NOTE: 화면 밖에 있는 지점은 가려진 것으로 봄
+    if (point.x < 0.0f || point.y < 0.0f || point.x >= layout->screenSize.x
+        || point.y >= layout->screenSize.y)
+        return true;
+
+    int x = point.x * layout->gridInverseCellSize;
+    int y = point.y * layout->gridInverseCellSize;
+
+    if (x >= layout->gridColumns) x = layout->gridColumns - 1;
+    if (y >= layout->gridRows) y = layout->gridRows - 1;
+
+    const LabelGridNode *gridNodes = layout->gridNodes;
+
+    // NOTE: 한 지점은 한 칸에만 속하므로, 그 칸만 확인하면 충분함
+    for (int node = layout->gridHeads[y * layout->gridColumns + x];
+         node >= 0;
+         node = gridNodes[node].next) {
+        const LabelGridNode *other = &gridNodes[node];
+
+        if (other->min.x <= point.x && point.x < other->max.x
+            && other->min.y <= point.y && point.y < other->max.y)
+            return true;
+    }
+
+    return false;
+}
+
+/* `rec`이 이미 배치된 문자열 상자와 겹치는지 확인하는 함수 */
+static bool IsLabelRecOccupied(const LabelLayout *layout, Rectangle rec) {
+    int minX, minY, maxX, maxY;
+
+    if (!GetLabelGridRange(layout, rec, &minX, &minY, &maxX, &maxY))
+        return true;
+
+    /*
+        NOTE: 반복문 안에서 `layout`을 통해 다시 읽지 않도록 지역 변수에 옮기고,
+        노드에는 오른쪽 아래 좌표를 미리 계산해두어 비교만 하도록 함
+    */
+    const int *gridHeads = layout->gridHeads;
+    const LabelGridNode *gridNodes = layout->gridNodes;
+
+    const int gridColumns = layout->gridColumns;
+
+    const Vector2 recMin = { .x = rec.x, .y = rec.y };
+    const Vector2 recMax = { .x = rec.x + rec.width,
+                             .y = rec.y + rec.height };
+
+    for (int y = minY; y <= maxY; y++)
+        for (int x = minX; x <= maxX; x++)
+            for (int node = gridHeads[y * gridColumns + x];
+                 node >= 0;
+                 node = gridNodes[node].next) {
+                const LabelGridNode *other = &gridNodes[node];
+
+                if (recMin.x < other->max.x && other->min.x < recMax.x
+                    && recMin.y < other->max.y && other->min.y < recMax.y)
+                    return true;
+            }
+
+    return false;
+}
+
+/* `index`번째 문자열 상자를 격자에 기록하는 함수 */
+static bool InsertLabelRec(LabelLayout *layout, int index) {
+    int minX, minY, maxX, maxY;
+
+    const Rectangle rec = layout->candidates[index].rec;
+
+    if (!GetLabelGridRange(layout, rec, &minX, &minY, &maxX, &maxY))
+        return false;
+
+    int nodeCount = (maxX - minX + 1) * (maxY - minY + 1);
+
+    // NOTE: 격자에 기록할 공간이 부족하다면, 문자열 상자를 생략
+    if (layout->gridNodeCount + nodeCount > layout->gridNodeCapacity)
+        return false;
+
+    for (int y = minY; y <= maxY; y++)
+        for (int x = minX; x <= maxX; x++) {
+            int *head = &layout->gridHeads[y * layout->gridColumns + x];
+
+            layout->gridNodes[layout->gridNodeCount] = (LabelGridNode) {
+                .min = { .x = rec.x, .y = rec.y },
+                .max = { .x = rec.x + rec.width, .y = rec.y + rec.height },
+                .next = *head
+            };
+
+            *head = layout->gridNodeCount++;
+        }
+
+    return true;
+}
+
+/* 문자열 상자들을 카메라와의 거리 순으로 정렬하는 함수 */
+static void SortLabelCandidates(LabelLayout *layout) {
+    const LabelCandidate *candidates = layout->candidates;
+
+    int *bucketStarts = layout->bucketStarts;
+
+    float minDepth = FLT_MAX, maxDepth = -FLT_MAX;
+
+    for (int i = 0; i < layout->candidateCount; i++) {
+        float depth = candidates[i].depth;
+
+        // NOTE: 올바르지 않은 거리 값이 구간의 범위를 바꾸지 않도록 함
+        if (!isfinite(depth)) continue;
+
+        if (minDepth > depth) minDepth = depth;
+        if (maxDepth < depth) maxDepth = depth;
+    }
+
+    float depthScale = (maxDepth > minDepth)
+                           ? (LABEL_DEPTH_BUCKET_COUNT - 1)
+                                 / (maxDepth - minDepth)
+                           : 0.0f;
+
+    memset(layout->bucketStarts, 0, sizeof layout->bucketStarts);
+
+    // NOTE: 비교 정렬 대신 계수 정렬을 사용하여 O(n) 시간에 정렬
+    for (int i = 0; i < layout->candidateCount; i++) {
+        int bucket = GetLabelDepthBucket(candidates[i].depth,
+                                         minDepth,
+                                         depthScale);
+
+        bucketStarts[bucket + 1]++;
+    }
+
+    for (int i = 0; i < LABEL_DEPTH_BUCKET_COUNT; i++)
+        bucketStarts[i + 1] += bucketStarts[i];
+
+    for (int i = 0; i < layout->candidateCount; i++) {
+        int bucket = GetLabelDepthBucket(candidates[i].depth,
+                                         minDepth,
+                                         depthScale);
+
+        layout->order[bucketStarts[bucket]++] = i;
+    }
+}
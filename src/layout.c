@@ -0,0 +1,258 @@
+/*
+    Copyright (c) 2024 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ================================================================ */
+
+#include "mvp-demo.h"
+
+/* Private Function Prototypes ============================================= */
+
+/* GUI 레이아웃 노드가 원하는 크기를 반환하는 함수 */
+static Vector2 GetGuiLayoutNodeSize(const GuiLayoutNode *node);
+
+/* GUI 레이아웃 노드의 자식 노드들을 배치하는 함수 */
+static void ArrangeGuiLayoutNode(GuiLayout *layout, GuiLayoutNode *node);
+
+/* GUI 레이아웃 노드의 크기를 자식 노드들에 맞춰 계산하는 함수 */
+static void MeasureGuiLayoutNode(GuiLayout *layout, GuiLayoutNode *node);
+
+/* Public Functions ======================================================== */
+
+/* 노드 배열 `nodes`를 이용해 GUI 레이아웃을 초기화하는 함수 */
+void InitGuiLayout(GuiLayout *layout, GuiLayoutNode *nodes, int capacity) {
+    if (layout == NULL) return;
+
+    layout->nodes = nodes;
+    layout->count = 0;
+    layout->capacity = (nodes != NULL) ? capacity : 0;
+}
+
+/* GUI 레이아웃의 `parent`번째 노드에 자식 노드를 추가하고, 그 번호를 반환하는 함수 */
+int AddGuiLayoutNode(GuiLayout *layout, int parent, GuiLayoutNode node) {
+    if (layout == NULL) return -1;
+
+    // NOTE: 부모 노드의 번호는 항상 자식 노드의 번호보다 작아야 함
+    if ((parent >= layout->count) || ((parent < 0) && (layout->count > 0))) {
+        TraceLog(LOG_WARNING, "LAYOUT: Invalid parent node index: %d", parent);
+
+        return -1;
+    }
+
+    if (layout->count >= layout->capacity) {
+        TraceLog(LOG_WARNING,
+                 "LAYOUT: Failed to add node (%d / %d in use)",
+                 layout->count,
+                 layout->capacity);
+
+        return -1;
+    }
+
+    int index = layout->count++;
+
+    node.parent = parent;
+
+    node.firstChild = node.lastChild = node.nextSibling = -1;
+
+    node.fitSize = Vector2Zero(), node.bounds = (Rectangle) { 0 };
+
+    layout->nodes[index] = node;
+
+    if (parent >= 0) {
+        GuiLayoutNode *parentNode = &layout->nodes[parent];
+
+        if (parentNode->lastChild >= 0)
+            layout->nodes[parentNode->lastChild].nextSibling = index;
+        else
+            parentNode->firstChild = index;
+
+        parentNode->lastChild = index;
+    }
+
+    return index;
+}
+
+/* GUI 레이아웃의 모든 노드를 `bounds` 안에 배치하고, 위젯 영역을 계산하는 함수 */
+void SolveGuiLayout(GuiLayout *layout,
+                    Rectangle bounds,
+                    Rectangle *widgetAreas,
+                    int widgetCount) {
+    if (layout == NULL || layout->count <= 0) return;
+
+    /*
+        NOTE: 부모 노드는 항상 자식 노드보다 앞에 있으므로, 배열을 뒤에서부터
+        순회하면 크기를, 앞에서부터 순회하면 위치를 한 번에 계산할 수 있음
+    */
+    for (int i = layout->count - 1; i >= 0; i--)
+        MeasureGuiLayoutNode(layout, &layout->nodes[i]);
+
+    layout->nodes[0].bounds = bounds;
+
+    for (int i = 0; i < layout->count; i++)
+        ArrangeGuiLayoutNode(layout, &layout->nodes[i]);
+
+    if (widgetAreas == NULL) return;
+
+    for (int i = 0; i < layout->count; i++) {
+        const GuiLayoutNode *node = &layout->nodes[i];
+
+        if (node->widgetId <= 0 || node->widgetId >= widgetCount) continue;
+
+        widgetAreas[node->widgetId] = node->bounds;
+    }
+}
+
+/* Private Functions ======================================================= */
+
+/* GUI 레이아웃 노드가 원하는 크기를 반환하는 함수 */
+static Vector2 GetGuiLayoutNodeSize(const GuiLayoutNode *node) {
+    Vector2 result = Vector2Zero();
+
+    if (node->width.type == GUI_LAYOUT_SIZE_FIXED)
+        result.x = node->width.value;
+    else if (node->width.type == GUI_LAYOUT_SIZE_FIT)
+        result.x = node->fitSize.x;
+
+    if (node->height.type == GUI_LAYOUT_SIZE_FIXED)
+        result.y = node->height.value;
+    else if (node->height.type == GUI_LAYOUT_SIZE_FIT)
+        result.y = node->fitSize.y;
+
+    return result;
+}
+
+/* GUI 레이아웃 노드의 자식 노드들을 배치하는 함수 */
+static void ArrangeGuiLayoutNode(GuiLayout *layout, GuiLayoutNode *node) {
+    if (node->firstChild < 0) return;
+
+    bool isRow = (node->direction == GUI_LAYOUT_ROW);
+
+    Rectangle contentArea = {
+        .x = node->bounds.x + node->padding.left,
+        .y = node->bounds.y + node->padding.top,
+        .width = (node->bounds.width - node->padding.left)
+                 - node->padding.right,
+        .height = (node->bounds.height - node->padding.top)
+                  - node->padding.bottom
+    };
+
+    float contentMainSize = isRow ? contentArea.width : contentArea.height;
+    float contentCrossSize = isRow ? contentArea.height : contentArea.width;
+
+    float usedSize = 0.0f, totalWeight = 0.0f;
+
+    int childCount = 0;
+
+    for (int i = node->firstChild; i >= 0; i = layout->nodes[i].nextSibling) {
+        const GuiLayoutNode *child = &layout->nodes[i];
+
+        GuiLayoutSize mainSize = isRow ? child->width : child->height;
+
+        if (mainSize.type == GUI_LAYOUT_SIZE_WEIGHT) {
+            totalWeight += mainSize.value;
+        } else {
+            Vector2 childSize = GetGuiLayoutNodeSize(child);
+
+            usedSize += isRow ? childSize.x : childSize.y;
+        }
+
+        childCount++;
+    }
+
+    usedSize += (childCount - 1) * node->spacing;
+
+    // 고정된 크기의 자식 노드들을 배치하고 남은 공간
+    float remainingSize = fmaxf(contentMainSize - usedSize, 0.0f);
+
+    float mainOffset = 0.0f;
+
+    for (int i = node->firstChild; i >= 0; i = layout->nodes[i].nextSibling) {
+        GuiLayoutNode *child = &layout->nodes[i];
+
+        GuiLayoutSize mainSize = isRow ? child->width : child->height;
+        GuiLayoutSize crossSize = isRow ? child->height : child->width;
+
+        Vector2 childSize = GetGuiLayoutNodeSize(child);
+
+        float childMainSize = isRow ? childSize.x : childSize.y;
+        float childCrossSize = isRow ? childSize.y : childSize.x;
+
+        if (mainSize.type == GUI_LAYOUT_SIZE_WEIGHT)
+            childMainSize = (totalWeight > 0.0f)
+                                ? remainingSize * (mainSize.value / totalWeight)
+                                : 0.0f;
+
+        if ((crossSize.type == GUI_LAYOUT_SIZE_WEIGHT)
+            || ((crossSize.type == GUI_LAYOUT_SIZE_FIT)
+                && (node->alignment == GUI_LAYOUT_ALIGN_STRETCH)))
+            childCrossSize = contentCrossSize;
+
+        float crossOffset = (node->alignment == GUI_LAYOUT_ALIGN_CENTER)
+                                ? 0.5f * (contentCrossSize - childCrossSize)
+                                : 0.0f;
+
+        if (isRow) {
+            child->bounds = (Rectangle) { .x = contentArea.x + mainOffset,
+                                          .y = contentArea.y + crossOffset,
+                                          .width = childMainSize,
+                                          .height = childCrossSize };
+        } else {
+            child->bounds = (Rectangle) { .x = contentArea.x + crossOffset,
+                                          .y = contentArea.y + mainOffset,
+                                          .width = childCrossSize,
+                                          .height = childMainSize };
+        }
+
+        mainOffset += childMainSize + node->spacing;
+    }
+}
+
+/* GUI 레이아웃 노드의 크기를 자식 노드들에 맞춰 계산하는 함수 */
+static void MeasureGuiLayoutNode(GuiLayout *layout, GuiLayoutNode *node) {
+    bool isRow = (node->direction == GUI_LAYOUT_ROW);
+
+    float mainSize = 0.0f, crossSize = 0.0f;
+
+    int childCount = 0;
+
+    for (int i = node->firstChild; i >= 0; i = layout->nodes[i].nextSibling) {
+        Vector2 childSize = GetGuiLayoutNodeSize(&layout->nodes[i]);
+
+        float childMainSize = isRow ? childSize.x : childSize.y;
+        float childCrossSize = isRow ? childSize.y : childSize.x;
+
+        mainSize += childMainSize;
+
+        if (crossSize < childCrossSize) crossSize = childCrossSize;
+
+        childCount++;
+    }
+
+    if (childCount > 1) mainSize += (childCount - 1) * node->spacing;
+
+    float paddingWidth = node->padding.left + node->padding.right;
+    float paddingHeight = node->padding.top + node->padding.bottom;
+
+    node->fitSize = isRow ? (Vector2) { .x = mainSize + paddingWidth,
+                                        .y = crossSize + paddingHeight }
+                          : (Vector2) { .x = crossSize + paddingWidth,
+                                        .y = mainSize + paddingHeight };
+}
@@ -33,15 +33,21 @@
 
 /* Public Functions ======================================================== */
 
-int main(void) {
+int main(int argc, char *argv[]) {
 #ifndef PLATFORM_WEB
     // MSAA 4x 안티-에일리어싱 (anti-aliasing) 기능 활성화
     SetConfigFlags(FLAG_MSAA_4X_HINT);
 #endif
 
+    // 게임 창의 크기 조절 기능 활성화
+    SetConfigFlags(FLAG_WINDOW_RESIZABLE);
+
     // 게임 창 생성 및 OpenGL 컨텍스트 (context) 초기화
     InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, WINDOW_TITLE);
 
+    // 게임 창의 최소 크기 설정
+    SetWindowMinSize(SCREEN_MIN_WIDTH, SCREEN_MIN_HEIGHT);
+
     // 종료 키 설정 (비활성화)
     SetExitKey(KEY_NULL);
 
@@ -49,18 +55,33 @@ int main(void) {
     SetTargetFPS(TARGET_FPS);
 
     {
+        // 입력 기록 또는 재생 모드 설정 (`--record <file>`, `--replay <file>`)
+        for (int i = 1; i + 1 < argc; i++) {
+            if (TextIsEqual(argv[i], "--record"))
+                BeginReplayRecording(argv[++i]);
+            else if (TextIsEqual(argv[i], "--replay"))
+                BeginReplayPlayback(argv[++i]);
+        }
+
         InitGameScreen();
 
+        // 장면 스냅샷 불러오기 (`--snapshot <file>`)
+        for (int i = 1; i + 1 < argc; i++)
+            if (TextIsEqual(argv[i], "--snapshot")) LoadGameSnapshot(argv[++i]);
+
 #ifdef PLATFORM_WEB
         emscripten_set_main_loop(UpdateGameScreen, 0, 1);
 #else
-        SetTargetFPS(TARGET_FPS);
+        // NOTE: 입력을 재생할 때는 성능 비교를 위해 FPS를 제한하지 않음
+        SetTargetFPS((GetReplayMode() == REPLAY_MODE_PLAY) ? 0 : TARGET_FPS);
 
         // 게임 창의 '닫기' 버튼 또는 'ESC' 키가 눌리기 전까지...
-        while (!WindowShouldClose())
+        while (!WindowShouldClose() && !IsReplayFinished())
             UpdateGameScreen();
 #endif
 
+        EndReplay();
+
         DeinitGameScreen();
     }
 
@@ -0,0 +1,1690 @@
+/*
+    Copyright (c) 2024 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ================================================================ */
+
+#include "mvp-demo.h"
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32) && !defined(PLATFORM_WEB)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+
+    #define MESH_USE_MMAP
+#endif
+
+/* Macro Constants ========================================================= */
+
+// clang-format off
+
+/* 메시 파일 경로의 최대 길이 */
+#define MESH_FILE_NAME_LENGTH               512
+
+/* 메시 파일을 읽을 때 사용하는 작업 스레드의 최대 개수 */
+#define MESH_IMPORT_MAX_THREAD_COUNT        16
+
+/* 작업 스레드 하나가 처리할 OBJ 파일의 최소 크기 (바이트) */
+#define MESH_IMPORT_MIN_CHUNK_SIZE          (256 * 1024)
+
+/* 메시 하나에 저장할 수 있는 정점의 최대 개수 (`unsigned short` 인덱스) */
+#define MESH_MAX_VERTEX_COUNT               65535
+
+/* OBJ 파일의 음수 (상대) 인덱스를 임시로 저장할 때 더하는 값 */
+#define OBJ_RELATIVE_INDEX_BIAS             (1 << 30)
+
+/* PLY 파일의 각 요소가 가질 수 있는 속성의 최대 개수 */
+#define PLY_MAX_PROPERTY_COUNT              32
+
+// clang-format on
+
+/* Typedefs ================================================================ */
+
+/* 메모리에 올린 메시 파일 */
+typedef struct MeshFile_ {
+    unsigned char *data;  // 파일의 내용
+    size_t size;          // 파일의 크기
+} MeshFile;
+
+/* 메시 파일에서 읽은 정점과 인덱스 데이터 */
+typedef struct MeshImportData_ {
+    float *positions;       // 정점의 위치 (3개씩)
+    float *texcoords;       // 정점의 텍스처 좌표 (2개씩, 없으면 `NULL`)
+    float *normals;         // 정점의 법선 벡터 (3개씩, 없으면 `NULL`)
+    unsigned char *colors;  // 정점의 색상 (4개씩, 없으면 `NULL`)
+    int vertexCount;        // 정점의 개수
+    unsigned int *indices;  // 삼각형의 인덱스 (3개씩)
+    int indexCount;         // 인덱스의 개수
+} MeshImportData;
+
+/* 작업 스레드 하나가 처리할 OBJ 파일의 범위와 그 결과 */
+typedef struct ObjChunk_ {
+    const char *begin, *end;  // 처리할 범위 (줄 단위로 정렬됨)
+    float *positions;         // `v` 요소
+    float *texcoords;         // `vt` 요소
+    float *normals;           // `vn` 요소
+    int *corners;             // `f` 요소의 각 꼭짓점 (`v/vt/vn` 인덱스)
+    int positionCount, positionCapacity;
+    int texcoordCount, texcoordCapacity;
+    int normalCount, normalCapacity;
+    int cornerCount, cornerCapacity;
+    bool failed;  // 메모리 할당 실패 여부
+} ObjChunk;
+
+/* PLY 파일의 속성 자료형 */
+typedef enum PlyType_ {
+    PLY_TYPE_NONE,
+    PLY_TYPE_INT8,
+    PLY_TYPE_UINT8,
+    PLY_TYPE_INT16,
+    PLY_TYPE_UINT16,
+    PLY_TYPE_INT32,
+    PLY_TYPE_UINT32,
+    PLY_TYPE_FLOAT32,
+    PLY_TYPE_FLOAT64
+} PlyType;
+
+/* PLY 파일에서 읽을 정점 속성의 종류 */
+typedef enum PlyTarget_ {
+    PLY_TARGET_NONE = -1,
+    PLY_TARGET_X,
+    PLY_TARGET_Y,
+    PLY_TARGET_Z,
+    PLY_TARGET_NX,
+    PLY_TARGET_NY,
+    PLY_TARGET_NZ,
+    PLY_TARGET_U,
+    PLY_TARGET_V,
+    PLY_TARGET_RED,
+    PLY_TARGET_GREEN,
+    PLY_TARGET_BLUE,
+    PLY_TARGET_COUNT_
+} PlyTarget;
+
+/* PLY 파일의 속성 */
+typedef struct PlyProperty_ {
+    PlyType type;       // 속성의 자료형 (리스트라면 각 원소의 자료형)
+    PlyType countType;  // 리스트의 길이를 나타내는 자료형 (리스트가 아니라면 없음)
+    PlyTarget target;   // 정점 속성의 종류
+    bool isIndexList;   // 면의 인덱스 리스트인지 여부
+    int offset;         // 정점 하나의 시작 위치에서 떨어진 거리 (바이트)
+} PlyProperty;
+
+/* PLY 파일의 헤더 */
+typedef struct PlyHeader_ {
+    bool isBinary;                                    // 바이너리 형식 여부
+    int vertexCount, faceCount;                       // 정점과 면의 개수
+    PlyProperty vertexProps[PLY_MAX_PROPERTY_COUNT];  // 정점의 속성
+    PlyProperty faceProps[PLY_MAX_PROPERTY_COUNT];    // 면의 속성
+    int vertexPropCount, facePropCount;               // 각 요소의 속성 개수
+    int vertexStride;                                 // 정점 하나의 크기 (바이트)
+    bool hasTarget[PLY_TARGET_COUNT_];                // 각 정점 속성의 존재 여부
+    size_t dataOffset;                                // 헤더 다음 위치
+} PlyHeader;
+
+/* 작업 스레드 하나가 처리할 PLY 파일의 정점 범위 */
+typedef struct PlyVertexJob_ {
+    const PlyHeader *header;     // PLY 파일의 헤더
+    const unsigned char *data;   // 첫 번째 정점의 시작 위치
+    int begin, end;              // 처리할 정점의 범위
+    MeshImportData *importData;  // 정점 데이터를 저장할 곳
+} PlyVertexJob;
+
+/* 메시 캐시에 저장된 메시 */
+typedef struct MeshCacheEntry_ {
+    char fileName[MESH_FILE_NAME_LENGTH];  // 메시 파일의 경로
+    Mesh *meshes;                          // GPU에 업로드된 메시
+    int meshCount;                         // 메시의 개수
+} MeshCacheEntry;
+
+/* Private Variables ======================================================= */
+
+/* 파일에서 불러온 메시를 공유하기 위한 메시 캐시 */
+static MeshCacheEntry meshCache[MESH_CACHE_CAPACITY];
+
+/* 메시 캐시에 저장된 메시의 개수 */
+static int meshCacheCount = 0;
+
+/* Private Function Prototypes ============================================= */
+
+/* 메모리에 올린 메시 파일을 해제하는 함수 */
+static void CloseMeshFile(MeshFile *file);
+
+/* 삼각형 인덱스로 각 정점의 법선 벡터를 계산하는 함수 */
+static bool ComputeImportNormals(MeshImportData *importData);
+
+/* 메시 데이터를 원점 중심의 크기 1인 정육면체에 맞추고, 색상을 정하는 함수 */
+static bool FinishMeshImport(MeshImportData *importData);
+
+/* 메시 파일에서 읽은 데이터를 해제하는 함수 */
+static void FreeMeshImportData(MeshImportData *importData);
+
+/* 작업 스레드의 최대 개수를 반환하는 함수 */
+static int GetImportThreadCount(void);
+
+/* PLY 파일의 속성 자료형의 크기 (바이트)를 반환하는 함수 */
+static int GetPlyTypeSize(PlyType type);
+
+/* OBJ 파일의 데이터를 읽는 함수 */
+static bool ImportObjMesh(const MeshFile *file, MeshImportData *importData);
+
+/* PLY 파일의 데이터를 읽는 함수 */
+static bool ImportPlyMesh(const MeshFile *file, MeshImportData *importData);
+
+/* 메시 파일을 메모리에 올리는 함수 */
+static bool OpenMeshFile(const char *fileName, MeshFile *file);
+
+/* 문자열에서 실수 하나를 읽는 함수 */
+static const char *ParseFloat(const char *ptr, const char *end, float *result);
+
+/* 문자열에서 정수 하나를 읽는 함수 */
+static const char *ParseInt(const char *ptr, const char *end, int *result);
+
+/* 작업 스레드에서 OBJ 파일의 일부를 읽는 함수 */
+static void *ParseObjChunk(void *arg);
+
+/* OBJ 파일의 `f` 요소에서 꼭짓점 하나를 읽는 함수 */
+static const char *ParseObjCorner(const ObjChunk *chunk,
+                                  const char *ptr,
+                                  const char *end,
+                                  int *corner);
+
+/* PLY 파일의 헤더를 읽는 함수 */
+static bool ParsePlyHeader(const MeshFile *file, PlyHeader *header);
+
+/* PLY 파일의 속성 자료형 이름을 해석하는 함수 */
+static PlyType ParsePlyType(const char *typeName);
+
+/* 작업 스레드에서 PLY 파일의 정점을 읽는 함수 */
+static void *ParsePlyVertices(void *arg);
+
+/* 바이너리 PLY 파일에서 값 하나를 읽는 함수 */
+static double ReadPlyValue(const unsigned char *ptr, PlyType type);
+
+/* 배열의 크기를 원소 `count`개 이상으로 늘리는 함수 */
+static bool ReserveArray(void **array,
+                         int *capacity,
+                         int count,
+                         size_t elementSize);
+
+/* 작업 스레드 `jobCount`개를 만들어 `func`를 실행하고, 모두 끝날 때까지 기다리는 함수 */
+static void RunImportJobs(void *(*func)(void *),
+                          void *jobs,
+                          size_t jobSize,
+                          int jobCount);
+
+/* 메시 데이터를 정점 65535개 이하의 메시들로 나누어 GPU에 업로드하는 함수 */
+static int UploadImportedMeshes(const MeshImportData *importData,
+                                Mesh **meshes);
+
+/* Public Functions ======================================================== */
+
+/* `fileName` 파일의 메시를 메시 캐시에서 찾거나 불러와서 모델을 만드는 함수 */
+Model LoadCachedModel(const char *fileName) {
+    Model model = { .transform = MatrixIdentity() };
+
+    if (fileName == NULL) return model;
+
+    MeshCacheEntry *entry = NULL;
+
+    for (int i = 0; i < meshCacheCount; i++) {
+        if (strcmp(meshCache[i].fileName, fileName) != 0) continue;
+
+        entry = &meshCache[i];
+
+        break;
+    }
+
+    if (entry == NULL) {
+        if (meshCacheCount >= MESH_CACHE_CAPACITY) {
+            TraceLog(LOG_WARNING,
+                     "MESH: [%s] Mesh cache is full (%d entries)",
+                     fileName,
+                     MESH_CACHE_CAPACITY);
+
+            return model;
+        }
+
+        bool isObjFile = IsFileExtension(fileName, ".obj");
+
+        if (!isObjFile && !IsFileExtension(fileName, ".ply")) {
+            TraceLog(LOG_WARNING,
+                     "MESH: [%s] Unsupported mesh file format",
+                     fileName);
+
+            return model;
+        }
+
+        MeshFile file = { 0 };
+
+        if (!OpenMeshFile(fileName, &file)) return model;
+
+        double startTime = GetTime();
+
+        MeshImportData importData = { 0 };
+
+        bool result = isObjFile ? ImportObjMesh(&file, &importData)
+                                : ImportPlyMesh(&file, &importData);
+
+        CloseMeshFile(&file);
+
+        if (result) result = FinishMeshImport(&importData);
+
+        Mesh *meshes = NULL;
+
+        int meshCount = result ? UploadImportedMeshes(&importData, &meshes)
+                               : 0;
+
+        if (meshCount > 0)
+            TraceLog(LOG_INFO,
+                     "MESH: [%s] Loaded %d vertices, %d triangles "
+                     "(%d meshes) in %.2f ms",
+                     fileName,
+                     importData.vertexCount,
+                     importData.indexCount / 3,
+                     meshCount,
+                     1000.0 * (GetTime() - startTime));
+        else
+            TraceLog(LOG_WARNING,
+                     "MESH: [%s] Failed to load mesh file",
+                     fileName);
+
+        FreeMeshImportData(&importData);
+
+        if (meshCount <= 0) return model;
+
+        entry = &meshCache[meshCacheCount++];
+
+        strncpy(entry->fileName, fileName, MESH_FILE_NAME_LENGTH - 1);
+
+        entry->meshes = meshes, entry->meshCount = meshCount;
+    }
+
+    {
+        // NOTE: 메시의 GPU 버퍼는 복사하지 않고, 메시 캐시와 공유함
+        model.meshes = RL_MALLOC(entry->meshCount * sizeof *(model.meshes));
+
+        memcpy(model.meshes,
+               entry->meshes,
+               entry->meshCount * sizeof *(model.meshes));
+
+        model.meshCount = entry->meshCount;
+
+        model.materials = RL_CALLOC(1, sizeof *(model.materials));
+
+        model.materials[0] = LoadMaterialDefault();
+
+        model.materialCount = 1;
+
+        model.meshMaterial = RL_CALLOC(model.meshCount,
+                                       sizeof *(model.meshMaterial));
+    }
+
+    return model;
+}
+
+/* `LoadCachedModel()`로 만든 모델의 메시 파일 경로를 반환하는 함수 */
+const char *GetCachedModelFileName(Model model) {
+    if (model.meshCount <= 0) return NULL;
+
+    // NOTE: 메시 캐시와 공유하는 메시는 같은 VBO 배열을 가리킴
+    for (int i = 0; i < meshCacheCount; i++)
+        if (meshCache[i].meshes[0].vboId == model.meshes[0].vboId)
+            return meshCache[i].fileName;
+
+    return NULL;
+}
+
+/* `LoadCachedModel()`로 만든 모델을 해제하는 함수 */
+void UnloadCachedModel(Model model) {
+    // NOTE: 메시 캐시와 공유하는 메시는 해제하지 않음
+    for (int i = 0; i < model.materialCount; i++)
+        RL_FREE(model.materials[i].maps);
+
+    RL_FREE(model.materials);
+    RL_FREE(model.meshes);
+    RL_FREE(model.meshMaterial);
+}
+
+/* 메시 캐시에 저장된 모든 메시를 해제하는 함수 */
+void UnloadMeshCache(void) {
+    for (int i = 0; i < meshCacheCount; i++) {
+        for (int j = 0; j < meshCache[i].meshCount; j++)
+            UnloadMesh(meshCache[i].meshes[j]);
+
+        RL_FREE(meshCache[i].meshes);
+    }
+
+    memset(meshCache, 0, sizeof meshCache);
+
+    meshCacheCount = 0;
+}
+
+/* Private Functions ======================================================= */
+
+/* 메모리에 올린 메시 파일을 해제하는 함수 */
+static void CloseMeshFile(MeshFile *file) {
+    if (file->data == NULL) return;
+
+#ifdef MESH_USE_MMAP
+    munmap(file->data, file->size);
+#else
+    UnloadFileData(file->data);
+#endif
+
+    file->data = NULL;
+}
+
+/* 삼각형 인덱스로 각 정점의 법선 벡터를 계산하는 함수 */
+static bool ComputeImportNormals(MeshImportData *importData) {
+    importData->normals = RL_CALLOC(3 * importData->vertexCount,
+                                    sizeof *(importData->normals));
+
+    if (importData->normals == NULL) return false;
+
+    const float *positions = importData->positions;
+
+    float *normals = importData->normals;
+
+    // NOTE: 각 면의 (넓이에 비례하는) 법선 벡터를 세 정점에 더함
+    for (int i = 0; i + 2 < importData->indexCount; i += 3) {
+        const unsigned int *triangle = importData->indices + i;
+
+        Vector3 v0 = { positions[3 * triangle[0]],
+                       positions[3 * triangle[0] + 1],
+                       positions[3 * triangle[0] + 2] };
+        Vector3 v1 = { positions[3 * triangle[1]],
+                       positions[3 * triangle[1] + 1],
+                       positions[3 * triangle[1] + 2] };
+        Vector3 v2 = { positions[3 * triangle[2]],
+                       positions[3 * triangle[2] + 1],
+                       positions[3 * triangle[2] + 2] };
+
+        Vector3 faceNormal = Vector3CrossProduct(Vector3Subtract(v1, v0),
+                                                 Vector3Subtract(v2, v0));
+
+        for (int j = 0; j < 3; j++) {
+            normals[3 * triangle[j]] += faceNormal.x;
+            normals[3 * triangle[j] + 1] += faceNormal.y;
+            normals[3 * triangle[j] + 2] += faceNormal.z;
+        }
+    }
+
+    for (int i = 0; i < importData->vertexCount; i++) {
+        Vector3 normal = Vector3Normalize((Vector3) { normals[3 * i],
+                                                      normals[3 * i + 1],
+                                                      normals[3 * i + 2] });
+
+        normals[3 * i] = normal.x;
+        normals[3 * i + 1] = normal.y;
+        normals[3 * i + 2] = normal.z;
+    }
+
+    return true;
+}
+
+/* 메시 데이터를 원점 중심의 크기 1인 정육면체에 맞추고, 색상을 정하는 함수 */
+static bool FinishMeshImport(MeshImportData *importData) {
+    if (importData->vertexCount <= 0 || importData->indexCount < 3)
+        return false;
+
+    float *positions = importData->positions;
+
+    {
+        /* 스캔한 모델의 단위와 위치가 제각각이므로, 크기와 위치를 맞춤 */
+
+        Vector3 minPosition = { positions[0], positions[1], positions[2] };
+        Vector3 maxPosition = minPosition;
+
+        for (int i = 1; i < importData->vertexCount; i++) {
+            Vector3 position = { positions[3 * i],
+                                 positions[3 * i + 1],
+                                 positions[3 * i + 2] };
+
+            minPosition = Vector3Min(minPosition, position);
+            maxPosition = Vector3Max(maxPosition, position);
+        }
+
+        Vector3 center = Vector3Scale(Vector3Add(minPosition, maxPosition),
+                                      0.5f);
+        Vector3 extents = Vector3Subtract(maxPosition, minPosition);
+
+        float maxExtent = fmaxf(extents.x, fmaxf(extents.y, extents.z));
+
+        float scale = (maxExtent > EPSILON) ? (1.0f / maxExtent) : 1.0f;
+
+        for (int i = 0; i < importData->vertexCount; i++) {
+            positions[3 * i] = (positions[3 * i] - center.x) * scale;
+            positions[3 * i + 1] = (positions[3 * i + 1] - center.y) * scale;
+            positions[3 * i + 2] = (positions[3 * i + 2] - center.z) * scale;
+        }
+    }
+
+    if (importData->normals == NULL && !ComputeImportNormals(importData))
+        return false;
+
+    if (importData->colors == NULL) {
+        /* 조명이 없으므로, 법선 벡터의 방향으로 각 정점의 색상을 정함 */
+
+        importData->colors = RL_MALLOC(4 * importData->vertexCount);
+
+        if (importData->colors == NULL) return false;
+
+        for (int i = 0; i < importData->vertexCount; i++) {
+            const float *normal = importData->normals + 3 * i;
+
+            unsigned char *color = importData->colors + 4 * i;
+
+            for (int j = 0; j < 3; j++)
+                color[j] = (unsigned char) (255.0f
+                                            * Clamp(0.5f + 0.5f * normal[j],
+                                                    0.0f,
+                                                    1.0f));
+
+            color[3] = 255;
+        }
+    }
+
+    return true;
+}
+
+/* 메시 파일에서 읽은 데이터를 해제하는 함수 */
+static void FreeMeshImportData(MeshImportData *importData) {
+    RL_FREE(importData->positions);
+    RL_FREE(importData->texcoords);
+    RL_FREE(importData->normals);
+    RL_FREE(importData->colors);
+    RL_FREE(importData->indices);
+
+    *importData = (MeshImportData) { 0 };
+}
+
+/* 작업 스레드의 최대 개수를 반환하는 함수 */
+static int GetImportThreadCount(void) {
+    int threadCount = 1;
+
+#ifdef _SC_NPROCESSORS_ONLN
+    threadCount = (int) sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    if (threadCount < 1) threadCount = 1;
+
+    if (threadCount > MESH_IMPORT_MAX_THREAD_COUNT)
+        threadCount = MESH_IMPORT_MAX_THREAD_COUNT;
+
+    return threadCount;
+}
+
+/* PLY 파일의 속성 자료형의 크기 (바이트)를 반환하는 함수 */
+static int GetPlyTypeSize(PlyType type) {
+    static const int typeSizes[] = { 0, 1, 1, 2, 2, 4, 4, 4, 8 };
+
+    return typeSizes[type];
+}
+
+/* OBJ 파일의 데이터를 읽는 함수 */
+static bool ImportObjMesh(const MeshFile *file, MeshImportData *importData) {
+    ObjChunk chunks[MESH_IMPORT_MAX_THREAD_COUNT] = { { 0 } };
+
+    int chunkCount = GetImportThreadCount();
+
+    if (file->size / chunkCount < MESH_IMPORT_MIN_CHUNK_SIZE)
+        chunkCount = (int) (file->size / MESH_IMPORT_MIN_CHUNK_SIZE) + 1;
+
+    if (chunkCount > MESH_IMPORT_MAX_THREAD_COUNT)
+        chunkCount = MESH_IMPORT_MAX_THREAD_COUNT;
+
+    {
+        /* 파일을 줄 단위로 정렬된 범위로 나누어 병렬로 읽기 */
+
+        const char *data = (const char *) file->data;
+        const char *begin = data, *end = data + file->size;
+
+        for (int i = 0; i < chunkCount; i++) {
+            const char *chunkEnd = end;
+
+            if (i < chunkCount - 1) {
+                chunkEnd = data + ((i + 1) * file->size) / chunkCount;
+
+                if (chunkEnd < begin) chunkEnd = begin;
+
+                while (chunkEnd < end && chunkEnd[-1] != '\n')
+                    chunkEnd++;
+            }
+
+            chunks[i].begin = begin, chunks[i].end = chunkEnd;
+
+            begin = chunkEnd;
+        }
+
+        RunImportJobs(ParseObjChunk, chunks, sizeof *chunks, chunkCount);
+    }
+
+    bool result = true;
+
+    int positionCount = 0, texcoordCount = 0, normalCount = 0;
+    int cornerCount = 0;
+
+    for (int i = 0; i < chunkCount; i++) {
+        if (chunks[i].failed) result = false;
+
+        positionCount += chunks[i].positionCount;
+        texcoordCount += chunks[i].texcoordCount;
+        normalCount += chunks[i].normalCount;
+        cornerCount += chunks[i].cornerCount;
+    }
+
+    float *positions = NULL, *texcoords = NULL, *normals = NULL;
+    int *corners = NULL;
+
+    if (result && positionCount > 0 && cornerCount >= 3) {
+        /* 각 범위의 결과를 하나로 합치고, 상대 인덱스를 절대 인덱스로 변환 */
+
+        positions = RL_MALLOC(3 * positionCount * sizeof *positions);
+        texcoords = RL_MALLOC((2 * texcoordCount + 1) * sizeof *texcoords);
+        normals = RL_MALLOC((3 * normalCount + 1) * sizeof *normals);
+        corners = RL_MALLOC(3 * cornerCount * sizeof *corners);
+
+        result = (positions != NULL && texcoords != NULL && normals != NULL
+                  && corners != NULL);
+
+        int baseCounts[3] = { 0 }, cornerOffset = 0;
+
+        for (int i = 0; result && i < chunkCount; i++) {
+            const ObjChunk *chunk = &chunks[i];
+
+            if (chunk->positionCount > 0)
+                memcpy(positions + 3 * baseCounts[0],
+                       chunk->positions,
+                       3 * chunk->positionCount * sizeof *positions);
+
+            if (chunk->texcoordCount > 0)
+                memcpy(texcoords + 2 * baseCounts[1],
+                       chunk->texcoords,
+                       2 * chunk->texcoordCount * sizeof *texcoords);
+
+            if (chunk->normalCount > 0)
+                memcpy(normals + 3 * baseCounts[2],
+                       chunk->normals,
+                       3 * chunk->normalCount * sizeof *normals);
+
+            for (int j = 0; j < 3 * chunk->cornerCount; j++) {
+                int index = chunk->corners[j];
+
+                if (index < -1)
+                    index = baseCounts[j % 3]
+                            + (index + OBJ_RELATIVE_INDEX_BIAS);
+
+                corners[cornerOffset + j] = index;
+            }
+
+            cornerOffset += 3 * chunk->cornerCount;
+
+            baseCounts[0] += chunk->positionCount;
+            baseCounts[1] += chunk->texcoordCount;
+            baseCounts[2] += chunk->normalCount;
+        }
+    } else {
+        result = false;
+    }
+
+    for (int i = 0; i < chunkCount; i++) {
+        RL_FREE(chunks[i].positions);
+        RL_FREE(chunks[i].texcoords);
+        RL_FREE(chunks[i].normals);
+        RL_FREE(chunks[i].corners);
+    }
+
+    unsigned int *indices = result ? RL_MALLOC(cornerCount * sizeof *indices)
+                                   : NULL;
+
+    if (indices == NULL) result = false;
+
+    bool useTexcoords = (texcoordCount > 0), useNormals = (normalCount > 0);
+
+    for (int i = 0; result && i < 3 * cornerCount; i += 3) {
+        if (corners[i] < 0 || corners[i] >= positionCount
+            || corners[i + 1] >= texcoordCount
+            || corners[i + 2] >= normalCount)
+            result = false;
+
+        // 텍스처 좌표나 법선 벡터가 하나라도 없으면, 모두 사용하지 않음
+        if (corners[i + 1] < 0) useTexcoords = false;
+        if (corners[i + 2] < 0) useNormals = false;
+    }
+
+    if (!useTexcoords) texcoordCount = 0;
+    if (!useNormals) normalCount = 0;
+
+    if (result && texcoordCount == 0 && normalCount == 0) {
+        /* 위치만 있다면, 중복된 정점이 없으므로 위치를 그대로 정점으로 사용 */
+
+        for (int i = 0; i < cornerCount; i++)
+            indices[i] = (unsigned int) corners[3 * i];
+
+        importData->positions = positions, positions = NULL;
+
+        importData->vertexCount = positionCount;
+    } else if (result) {
+        /* 해시 테이블로 같은 `v/vt/vn` 조합의 꼭짓점을 하나의 정점으로 합침 */
+
+        unsigned int tableSize = 1;
+
+        while (tableSize < 2u * (unsigned int) cornerCount)
+            tableSize <<= 1;
+
+        int *table = RL_MALLOC(tableSize * sizeof *table);
+
+        importData->positions = RL_MALLOC(3 * cornerCount * sizeof(float));
+
+        if (texcoordCount > 0)
+            importData->texcoords = RL_MALLOC(2 * cornerCount
+                                              * sizeof(float));
+
+        if (normalCount > 0)
+            importData->normals = RL_MALLOC(3 * cornerCount * sizeof(float));
+
+        result = (table != NULL && importData->positions != NULL
+                  && (texcoordCount == 0 || importData->texcoords != NULL)
+                  && (normalCount == 0 || importData->normals != NULL));
+
+        if (result) memset(table, 0xFF, tableSize * sizeof *table);
+
+        int *uniqueCorners = corners;
+
+        for (int i = 0; result && i < cornerCount; i++) {
+            int key[3] = { corners[3 * i],
+                           (texcoordCount > 0) ? corners[3 * i + 1] : -1,
+                           (normalCount > 0) ? corners[3 * i + 2] : -1 };
+
+            uint32_t hash = ((uint32_t) key[0] * 73856093u)
+                            ^ ((uint32_t) key[1] * 19349663u)
+                            ^ ((uint32_t) key[2] * 83492791u);
+
+            hash ^= hash >> 16, hash *= 0x7FEB352Du, hash ^= hash >> 15;
+
+            uint32_t slot = hash & (tableSize - 1);
+
+            int vertexIndex = -1;
+
+            for (;; slot = (slot + 1) & (tableSize - 1)) {
+                int candidate = table[slot];
+
+                if (candidate < 0) break;
+
+                // NOTE: 정점 `j`의 키는 `uniqueCorners`의 `j`번째 원소에 저장됨
+                if (memcmp(uniqueCorners + 3 * candidate, key, sizeof key)
+                    == 0) {
+                    vertexIndex = candidate;
+
+                    break;
+                }
+            }
+
+            if (vertexIndex < 0) {
+                vertexIndex = importData->vertexCount++;
+
+                table[slot] = vertexIndex;
+
+                memcpy(importData->positions + 3 * vertexIndex,
+                       positions + 3 * key[0],
+                       3 * sizeof(float));
+
+                if (texcoordCount > 0)
+                    memcpy(importData->texcoords + 2 * vertexIndex,
+                           texcoords + 2 * key[1],
+                           2 * sizeof(float));
+
+                if (normalCount > 0)
+                    memcpy(importData->normals + 3 * vertexIndex,
+                           normals + 3 * key[2],
+                           3 * sizeof(float));
+
+                // NOTE: `vertexIndex <= i`이므로, 아직 읽지 않은 원소를 덮어쓰지 않음
+                memcpy(uniqueCorners + 3 * vertexIndex, key, sizeof key);
+            }
+
+            indices[i] = (unsigned int) vertexIndex;
+        }
+
+        RL_FREE(table);
+    }
+
+    RL_FREE(positions);
+    RL_FREE(texcoords);
+    RL_FREE(normals);
+    RL_FREE(corners);
+
+    if (!result) {
+        RL_FREE(indices);
+
+        return false;
+    }
+
+    importData->indices = indices, importData->indexCount = cornerCount;
+
+    return true;
+}
+
+/* PLY 파일의 데이터를 읽는 함수 */
+static bool ImportPlyMesh(const MeshFile *file, MeshImportData *importData) {
+    PlyHeader header = { 0 };
+
+    if (!ParsePlyHeader(file, &header)) return false;
+
+    const unsigned char *data = file->data + header.dataOffset;
+    const unsigned char *end = file->data + file->size;
+
+    importData->vertexCount = header.vertexCount;
+
+    importData->positions = RL_CALLOC(3 * header.vertexCount, sizeof(float));
+
+    if (header.hasTarget[PLY_TARGET_NX])
+        importData->normals = RL_CALLOC(3 * header.vertexCount, sizeof(float));
+
+    if (header.hasTarget[PLY_TARGET_U])
+        importData->texcoords = RL_CALLOC(2 * header.vertexCount,
+                                          sizeof(float));
+
+    if (header.hasTarget[PLY_TARGET_RED]) {
+        importData->colors = RL_MALLOC(4 * header.vertexCount);
+
+        if (importData->colors != NULL)
+            memset(importData->colors, 0xFF, 4 * header.vertexCount);
+    }
+
+    if (importData->positions == NULL
+        || (header.hasTarget[PLY_TARGET_NX] && importData->normals == NULL)
+        || (header.hasTarget[PLY_TARGET_U] && importData->texcoords == NULL)
+        || (header.hasTarget[PLY_TARGET_RED] && importData->colors == NULL))
+        return false;
+
+    if (header.isBinary) {
+        /* 정점의 크기가 일정하므로, 정점 범위를 나누어 병렬로 읽기 */
+
+        if ((size_t) (end - data)
+            < (size_t) header.vertexCount * header.vertexStride)
+            return false;
+
+        PlyVertexJob jobs[MESH_IMPORT_MAX_THREAD_COUNT];
+
+        int jobCount = GetImportThreadCount();
+
+        for (int i = 0; i < jobCount; i++)
+            jobs[i] = (PlyVertexJob) {
+                .header = &header,
+                .data = data,
+                .begin = (int) (((int64_t) i * header.vertexCount)
+                                / jobCount),
+                .end = (int) (((int64_t) (i + 1) * header.vertexCount)
+                              / jobCount),
+                .importData = importData
+            };
+
+        RunImportJobs(ParsePlyVertices, jobs, sizeof *jobs, jobCount);
+
+        data += (size_t) header.vertexCount * header.vertexStride;
+    } else {
+        /* 텍스트 형식은 각 정점의 길이가 다르므로, 차례대로 읽기 */
+
+        const char *ptr = (const char *) data;
+
+        for (int i = 0; i < header.vertexCount; i++) {
+            for (int j = 0; j < header.vertexPropCount; j++) {
+                const PlyProperty *property = &header.vertexProps[j];
+
+                float value = 0.0f;
+
+                ptr = ParseFloat(ptr, (const char *) end, &value);
+
+                if (ptr == NULL) return false;
+
+                if (property->target == PLY_TARGET_NONE) continue;
+
+                if (property->target <= PLY_TARGET_Z)
+                    importData->positions[3 * i + property->target] = value;
+                else if (property->target <= PLY_TARGET_NZ)
+                    importData->normals[3 * i
+                                        + (property->target - PLY_TARGET_NX)] =
+                        value;
+                else if (property->target <= PLY_TARGET_V)
+                    importData->texcoords[2 * i
+                                          + (property->target - PLY_TARGET_U)] =
+                        value;
+                else
+                    importData->colors[4 * i
+                                       + (property->target - PLY_TARGET_RED)] =
+                        (unsigned char) ((property->type == PLY_TYPE_FLOAT32
+                                          || property->type == PLY_TYPE_FLOAT64)
+                                             ? 255.0f * Clamp(value, 0, 1)
+                                             : Clamp(value, 0, 255));
+            }
+        }
+
+        data = (const unsigned char *) ptr;
+    }
+
+    {
+        /* 각 면을 삼각형으로 나누어 인덱스 배열에 추가 */
+
+        int indexCapacity = 0;
+
+        for (int i = 0; i < header.faceCount; i++) {
+            for (int j = 0; j < header.facePropCount; j++) {
+                const PlyProperty *property = &header.faceProps[j];
+
+                int count = 1;
+
+                if (property->countType != PLY_TYPE_NONE) {
+                    if (header.isBinary) {
+                        int size = GetPlyTypeSize(property->countType);
+
+                        if (end - data < size) return false;
+
+                        count = (int) ReadPlyValue(data, property->countType);
+
+                        data += size;
+                    } else {
+                        data = (const unsigned char *) ParseInt(
+                            (const char *) data,
+                            (const char *) end,
+                            &count);
+
+                        if (data == NULL) return false;
+                    }
+                }
+
+                int firstIndex = -1, prevIndex = -1;
+
+                for (int k = 0; k < count; k++) {
+                    int index = 0;
+
+                    if (header.isBinary) {
+                        int size = GetPlyTypeSize(property->type);
+
+                        if (end - data < size) return false;
+
+                        index = (int) ReadPlyValue(data, property->type);
+
+                        data += size;
+                    } else {
+                        float value = 0.0f;
+
+                        data = (const unsigned char *) ParseFloat(
+                            (const char *) data,
+                            (const char *) end,
+                            &value);
+
+                        if (data == NULL) return false;
+
+                        index = (int) value;
+                    }
+
+                    if (!property->isIndexList) continue;
+
+                    if (index < 0 || index >= header.vertexCount) return false;
+
+                    if (k == 0) {
+                        firstIndex = index;
+                    } else if (k >= 2) {
+                        if (!ReserveArray((void **) &importData->indices,
+                                          &indexCapacity,
+                                          importData->indexCount + 3,
+                                          sizeof *(importData->indices)))
+                            return false;
+
+                        unsigned int *triangle = importData->indices
+                                                 + importData->indexCount;
+
+                        triangle[0] = (unsigned int) firstIndex;
+                        triangle[1] = (unsigned int) prevIndex;
+                        triangle[2] = (unsigned int) index;
+
+                        importData->indexCount += 3;
+                    }
+
+                    prevIndex = index;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+/* 메시 파일을 메모리에 올리는 함수 */
+static bool OpenMeshFile(const char *fileName, MeshFile *file) {
+#ifdef MESH_USE_MMAP
+    int fd = open(fileName, O_RDONLY);
+
+    if (fd < 0) {
+        TraceLog(LOG_WARNING, "MESH: [%s] Failed to open file", fileName);
+
+        return false;
+    }
+
+    struct stat fileStat;
+
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+        close(fd);
+
+        return false;
+    }
+
+    file->size = (size_t) fileStat.st_size;
+
+    // NOTE: 파일 전체를 읽어 오지 않고, 각 작업 스레드가 필요한 부분만 읽도록 함
+    void *data = mmap(NULL, file->size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    close(fd);
+
+    if (data == MAP_FAILED) {
+        TraceLog(LOG_WARNING, "MESH: [%s] Failed to map file", fileName);
+
+        return false;
+    }
+
+    madvise(data, file->size, MADV_WILLNEED);
+
+    file->data = data;
+#else
+    int dataSize = 0;
+
+    file->data = LoadFileData(fileName, &dataSize);
+
+    if (file->data == NULL) return false;
+
+    file->size = (size_t) dataSize;
+#endif
+
+    return true;
+}
+
+/* 문자열에서 실수 하나를 읽는 함수 */
+static const char *ParseFloat(const char *ptr, const char *end, float *result) {
+    // NOTE: 메모리에 올린 파일은 `'\0'`으로 끝나지 않으므로, `strtof()` 대신 사용
+    while (ptr < end
+           && (*ptr == ' ' || *ptr == '\t' || *ptr == '\r' || *ptr == '\n'))
+        ptr++;
+
+    bool isNegative = false;
+
+    if (ptr < end && (*ptr == '-' || *ptr == '+'))
+        isNegative = (*ptr == '-'), ptr++;
+
+    const char *digitsBegin = ptr;
+
+    double value = 0.0;
+
+    while (ptr < end && *ptr >= '0' && *ptr <= '9')
+        value = (10.0 * value) + (*ptr++ - '0');
+
+    if (ptr < end && *ptr == '.') {
+        double fraction = 0.0, divisor = 1.0;
+
+        for (ptr++; ptr < end && *ptr >= '0' && *ptr <= '9'; ptr++)
+            fraction = (10.0 * fraction) + (*ptr - '0'), divisor *= 10.0;
+
+        value += fraction / divisor;
+    }
+
+    if (ptr == digitsBegin) return NULL;
+
+    if (ptr < end && (*ptr == 'e' || *ptr == 'E')) {
+        int exponent = 0;
+
+        const char *exponentEnd = ParseInt(ptr + 1, end, &exponent);
+
+        if (exponentEnd != NULL)
+            value *= pow(10.0, exponent), ptr = exponentEnd;
+    }
+
+    *result = (float) (isNegative ? -value : value);
+
+    return ptr;
+}
+
+/* 문자열에서 정수 하나를 읽는 함수 */
+static const char *ParseInt(const char *ptr, const char *end, int *result) {
+    while (ptr < end
+           && (*ptr == ' ' || *ptr == '\t' || *ptr == '\r' || *ptr == '\n'))
+        ptr++;
+
+    bool isNegative = false;
+
+    if (ptr < end && (*ptr == '-' || *ptr == '+'))
+        isNegative = (*ptr == '-'), ptr++;
+
+    const char *digitsBegin = ptr;
+
+    int value = 0;
+
+    while (ptr < end && *ptr >= '0' && *ptr <= '9')
+        value = (10 * value) + (*ptr++ - '0');
+
+    if (ptr == digitsBegin) return NULL;
+
+    *result = isNegative ? -value : value;
+
+    return ptr;
+}
+
+/* 작업 스레드에서 OBJ 파일의 일부를 읽는 함수 */
+static void *ParseObjChunk(void *arg) {
+    ObjChunk *chunk = arg;
+
+    const char *ptr = chunk->begin, *end = chunk->end;
+
+    while (ptr < end && !chunk->failed) {
+        const char *lineEnd = memchr(ptr, '\n', (size_t) (end - ptr));
+
+        if (lineEnd == NULL) lineEnd = end;
+
+        while (ptr < lineEnd && (*ptr == ' ' || *ptr == '\t'))
+            ptr++;
+
+        if (lineEnd - ptr > 2 && ptr[0] == 'v') {
+            float *values = NULL;
+
+            int valueCount = 0;
+
+            if (ptr[1] == ' ' || ptr[1] == '\t') {
+                if (!ReserveArray((void **) &chunk->positions,
+                                  &chunk->positionCapacity,
+                                  3 * (chunk->positionCount + 1),
+                                  sizeof *(chunk->positions)))
+                    chunk->failed = true;
+                else
+                    values = chunk->positions + 3 * chunk->positionCount++,
+                    valueCount = 3;
+
+                ptr += 1;
+            } else if (ptr[1] == 't') {
+                if (!ReserveArray((void **) &chunk->texcoords,
+                                  &chunk->texcoordCapacity,
+                                  2 * (chunk->texcoordCount + 1),
+                                  sizeof *(chunk->texcoords)))
+                    chunk->failed = true;
+                else
+                    values = chunk->texcoords + 2 * chunk->texcoordCount++,
+                    valueCount = 2;
+
+                ptr += 2;
+            } else if (ptr[1] == 'n') {
+                if (!ReserveArray((void **) &chunk->normals,
+                                  &chunk->normalCapacity,
+                                  3 * (chunk->normalCount + 1),
+                                  sizeof *(chunk->normals)))
+                    chunk->failed = true;
+                else
+                    values = chunk->normals + 3 * chunk->normalCount++,
+                    valueCount = 3;
+
+                ptr += 2;
+            }
+
+            for (int i = 0; i < valueCount; i++) {
+                values[i] = 0.0f;
+
+                if (ptr != NULL) ptr = ParseFloat(ptr, lineEnd, &values[i]);
+            }
+        } else if (lineEnd - ptr > 2 && ptr[0] == 'f'
+                   && (ptr[1] == ' ' || ptr[1] == '\t')) {
+            /* 다각형을 첫 번째 꼭짓점 기준의 삼각형 부채꼴로 나눔 */
+
+            int firstCorner[3], prevCorner[3], corner[3];
+
+            ptr += 1;
+
+            for (int i = 0;; i++) {
+                while (ptr < lineEnd
+                       && (*ptr == ' ' || *ptr == '\t' || *ptr == '\r'))
+                    ptr++;
+
+                if (ptr >= lineEnd) break;
+
+                ptr = ParseObjCorner(chunk, ptr, lineEnd, corner);
+
+                if (ptr == NULL) break;
+
+                if (i == 0) {
+                    memcpy(firstCorner, corner, sizeof corner);
+                } else if (i >= 2) {
+                    if (!ReserveArray((void **) &chunk->corners,
+                                      &chunk->cornerCapacity,
+                                      3 * (chunk->cornerCount + 3),
+                                      sizeof *(chunk->corners))) {
+                        chunk->failed = true;
+
+                        break;
+                    }
+
+                    int *triangle = chunk->corners + 3 * chunk->cornerCount;
+
+                    memcpy(triangle, firstCorner, sizeof firstCorner);
+                    memcpy(triangle + 3, prevCorner, sizeof prevCorner);
+                    memcpy(triangle + 6, corner, sizeof corner);
+
+                    chunk->cornerCount += 3;
+                }
+
+                memcpy(prevCorner, corner, sizeof corner);
+            }
+        }
+
+        ptr = lineEnd + 1;
+    }
+
+    return NULL;
+}
+
+/* OBJ 파일의 `f` 요소에서 꼭짓점 하나를 읽는 함수 */
+static const char *ParseObjCorner(const ObjChunk *chunk,
+                                  const char *ptr,
+                                  const char *end,
+                                  int *corner) {
+    const int counts[3] = { chunk->positionCount,
+                            chunk->texcoordCount,
+                            chunk->normalCount };
+
+    corner[0] = corner[1] = corner[2] = -1;
+
+    for (int i = 0; i < 3; i++) {
+        // `v//vn`처럼 비어 있는 인덱스는 건너뜀
+        if (i > 0 && ptr < end && *ptr == '/') {
+            ptr++;
+
+            continue;
+        }
+
+        int index = 0;
+
+        ptr = ParseInt(ptr, end, &index);
+
+        if (ptr == NULL) return NULL;
+
+        // NOTE: 음수 인덱스는 이전 범위의 요소를 가리킬 수 있으므로, 나중에 변환
+        if (index > 0)
+            corner[i] = index - 1;
+        else if (index < 0)
+            corner[i] = (counts[i] + index) - OBJ_RELATIVE_INDEX_BIAS;
+
+        if (ptr >= end || *ptr != '/') break;
+
+        ptr++;
+    }
+
+    return ptr;
+}
+
+/* PLY 파일의 헤더를 읽는 함수 */
+static bool ParsePlyHeader(const MeshFile *file, PlyHeader *header) {
+    const char *ptr = (const char *) file->data;
+    const char *end = ptr + file->size;
+
+    if (file->size < 4 || memcmp(ptr, "ply", 3) != 0) return false;
+
+    // 0: 요소 없음, 1: 정점, 2: 면, 3: 그 외
+    int currentElement = 0;
+
+    bool hasFormat = false;
+
+    while (ptr < end) {
+        const char *lineEnd = memchr(ptr, '\n', (size_t) (end - ptr));
+
+        if (lineEnd == NULL) return false;
+
+        char line[256] = { 0 }, words[5][64] = { { 0 } };
+
+        size_t lineLength = (size_t) (lineEnd - ptr);
+
+        if (lineLength >= sizeof line) lineLength = sizeof line - 1;
+
+        memcpy(line, ptr, lineLength);
+
+        ptr = lineEnd + 1;
+
+        int wordCount = sscanf(line,
+                               "%63s %63s %63s %63s %63s",
+                               words[0],
+                               words[1],
+                               words[2],
+                               words[3],
+                               words[4]);
+
+        if (wordCount <= 0) continue;
+
+        if (strcmp(words[0], "end_header") == 0) {
+            header->dataOffset = (size_t) (ptr - (const char *) file->data);
+
+            break;
+        } else if (strcmp(words[0], "format") == 0 && wordCount >= 2) {
+            if (strcmp(words[1], "binary_little_endian") == 0)
+                header->isBinary = true;
+            else if (strcmp(words[1], "ascii") != 0)
+                return false;
+
+            hasFormat = true;
+        } else if (strcmp(words[0], "element") == 0 && wordCount >= 3) {
+            int count = atoi(words[2]);
+
+            if (strcmp(words[1], "vertex") == 0 && currentElement == 0) {
+                currentElement = 1, header->vertexCount = count;
+            } else if (strcmp(words[1], "face") == 0 && currentElement == 1) {
+                currentElement = 2, header->faceCount = count;
+            } else if (count > 0 && currentElement < 2) {
+                // NOTE: 정점과 면보다 앞에 있는 다른 요소는 지원하지 않음
+                return false;
+            } else {
+                currentElement = 3;
+            }
+        } else if (strcmp(words[0], "property") == 0 && wordCount >= 3) {
+            PlyProperty property = { .target = PLY_TARGET_NONE };
+
+            const char *propertyName = words[2];
+
+            if (strcmp(words[1], "list") == 0 && wordCount >= 5) {
+                property.countType = ParsePlyType(words[2]);
+                property.type = ParsePlyType(words[3]);
+
+                propertyName = words[4];
+            } else {
+                property.type = ParsePlyType(words[1]);
+            }
+
+            if (property.type == PLY_TYPE_NONE) return false;
+
+            if (currentElement == 1) {
+                static const char *targetNames[PLY_TARGET_COUNT_][4] = {
+                    { "x" },
+                    { "y" },
+                    { "z" },
+                    { "nx" },
+                    { "ny" },
+                    { "nz" },
+                    { "u", "s", "texture_u", "texture_s" },
+                    { "v", "t", "texture_v", "texture_t" },
+                    { "red", "r", "diffuse_red" },
+                    { "green", "g", "diffuse_green" },
+                    { "blue", "b", "diffuse_blue" }
+                };
+
+                if (property.countType != PLY_TYPE_NONE
+                    || header->vertexPropCount >= PLY_MAX_PROPERTY_COUNT)
+                    return false;
+
+                for (int i = 0; i < PLY_TARGET_COUNT_; i++)
+                    for (int j = 0; j < 4 && targetNames[i][j] != NULL; j++)
+                        if (strcmp(propertyName, targetNames[i][j]) == 0)
+                            property.target = i;
+
+                if (property.target != PLY_TARGET_NONE)
+                    header->hasTarget[property.target] = true;
+
+                property.offset = header->vertexStride;
+
+                header->vertexStride += GetPlyTypeSize(property.type);
+
+                header->vertexProps[header->vertexPropCount++] = property;
+            } else if (currentElement == 2) {
+                if (header->facePropCount >= PLY_MAX_PROPERTY_COUNT)
+                    return false;
+
+                property.isIndexList = (property.countType != PLY_TYPE_NONE)
+                                       && (strcmp(propertyName,
+                                                  "vertex_indices")
+                                               == 0
+                                           || strcmp(propertyName,
+                                                     "vertex_index")
+                                                  == 0);
+
+                header->faceProps[header->facePropCount++] = property;
+            }
+        }
+    }
+
+    if (!hasFormat || header->dataOffset == 0 || header->vertexCount <= 0
+        || header->faceCount <= 0 || !header->hasTarget[PLY_TARGET_X]
+        || !header->hasTarget[PLY_TARGET_Y]
+        || !header->hasTarget[PLY_TARGET_Z])
+        return false;
+
+    // 일부 요소만 있는 정점 속성은 사용하지 않음
+    if (!header->hasTarget[PLY_TARGET_NY] || !header->hasTarget[PLY_TARGET_NZ])
+        header->hasTarget[PLY_TARGET_NX] = false;
+
+    if (!header->hasTarget[PLY_TARGET_V])
+        header->hasTarget[PLY_TARGET_U] = false;
+
+    if (!header->hasTarget[PLY_TARGET_GREEN]
+        || !header->hasTarget[PLY_TARGET_BLUE])
+        header->hasTarget[PLY_TARGET_RED] = false;
+
+    for (int i = 0; i < header->vertexPropCount; i++) {
+        PlyProperty *property = &header->vertexProps[i];
+
+        if (property->target == PLY_TARGET_NONE) continue;
+
+        if ((property->target >= PLY_TARGET_NX
+             && property->target <= PLY_TARGET_NZ
+             && !header->hasTarget[PLY_TARGET_NX])
+            || (property->target >= PLY_TARGET_U
+                && property->target <= PLY_TARGET_V
+                && !header->hasTarget[PLY_TARGET_U])
+            || (property->target >= PLY_TARGET_RED
+                && !header->hasTarget[PLY_TARGET_RED]))
+            property->target = PLY_TARGET_NONE;
+    }
+
+    return true;
+}
+
+/* PLY 파일의 속성 자료형 이름을 해석하는 함수 */
+static PlyType ParsePlyType(const char *typeName) {
+    static const char *typeNames[][2] = {
+        { "", "" },
+        { "char", "int8" },
+        { "uchar", "uint8" },
+        { "short", "int16" },
+        { "ushort", "uint16" },
+        { "int", "int32" },
+        { "uint", "uint32" },
+        { "float", "float32" },
+        { "double", "float64" }
+    };
+
+    for (int i = PLY_TYPE_INT8; i <= PLY_TYPE_FLOAT64; i++)
+        if (strcmp(typeName, typeNames[i][0]) == 0
+            || strcmp(typeName, typeNames[i][1]) == 0)
+            return (PlyType) i;
+
+    return PLY_TYPE_NONE;
+}
+
+/* 작업 스레드에서 PLY 파일의 정점을 읽는 함수 */
+static void *ParsePlyVertices(void *arg) {
+    const PlyVertexJob *job = arg;
+
+    const PlyHeader *header = job->header;
+
+    MeshImportData *importData = job->importData;
+
+    for (int i = job->begin; i < job->end; i++) {
+        const unsigned char *vertex = job->data
+                                      + (size_t) i * header->vertexStride;
+
+        for (int j = 0; j < header->vertexPropCount; j++) {
+            const PlyProperty *property = &header->vertexProps[j];
+
+            if (property->target == PLY_TARGET_NONE) continue;
+
+            double value = ReadPlyValue(vertex + property->offset,
+                                        property->type);
+
+            if (property->target <= PLY_TARGET_Z)
+                importData->positions[3 * i + property->target] = (float) value;
+            else if (property->target <= PLY_TARGET_NZ)
+                importData
+                    ->normals[3 * i + (property->target - PLY_TARGET_NX)] =
+                    (float) value;
+            else if (property->target <= PLY_TARGET_V)
+                importData
+                    ->texcoords[2 * i + (property->target - PLY_TARGET_U)] =
+                    (float) value;
+            else
+                importData
+                    ->colors[4 * i + (property->target - PLY_TARGET_RED)] =
+                    (unsigned char) ((property->type == PLY_TYPE_FLOAT32
+                                      || property->type == PLY_TYPE_FLOAT64)
+                                         ? 255.0 * Clamp(value, 0, 1)
+                                         : Clamp(value, 0, 255));
+        }
+    }
+
+    return NULL;
+}
+
+/* 바이너리 PLY 파일에서 값 하나를 읽는 함수 */
+static double ReadPlyValue(const unsigned char *ptr, PlyType type) {
+    // NOTE: 리틀 엔디언 (little-endian) 환경에서만 올바르게 동작함
+    switch (type) {
+        case PLY_TYPE_INT8:
+            return (double) *(const int8_t *) ptr;
+
+        case PLY_TYPE_UINT8:
+            return (double) *ptr;
+
+        case PLY_TYPE_INT16: {
+            int16_t value;
+
+            memcpy(&value, ptr, sizeof value);
+
+            return (double) value;
+        }
+
+        case PLY_TYPE_UINT16: {
+            uint16_t value;
+
+            memcpy(&value, ptr, sizeof value);
+
+            return (double) value;
+        }
+
+        case PLY_TYPE_INT32: {
+            int32_t value;
+
+            memcpy(&value, ptr, sizeof value);
+
+            return (double) value;
+        }
+
+        case PLY_TYPE_UINT32: {
+            uint32_t value;
+
+            memcpy(&value, ptr, sizeof value);
+
+            return (double) value;
+        }
+
+        case PLY_TYPE_FLOAT32: {
+            float value;
+
+            memcpy(&value, ptr, sizeof value);
+
+            return (double) value;
+        }
+
+        case PLY_TYPE_FLOAT64: {
+            double value;
+
+            memcpy(&value, ptr, sizeof value);
+
+            return value;
+        }
+
+        default:
+            return 0.0;
+    }
+}
+
+/* 배열의 크기를 원소 `count`개 이상으로 늘리는 함수 */
+static bool ReserveArray(void **array,
+                         int *capacity,
+                         int count,
+                         size_t elementSize) {
+    if (count <= *capacity) return true;
+
+    int newCapacity = (*capacity > 0) ? *capacity : 4096;
+
+    while (newCapacity < count)
+        newCapacity *= 2;
+
+    void *newArray = RL_REALLOC(*array, newCapacity * elementSize);
+
+    if (newArray == NULL) return false;
+
+    *array = newArray, *capacity = newCapacity;
+
+    return true;
+}
+
+/* 작업 스레드 `jobCount`개를 만들어 `func`를 실행하고, 모두 끝날 때까지 기다리는 함수 */
+static void RunImportJobs(void *(*func)(void *),
+                          void *jobs,
+                          size_t jobSize,
+                          int jobCount) {
+    pthread_t threads[MESH_IMPORT_MAX_THREAD_COUNT];
+
+    bool isThreadCreated[MESH_IMPORT_MAX_THREAD_COUNT] = { false };
+
+    // NOTE: 첫 번째 작업은 현재 스레드에서 처리
+    for (int i = 1; i < jobCount; i++)
+        isThreadCreated[i] = (pthread_create(&threads[i],
+                                             NULL,
+                                             func,
+                                             (unsigned char *) jobs
+                                                 + i * jobSize)
+                              == 0);
+
+    func(jobs);
+
+    // 스레드를 만들 수 없는 환경에서는 현재 스레드에서 차례대로 처리
+    for (int i = 1; i < jobCount; i++) {
+        if (isThreadCreated[i])
+            pthread_join(threads[i], NULL);
+        else
+            func((unsigned char *) jobs + i * jobSize);
+    }
+}
+
+/* 메시 데이터를 정점 65535개 이하의 메시들로 나누어 GPU에 업로드하는 함수 */
+static int UploadImportedMeshes(const MeshImportData *importData,
+                                Mesh **meshes) {
+    // 전체 정점 번호를 현재 메시의 정점 번호로 바꾸는 표
+    int *localIndices = RL_MALLOC(importData->vertexCount
+                                  * sizeof *localIndices);
+
+    // 현재 메시의 정점 번호를 전체 정점 번호로 바꾸는 표
+    int *globalIndices = RL_MALLOC(MESH_MAX_VERTEX_COUNT
+                                   * sizeof *globalIndices);
+
+    unsigned short *indices = RL_MALLOC(importData->indexCount
+                                        * sizeof *indices);
+
+    if (localIndices == NULL || globalIndices == NULL || indices == NULL) {
+        RL_FREE(localIndices), RL_FREE(globalIndices), RL_FREE(indices);
+
+        return 0;
+    }
+
+    memset(localIndices, 0xFF, importData->vertexCount * sizeof *localIndices);
+
+    int meshCount = 0, meshCapacity = 0;
+
+    int vertexCount = 0, indexCount = 0, indexBegin = 0;
+
+    for (int i = 0; i <= importData->indexCount; i += 3) {
+        int newVertexCount = 0;
+
+        if (i < importData->indexCount)
+            for (int j = 0; j < 3; j++)
+                if (localIndices[importData->indices[i + j]] < 0)
+                    newVertexCount++;
+
+        if (i == importData->indexCount
+            || vertexCount + newVertexCount > MESH_MAX_VERTEX_COUNT) {
+            /* 현재 메시를 완성하여 GPU에 업로드 */
+
+            if (!ReserveArray((void **) meshes,
+                              &meshCapacity,
+                              meshCount + 1,
+                              sizeof **meshes))
+                break;
+
+            Mesh mesh = { .vertexCount = vertexCount,
+                          .triangleCount = indexCount / 3 };
+
+            mesh.vertices = RL_MALLOC(3 * vertexCount * sizeof(float));
+            mesh.normals = RL_MALLOC(3 * vertexCount * sizeof(float));
+            mesh.colors = RL_MALLOC(4 * vertexCount);
+            mesh.indices = RL_MALLOC(indexCount * sizeof *(mesh.indices));
+
+            if (importData->texcoords != NULL)
+                mesh.texcoords = RL_MALLOC(2 * vertexCount * sizeof(float));
+
+            for (int j = 0; j < vertexCount; j++) {
+                int index = globalIndices[j];
+
+                memcpy(mesh.vertices + 3 * j,
+                       importData->positions + 3 * index,
+                       3 * sizeof(float));
+                memcpy(mesh.normals + 3 * j,
+                       importData->normals + 3 * index,
+                       3 * sizeof(float));
+                memcpy(mesh.colors + 4 * j, importData->colors + 4 * index, 4);
+
+                if (mesh.texcoords != NULL)
+                    memcpy(mesh.texcoords + 2 * j,
+                           importData->texcoords + 2 * index,
+                           2 * sizeof(float));
+
+                // 다음 메시를 위해 표를 초기화
+                localIndices[index] = -1;
+            }
+
+            memcpy(mesh.indices,
+                   indices + indexBegin,
+                   indexCount * sizeof *(mesh.indices));
+
+            UploadMesh(&mesh, false);
+
+            (*meshes)[meshCount++] = mesh;
+
+            indexBegin += indexCount;
+
+            vertexCount = 0, indexCount = 0;
+
+            if (i == importData->indexCount) break;
+        }
+
+        for (int j = 0; j < 3; j++) {
+            int index = (int) importData->indices[i + j];
+
+            if (localIndices[index] < 0)
+                globalIndices[vertexCount] = index,
+                localIndices[index] = vertexCount++;
+
+            indices[indexBegin + indexCount++] = (unsigned short)
+                localIndices[index];
+        }
+    }
+
+    RL_FREE(localIndices), RL_FREE(globalIndices), RL_FREE(indices);
+
+    return meshCount;
+}
@@ -0,0 +1,393 @@
+/*
+    Copyright (c) 2024 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ================================================================ */
+
+#include "mvp-demo.h"
+
+#include <string.h>
+#include <time.h>
+
+/* Macro Constants ========================================================= */
+
+// clang-format off
+
+/* 입력 기록 파일의 식별자와 버전 */
+#define REPLAY_FILE_MAGIC                   "MVPR"
+#define REPLAY_FILE_VERSION                 1
+
+/* 입력 기록 파일 경로의 최대 길이 */
+#define REPLAY_FILE_NAME_LENGTH             512
+
+// clang-format on
+
+/* Typedefs ================================================================ */
+
+/*
+    NOTE: 입력 기록 파일은 같은 환경에서 빌드한 프로그램끼리 비교하기 위한 것이므로,
+    각 구조체를 (바이트 순서 변환 없이) 그대로 저장함
+*/
+
+/* 입력 기록 파일의 헤더 */
+typedef struct ReplayHeader_ {
+    char magic[4];                 // 파일 식별자 (`REPLAY_FILE_MAGIC`)
+    unsigned int version;          // 파일 버전
+    unsigned int seed;             // 난수 생성기의 시드 (seed) 값
+    int screenWidth, screenHeight; // 기록을 시작할 때의 게임 창 크기
+    unsigned int frameCount;       // 기록된 프레임의 개수
+    unsigned int inputEventCount;  // 기록된 입력 이벤트의 개수
+    unsigned int valueEventCount;  // 기록된 GUI 값 변경 이벤트의 개수
+} ReplayHeader;
+
+/* GUI 패널의 값 변경 이벤트 */
+typedef struct ReplayValueEvent_ {
+    unsigned int frame;       // 값이 바뀐 프레임
+    unsigned char channel;    // 값이 바뀐 채널 (`TimelineChannel`)
+    unsigned char component;  // 값이 바뀐 채널의 요소 번호
+    float value;              // 새로운 값
+} ReplayValueEvent;
+
+/* Private Variables ======================================================= */
+
+/* 입력 기록 또는 재생 모드 */
+static ReplayMode replayMode = REPLAY_MODE_NONE;
+
+/* 입력 기록 파일의 경로 */
+static char replayFileName[REPLAY_FILE_NAME_LENGTH];
+
+/* 입력 기록 파일의 헤더 */
+static ReplayHeader replayHeader;
+
+/* 각 프레임의 길이 (초) */
+static float *replayFrameTimes;
+
+/* 마우스, 키보드 및 게임 창 이벤트 */
+static AutomationEventList replayInputEvents;
+
+/* GUI 패널의 값 변경 이벤트 */
+static ReplayValueEvent *replayValueEvents;
+
+/* 재생 모드에서 불러온 입력 기록 파일의 데이터 */
+static unsigned char *replayFileData;
+
+/* 현재 프레임의 번호 */
+static int replayFrame = -1;
+
+/* 다음에 재생할 입력 이벤트와 GUI 값 변경 이벤트의 번호 */
+static unsigned int replayInputIndex = 0, replayValueIndex = 0;
+
+/* 첫 번째 프레임을 시작한 시간 */
+static double replayStartTime = 0.0;
+
+/* 입력 재생이 끝났는지 여부 */
+static bool isReplayFinished = false;
+
+/* 기록 공간 부족 경고를 이미 출력했는지 여부 */
+static bool replayOverflowReported = false;
+
+/* Public Functions ======================================================== */
+
+/* `fileName` 파일에 입력 기록을 시작하는 함수 */
+bool BeginReplayRecording(const char *fileName) {
+    if (replayMode != REPLAY_MODE_NONE || fileName == NULL) return false;
+
+    replayFrameTimes = MemAlloc(REPLAY_FRAME_CAPACITY
+                                * sizeof *replayFrameTimes);
+    replayValueEvents = MemAlloc(REPLAY_VALUE_EVENT_CAPACITY
+                                 * sizeof *replayValueEvents);
+
+    if (replayFrameTimes == NULL || replayValueEvents == NULL) {
+        TraceLog(LOG_WARNING, "REPLAY: Failed to allocate recording buffers");
+
+        MemFree(replayFrameTimes), MemFree(replayValueEvents);
+
+        replayFrameTimes = NULL, replayValueEvents = NULL;
+
+        return false;
+    }
+
+    strncpy(replayFileName, fileName, REPLAY_FILE_NAME_LENGTH - 1);
+
+    memcpy(replayHeader.magic, REPLAY_FILE_MAGIC, sizeof replayHeader.magic);
+
+    replayHeader.version = REPLAY_FILE_VERSION;
+    replayHeader.seed = (unsigned int) time(NULL);
+    replayHeader.screenWidth = GetScreenWidth();
+    replayHeader.screenHeight = GetScreenHeight();
+
+    // NOTE: 적 모델의 회전 각도 등이 같도록, 게임 화면 초기화 전에 시드 값 설정
+    SetRandomSeed(replayHeader.seed);
+
+    // raylib의 자동화 이벤트 기능으로 마우스, 키보드 및 게임 창 이벤트 기록
+    replayInputEvents = LoadAutomationEventList(NULL);
+
+    SetAutomationEventList(&replayInputEvents);
+    SetAutomationEventBaseFrame(0);
+
+    StartAutomationEventRecording();
+
+    replayMode = REPLAY_MODE_RECORD;
+
+    TraceLog(LOG_INFO, "REPLAY: Recording inputs to '%s'", replayFileName);
+
+    return true;
+}
+
+/* `fileName` 파일의 입력 기록을 재생하기 시작하는 함수 */
+bool BeginReplayPlayback(const char *fileName) {
+    if (replayMode != REPLAY_MODE_NONE || fileName == NULL) return false;
+
+    int dataSize = 0;
+
+    unsigned char *data = LoadFileData(fileName, &dataSize);
+
+    if (data == NULL) return false;
+
+    ReplayHeader header = { 0 };
+
+    if (dataSize >= (int) sizeof header) memcpy(&header, data, sizeof header);
+
+    size_t expectedSize = sizeof header
+                          + header.frameCount * sizeof *replayFrameTimes
+                          + header.inputEventCount * sizeof(AutomationEvent)
+                          + header.valueEventCount * sizeof *replayValueEvents;
+
+    if (memcmp(header.magic, REPLAY_FILE_MAGIC, sizeof header.magic) != 0
+        || header.version != REPLAY_FILE_VERSION
+        || (size_t) dataSize != expectedSize) {
+        TraceLog(LOG_WARNING, "REPLAY: [%s] Invalid replay file", fileName);
+
+        UnloadFileData(data);
+
+        return false;
+    }
+
+    // NOTE: 각 배열은 불러온 파일의 데이터를 그대로 가리킴
+    unsigned char *ptr = data + sizeof header;
+
+    replayFrameTimes = (float *) ptr;
+
+    ptr += header.frameCount * sizeof *replayFrameTimes;
+
+    replayInputEvents = (AutomationEventList) {
+        .capacity = header.inputEventCount,
+        .count = header.inputEventCount,
+        .events = (AutomationEvent *) ptr
+    };
+
+    ptr += header.inputEventCount * sizeof(AutomationEvent);
+
+    replayValueEvents = (ReplayValueEvent *) ptr;
+
+    strncpy(replayFileName, fileName, REPLAY_FILE_NAME_LENGTH - 1);
+
+    replayHeader = header, replayFileData = data;
+
+    SetRandomSeed(replayHeader.seed);
+
+    // 마우스 좌표가 같은 위젯을 가리키도록, 기록할 때의 게임 창 크기로 변경
+    SetWindowSize(replayHeader.screenWidth, replayHeader.screenHeight);
+
+    replayMode = REPLAY_MODE_PLAY;
+
+    TraceLog(LOG_INFO,
+             "REPLAY: Playing %u frames from '%s'",
+             replayHeader.frameCount,
+             replayFileName);
+
+    return true;
+}
+
+/* 입력 기록 또는 재생을 끝내는 함수 */
+void EndReplay(void) {
+    if (replayMode == REPLAY_MODE_RECORD) {
+        StopAutomationEventRecording();
+
+        replayHeader.inputEventCount = replayInputEvents.count;
+
+        size_t frameTimesSize = replayHeader.frameCount
+                                * sizeof *replayFrameTimes;
+        size_t inputEventsSize = replayHeader.inputEventCount
+                                 * sizeof(AutomationEvent);
+        size_t valueEventsSize = replayHeader.valueEventCount
+                                 * sizeof *replayValueEvents;
+
+        size_t dataSize = sizeof replayHeader + frameTimesSize
+                          + inputEventsSize + valueEventsSize;
+
+        unsigned char *data = MemAlloc(dataSize);
+
+        if (data != NULL) {
+            unsigned char *ptr = data;
+
+            memcpy(ptr, &replayHeader, sizeof replayHeader);
+            ptr += sizeof replayHeader;
+
+            memcpy(ptr, replayFrameTimes, frameTimesSize);
+            ptr += frameTimesSize;
+
+            memcpy(ptr, replayInputEvents.events, inputEventsSize);
+            ptr += inputEventsSize;
+
+            memcpy(ptr, replayValueEvents, valueEventsSize);
+
+            if (SaveFileData(replayFileName, data, (int) dataSize))
+                TraceLog(LOG_INFO,
+                         "REPLAY: Recorded %u frames (%u input events, "
+                         "%u value events)",
+                         replayHeader.frameCount,
+                         replayHeader.inputEventCount,
+                         replayHeader.valueEventCount);
+
+            MemFree(data);
+        }
+
+        SetAutomationEventList(NULL);
+
+        UnloadAutomationEventList(replayInputEvents);
+
+        MemFree(replayFrameTimes), MemFree(replayValueEvents);
+    } else if (replayMode == REPLAY_MODE_PLAY) {
+        UnloadFileData(replayFileData);
+    }
+
+    replayFrameTimes = NULL, replayValueEvents = NULL, replayFileData = NULL;
+
+    replayInputEvents = (AutomationEventList) { 0 };
+
+    replayMode = REPLAY_MODE_NONE;
+}
+
+/* 입력 기록 또는 재생 모드를 반환하는 함수 */
+ReplayMode GetReplayMode(void) {
+    return replayMode;
+}
+
+/* 입력 재생이 끝났는지 확인하는 함수 */
+bool IsReplayFinished(void) {
+    return isReplayFinished;
+}
+
+/* 새로운 프레임을 시작할 때, 입력을 기록하거나 기록된 입력을 재생하는 함수 */
+void UpdateReplay(void) {
+    if (replayMode == REPLAY_MODE_NONE || isReplayFinished) return;
+
+    replayFrame++;
+
+    if (replayFrame == 0) replayStartTime = GetTime();
+
+    if (replayMode == REPLAY_MODE_RECORD) {
+        if (replayFrame >= REPLAY_FRAME_CAPACITY) {
+            if (replayFrame == REPLAY_FRAME_CAPACITY) {
+                TraceLog(LOG_WARNING,
+                         "REPLAY: Reached the maximum of %d frames",
+                         REPLAY_FRAME_CAPACITY);
+
+                StopAutomationEventRecording();
+            }
+
+            return;
+        }
+
+        replayFrameTimes[replayFrame] = GetFrameTime();
+
+        replayHeader.frameCount = replayFrame + 1;
+    } else {
+        if (replayFrame >= (int) replayHeader.frameCount) {
+            double elapsedTime = GetTime() - replayStartTime;
+
+            TraceLog(LOG_INFO,
+                     "REPLAY: Played %u frames in %.3f s (%.3f ms/frame)",
+                     replayHeader.frameCount,
+                     elapsedTime,
+                     (replayHeader.frameCount > 0)
+                         ? (1000.0 * elapsedTime) / replayHeader.frameCount
+                         : 0.0);
+
+            isReplayFinished = true;
+
+            return;
+        }
+
+        /*
+            NOTE: 이전 프레임이 끝날 때 (= `EndDrawing()`) 기록된 입력 이벤트는
+            현재 프레임에서 처리되었으므로, 현재 프레임보다 앞선 이벤트만 재생
+        */
+        while (replayInputIndex < replayInputEvents.count
+               && replayInputEvents.events[replayInputIndex].frame
+                      < (unsigned int) replayFrame)
+            PlayAutomationEvent(replayInputEvents.events[replayInputIndex++]);
+    }
+}
+
+/* 현재 프레임의 길이를 반환하는 함수 (재생 모드에서는 기록된 프레임의 길이) */
+float GetReplayFrameTime(void) {
+    if (replayMode == REPLAY_MODE_PLAY && replayFrame >= 0
+        && replayFrame < (int) replayHeader.frameCount)
+        return replayFrameTimes[replayFrame];
+
+    return GetFrameTime();
+}
+
+/* 현재 프레임에서 바뀐 GUI 패널의 값을 기록하는 함수 */
+void RecordReplayValue(TimelineChannel channel, int component, float value) {
+    if (replayMode != REPLAY_MODE_RECORD || replayFrame < 0
+        || replayFrame >= REPLAY_FRAME_CAPACITY)
+        return;
+
+    if (replayHeader.valueEventCount >= REPLAY_VALUE_EVENT_CAPACITY) {
+        if (!replayOverflowReported) {
+            TraceLog(LOG_WARNING,
+                     "REPLAY: Reached the maximum of %d value events",
+                     REPLAY_VALUE_EVENT_CAPACITY);
+
+            replayOverflowReported = true;
+        }
+
+        return;
+    }
+
+    replayValueEvents[replayHeader.valueEventCount++] = (ReplayValueEvent) {
+        .frame = replayFrame,
+        .channel = channel,
+        .component = component,
+        .value = value
+    };
+}
+
+/* 현재 프레임까지 기록된 GUI 패널의 값 변경 이벤트를 하나씩 반환하는 함수 */
+bool PollReplayValue(TimelineChannel *channel, int *component, float *value) {
+    if (replayMode != REPLAY_MODE_PLAY || replayFrame < 0) return false;
+
+    if (replayValueIndex >= replayHeader.valueEventCount
+        || replayValueEvents[replayValueIndex].frame
+               > (unsigned int) replayFrame)
+        return false;
+
+    const ReplayValueEvent *event = &replayValueEvents[replayValueIndex++];
+
+    if (channel != NULL) *channel = event->channel;
+    if (component != NULL) *component = event->component;
+    if (value != NULL) *value = event->value;
+
+    return true;
+}
@@ -0,0 +1,190 @@
+/*
+    Copyright (c) 2024 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ================================================================ */
+
+#include "mvp-demo.h"
+
+/* Macro Constants ========================================================= */
+
+// clang-format off
+
+/* 노드의 TRS 값이 바뀌어 "로컬 행렬"을 다시 계산해야 함 */
+#define SCENE_NODE_LOCAL_DIRTY              (1 << 0)
+
+/* 노드 또는 부모 노드가 바뀌어 "세계 행렬"을 다시 계산해야 함 */
+#define SCENE_NODE_WORLD_DIRTY              (1 << 1)
+
+// clang-format on
+
+/* Typedefs ================================================================ */
+
+/* 장면 그래프의 노드 */
+typedef struct SceneNode_ {
+    int parent;              // 부모 노드의 번호 (-1: 루트 노드)
+    Vector3 translation;     // 이동 변환
+    Quaternion rotation;     // 회전 변환
+    Vector3 scale;           // 크기 변환
+    Matrix localMat;         // "로컬 행렬" (부모 노드 기준)
+    Matrix worldMat;         // "세계 행렬"
+    unsigned int flags;      // 다시 계산해야 하는 행렬의 종류
+} SceneNode;
+
+/* Private Variables ======================================================= */
+
+/* 장면 그래프의 노드 배열 (부모 노드가 항상 자식 노드보다 앞에 있음) */
+static SceneNode sceneNodes[SCENE_NODE_CAPACITY];
+
+/* 장면 그래프의 노드 개수 */
+static int sceneNodeCount = 0;
+
+/* 다시 계산해야 하는 노드 중 가장 앞에 있는 노드의 번호 */
+static int firstDirtyIndex = SCENE_NODE_CAPACITY;
+
+/* Private Function Prototypes ============================================= */
+
+/* `index`번째 노드를 다시 계산해야 한다고 표시하는 함수 */
+static void MarkSceneNodeDirty(int index, unsigned int flags);
+
+/* Public Functions ======================================================== */
+
+/* 장면 그래프에 `parent`번째 노드의 자식 노드를 추가하고, 그 번호를 반환하는 함수 */
+int CreateSceneNode(int parent) {
+    // NOTE: 부모 노드의 번호는 항상 자식 노드의 번호보다 작아야 함
+    if (parent >= sceneNodeCount) {
+        TraceLog(LOG_WARNING, "SCENE: Invalid parent node index: %d", parent);
+
+        return -1;
+    }
+
+    if (sceneNodeCount >= SCENE_NODE_CAPACITY) {
+        TraceLog(LOG_WARNING,
+                 "SCENE: Failed to create node (%d / %d in use)",
+                 sceneNodeCount,
+                 SCENE_NODE_CAPACITY);
+
+        return -1;
+    }
+
+    int index = sceneNodeCount++;
+
+    sceneNodes[index] = (SceneNode) { .parent = (parent >= 0) ? parent : -1,
+                                      .rotation = QuaternionIdentity(),
+                                      .scale = Vector3One(),
+                                      .localMat = MatrixIdentity(),
+                                      .worldMat = MatrixIdentity() };
+
+    MarkSceneNodeDirty(index, SCENE_NODE_WORLD_DIRTY);
+
+    return index;
+}
+
+/* 장면 그래프의 모든 노드를 제거하는 함수 */
+void ResetSceneGraph(void) {
+    sceneNodeCount = 0;
+
+    firstDirtyIndex = SCENE_NODE_CAPACITY;
+}
+
+/* `index`번째 노드의 TRS 값을 설정하는 함수 */
+void SetSceneNodeTRS(int index,
+                     Vector3 translation,
+                     Quaternion rotation,
+                     Vector3 scale) {
+    if (index < 0 || index >= sceneNodeCount) return;
+
+    SceneNode *node = &sceneNodes[index];
+
+    node->translation = translation;
+    node->rotation = rotation;
+    node->scale = scale;
+
+    MarkSceneNodeDirty(index, SCENE_NODE_LOCAL_DIRTY | SCENE_NODE_WORLD_DIRTY);
+}
+
+/* `index`번째 노드의 "로컬 행렬"을 직접 설정하는 함수 */
+void SetSceneNodeLocalMat(int index, Matrix localMat) {
+    if (index < 0 || index >= sceneNodeCount) return;
+
+    SceneNode *node = &sceneNodes[index];
+
+    // NOTE: TRS 값으로 "로컬 행렬"을 다시 만들지 않도록 해당 표시를 지움
+    node->localMat = localMat;
+    node->flags &= ~SCENE_NODE_LOCAL_DIRTY;
+
+    MarkSceneNodeDirty(index, SCENE_NODE_WORLD_DIRTY);
+}
+
+/* `index`번째 노드의 "세계 행렬"을 반환하는 함수 */
+Matrix GetSceneNodeWorldMat(int index) {
+    if (index < 0 || index >= sceneNodeCount) return MatrixIdentity();
+
+    // 바뀐 노드가 있을 때만 장면 그래프를 업데이트
+    if (firstDirtyIndex <= index) UpdateSceneGraph();
+
+    return sceneNodes[index].worldMat;
+}
+
+/* 바뀐 노드와 그 자식 노드들의 "세계 행렬"을 다시 계산하는 함수 */
+void UpdateSceneGraph(void) {
+    if (firstDirtyIndex >= sceneNodeCount) return;
+
+    /*
+        NOTE: 부모 노드가 항상 자식 노드보다 앞에 있으므로, 가장 앞에 있는 바뀐
+        노드부터 배열을 한 번만 순회하면 바뀐 부분 트리만 다시 계산할 수 있음
+    */
+    for (int i = firstDirtyIndex; i < sceneNodeCount; i++) {
+        SceneNode *node = &sceneNodes[i];
+
+        if (node->parent >= 0
+            && (sceneNodes[node->parent].flags & SCENE_NODE_WORLD_DIRTY))
+            node->flags |= SCENE_NODE_WORLD_DIRTY;
+
+        if (!(node->flags & SCENE_NODE_WORLD_DIRTY)) continue;
+
+        if (node->flags & SCENE_NODE_LOCAL_DIRTY)
+            node->localMat = ComposeTRSMat(node->translation,
+                                           node->rotation,
+                                           node->scale);
+
+        node->worldMat = (node->parent >= 0)
+                             ? MatrixMultiply(node->localMat,
+                                              sceneNodes[node->parent]
+                                                  .worldMat)
+                             : node->localMat;
+    }
+
+    // 자식 노드들이 모두 업데이트된 후에 표시를 지움
+    for (int i = firstDirtyIndex; i < sceneNodeCount; i++)
+        sceneNodes[i].flags = 0;
+
+    firstDirtyIndex = SCENE_NODE_CAPACITY;
+}
+
+/* Private Functions ======================================================= */
+
+/* `index`번째 노드를 다시 계산해야 한다고 표시하는 함수 */
+static void MarkSceneNodeDirty(int index, unsigned int flags) {
+    sceneNodes[index].flags |= flags;
+
+    if (firstDirtyIndex > index) firstDirtyIndex = index;
+}
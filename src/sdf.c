@@ -0,0 +1,293 @@
+/*
+    Copyright (c) 2024 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ================================================================ */
+
+#include "mvp-demo.h"
+
+#include <math.h>
+
+/* Macro Constants ========================================================= */
+
+// clang-format off
+
+/* SDF 글꼴 아틀라스를 만들 때, 원본 글꼴의 글리프를 확대할 배율 */
+#define SDF_FONT_SCALE                      2
+
+/* 글리프의 경계로부터 거리를 기록할 최대 범위 (픽셀) */
+#define SDF_FONT_SPREAD                     4
+
+/* SDF 글꼴 아틀라스의 너비 */
+#define SDF_ATLAS_WIDTH                     512
+
+/* 원본 글꼴에서 글리프의 내부로 판단할 최소 알파 값 */
+#define SDF_ALPHA_THRESHOLD                 128
+
+// clang-format on
+
+/* Private Variables ======================================================= */
+
+/* 부호 있는 거리 필드 (signed distance field)가 저장된 글꼴 */
+static Font sdfFont;
+
+/* SDF 글꼴로 문자열을 그리는 셰이더 프로그램 */
+static Shader sdfShader;
+
+/* `BeginSdfText()`가 중첩하여 호출된 횟수 */
+static int sdfTextDepth = 0;
+
+/* Private Function Prototypes ============================================= */
+
+/* `(x, y)`에서 글리프의 경계까지의 부호 있는 거리를 계산하는 함수 */
+static float ComputeGlyphDistance(const Image *image,
+                                  Rectangle rec,
+                                  int x,
+                                  int y);
+
+/* 확대된 글리프의 `(x, y)`가 글리프의 내부인지 확인하는 함수 */
+static bool IsGlyphPixelInside(const Image *image,
+                               Rectangle rec,
+                               int x,
+                               int y);
+
+/* Public Functions ======================================================== */
+
+/* `font`의 글리프들로 SDF 글꼴 아틀라스를 만드는 함수 */
+bool InitSdfFont(Font font, Image fontImage) {
+    if (sdfFont.texture.id > 0) UnloadSdfFont();
+
+    if (font.glyphCount <= 0 || font.recs == NULL || font.glyphs == NULL
+        || fontImage.data == NULL)
+        return false;
+
+    // NOTE: 원본 글꼴의 알파 값만 사용하므로, 픽셀 형식을 하나로 통일
+    Image alphaImage = ImageCopy(fontImage);
+
+    ImageFormat(&alphaImage, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    Rectangle *recs = RL_CALLOC(font.glyphCount, sizeof *recs);
+    GlyphInfo *glyphs = RL_CALLOC(font.glyphCount, sizeof *glyphs);
+
+    int penX = 0, penY = 0, rowHeight = 0;
+
+    // 확대된 글리프와 여백을 한 줄씩 차례대로 배치
+    for (int i = 0; i < font.glyphCount; i++) {
+        int paddedWidth = font.recs[i].width * SDF_FONT_SCALE
+                          + 2 * SDF_FONT_SPREAD;
+        int paddedHeight = font.recs[i].height * SDF_FONT_SCALE
+                           + 2 * SDF_FONT_SPREAD;
+
+        if (penX + paddedWidth > SDF_ATLAS_WIDTH)
+            penX = 0, penY += rowHeight, rowHeight = 0;
+
+        recs[i] = (Rectangle) { .x = penX + SDF_FONT_SPREAD,
+                                .y = penY + SDF_FONT_SPREAD,
+                                .width = font.recs[i].width * SDF_FONT_SCALE,
+                                .height = font.recs[i].height
+                                          * SDF_FONT_SCALE };
+
+        glyphs[i] = (GlyphInfo) {
+            .value = font.glyphs[i].value,
+            .offsetX = font.glyphs[i].offsetX * SDF_FONT_SCALE,
+            .offsetY = font.glyphs[i].offsetY * SDF_FONT_SCALE,
+            .advanceX = font.glyphs[i].advanceX * SDF_FONT_SCALE
+        };
+
+        penX += paddedWidth;
+
+        if (rowHeight < paddedHeight) rowHeight = paddedHeight;
+    }
+
+    int atlasHeight = 1;
+
+    while (atlasHeight < penY + rowHeight)
+        atlasHeight <<= 1;
+
+    // NOTE: 거리 값만 저장하므로, 1바이트 픽셀 형식을 사용
+    Image atlasImage = {
+        .data = RL_CALLOC(SDF_ATLAS_WIDTH * atlasHeight, 1),
+        .width = SDF_ATLAS_WIDTH,
+        .height = atlasHeight,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+    };
+
+    unsigned char *atlasPixels = atlasImage.data;
+
+    for (int i = 0; i < font.glyphCount; i++) {
+        int paddedWidth = recs[i].width + 2 * SDF_FONT_SPREAD;
+        int paddedHeight = recs[i].height + 2 * SDF_FONT_SPREAD;
+
+        int atlasX = recs[i].x - SDF_FONT_SPREAD;
+        int atlasY = recs[i].y - SDF_FONT_SPREAD;
+
+        for (int y = 0; y < paddedHeight; y++)
+            for (int x = 0; x < paddedWidth; x++) {
+                float distance = ComputeGlyphDistance(&alphaImage,
+                                                      font.recs[i],
+                                                      x - SDF_FONT_SPREAD,
+                                                      y - SDF_FONT_SPREAD);
+
+                // 글리프의 경계가 0.5가 되도록 거리 값을 [0, 1] 범위로 변환
+                float value = 0.5f + distance / (2.0f * SDF_FONT_SPREAD);
+
+                atlasPixels[(atlasY + y) * SDF_ATLAS_WIDTH + (atlasX + x)] =
+                    (unsigned char) (255.0f * Clamp(value, 0.0f, 1.0f) + 0.5f);
+            }
+    }
+
+    UnloadImage(alphaImage);
+
+    sdfShader = LoadSdfTextShader();
+
+    if (sdfShader.id == 0 || sdfShader.id == rlGetShaderIdDefault()) {
+        TraceLog(LOG_WARNING, "SDF: Failed to load SDF text shader");
+
+        UnloadImage(atlasImage), RL_FREE(recs), RL_FREE(glyphs);
+
+        sdfShader = (Shader) { 0 };
+
+        return false;
+    }
+
+    sdfFont = (Font) { .baseSize = font.baseSize * SDF_FONT_SCALE,
+                       .glyphCount = font.glyphCount,
+                       .glyphPadding = SDF_FONT_SPREAD,
+                       .texture = LoadTextureFromImage(atlasImage),
+                       .recs = recs,
+                       .glyphs = glyphs };
+
+    // NOTE: 거리 값을 보간해야 확대해도 글리프의 경계가 선명하게 유지됨
+    SetTextureFilter(sdfFont.texture, TEXTURE_FILTER_BILINEAR);
+
+    UnloadImage(atlasImage);
+
+    TraceLog(LOG_INFO,
+             "SDF: SDF font atlas created (%d glyphs, %dx%d)",
+             sdfFont.glyphCount,
+             SDF_ATLAS_WIDTH,
+             atlasHeight);
+
+    return true;
+}
+
+/* SDF 글꼴에 필요한 메모리 공간을 해제하는 함수 */
+void UnloadSdfFont(void) {
+    if (sdfFont.texture.id == 0) return;
+
+    UnloadShaderVariant(sdfShader), sdfShader = (Shader) { 0 };
+
+    UnloadFont(sdfFont), sdfFont = (Font) { 0 };
+
+    sdfTextDepth = 0;
+}
+
+/* SDF 글꼴로 문자열을 그리기 시작하는 함수 */
+void BeginSdfText(void) {
+    if (sdfShader.id == 0) return;
+
+    // NOTE: 셰이더 프로그램을 바꾸지 않는 동안의 문자열은 한 번에 그려짐
+    if (sdfTextDepth++ == 0) BeginShaderMode(sdfShader);
+}
+
+/* SDF 글꼴로 문자열을 그리는 것을 끝내는 함수 */
+void EndSdfText(void) {
+    if (sdfShader.id == 0 || sdfTextDepth <= 0) return;
+
+    if (--sdfTextDepth == 0) EndShaderMode();
+}
+
+/* SDF 글꼴로 `text`를 그리는 함수 */
+void DrawSdfText(const char *text,
+                 Vector2 position,
+                 float fontSize,
+                 float spacing,
+                 Color tint) {
+    // NOTE: SDF 글꼴을 만들지 못했다면, 기본 글꼴을 그대로 확대하여 그림
+    if (sdfFont.texture.id == 0) {
+        DrawTextEx(GetDefaultFont(), text, position, fontSize, spacing, tint);
+
+        return;
+    }
+
+    BeginSdfText();
+
+    DrawTextEx(sdfFont, text, position, fontSize, spacing, tint);
+
+    EndSdfText();
+}
+
+/* SDF 글꼴로 그릴 `text`의 크기를 계산하는 함수 */
+Vector2 MeasureSdfText(const char *text, float fontSize, float spacing) {
+    return MeasureTextEx((sdfFont.texture.id > 0) ? sdfFont : GetDefaultFont(),
+                         text,
+                         fontSize,
+                         spacing);
+}
+
+/* Private Functions ======================================================= */
+
+/* `(x, y)`에서 글리프의 경계까지의 부호 있는 거리를 계산하는 함수 */
+static float ComputeGlyphDistance(const Image *image,
+                                  Rectangle rec,
+                                  int x,
+                                  int y) {
+    bool isInside = IsGlyphPixelInside(image, rec, x, y);
+
+    float minDistanceSqr = (float) (SDF_FONT_SPREAD * SDF_FONT_SPREAD);
+
+    // 최대 범위 안에서 내부와 외부가 반대인 가장 가까운 픽셀 찾기
+    for (int dy = -SDF_FONT_SPREAD; dy <= SDF_FONT_SPREAD; dy++)
+        for (int dx = -SDF_FONT_SPREAD; dx <= SDF_FONT_SPREAD; dx++) {
+            float distanceSqr = (float) (dx * dx + dy * dy);
+
+            if (distanceSqr >= minDistanceSqr) continue;
+
+            if (IsGlyphPixelInside(image, rec, x + dx, y + dy) != isInside)
+                minDistanceSqr = distanceSqr;
+        }
+
+    // NOTE: 픽셀의 중심이 아닌, 두 픽셀 사이의 경계까지의 거리를 반환
+    float distance = sqrtf(minDistanceSqr) - 0.5f;
+
+    return isInside ? distance : -distance;
+}
+
+/* 확대된 글리프의 `(x, y)`가 글리프의 내부인지 확인하는 함수 */
+static bool IsGlyphPixelInside(const Image *image,
+                               Rectangle rec,
+                               int x,
+                               int y) {
+    if (x < 0 || y < 0 || x >= rec.width * SDF_FONT_SCALE
+        || y >= rec.height * SDF_FONT_SCALE)
+        return false;
+
+    int imageX = (int) rec.x + x / SDF_FONT_SCALE;
+    int imageY = (int) rec.y + y / SDF_FONT_SCALE;
+
+    if (imageX >= image->width || imageY >= image->height) return false;
+
+    const unsigned char *pixels = image->data;
+
+    return pixels[4 * (imageY * image->width + imageX) + 3]
+           >= SDF_ALPHA_THRESHOLD;
+}
@@ -0,0 +1,622 @@
+/*
+    Copyright (c) 2024 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ================================================================ */
+
+#include "mvp-demo.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#if !defined(PLATFORM_WEB)
+    // NOTE: WebGL에서는 셰이더 프로그램의 바이너리를 가져올 수 없음
+    #define SHADER_USE_PROGRAM_BINARY
+
+    // NOTE: raylib은 GLFW 라이브러리로 OpenGL 컨텍스트를 만듦
+    extern void (*glfwGetProcAddress(const char *procName))(void);
+#endif
+
+/* Macro Constants ========================================================= */
+
+// clang-format off
+
+/* 셰이더 프로그램 바이너리 캐시 파일의 식별자와 버전 */
+#define SHADER_CACHE_FILE_MAGIC             "MVPB"
+#define SHADER_CACHE_FILE_VERSION           1
+
+/* 셰이더 프로그램 바이너리 캐시 파일의 이름 */
+#define SHADER_CACHE_FILE_NAME              "%s/%016llx.bin"
+
+/* 한 번에 불러올 수 있는 셰이더 변형의 최대 개수 */
+#define SHADER_VARIANT_CAPACITY             16
+
+/* 셰이더 변형의 `#version` 지시문과 상수 정의를 저장할 버퍼의 크기 */
+#define SHADER_PROLOGUE_LENGTH              1024
+
+/* FNV-1a 해시 함수의 초기값과 곱하는 수 */
+#define FNV_OFFSET_BASIS                    0xcbf29ce484222325ULL
+#define FNV_PRIME                           0x100000001b3ULL
+
+/* ========================================================================= */
+
+#define GL_VENDOR                           0x1F00
+#define GL_RENDERER                         0x1F01
+#define GL_VERSION                          0x1F02
+#define GL_LINK_STATUS                      0x8B82
+#define GL_PROGRAM_BINARY_LENGTH            0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS       0x87FE
+
+#if defined(_WIN32) && !defined(_WIN64)
+    #define GL_API_ENTRY                    __stdcall
+#else
+    #define GL_API_ENTRY
+#endif
+
+// clang-format on
+
+/* Typedefs ================================================================ */
+
+/* 셰이더 프로그램 바이너리 캐시 파일의 헤더 */
+typedef struct ShaderCacheHeader_ {
+    char magic[4];           // 파일 식별자 (`SHADER_CACHE_FILE_MAGIC`)
+    unsigned int version;    // 파일 버전
+    uint64_t keyHash;        // GPU 드라이버 정보와 셰이더 소스 코드의 해시 값
+    unsigned int format;     // 셰이더 프로그램 바이너리의 형식
+    unsigned int binarySize; // 셰이더 프로그램 바이너리의 크기
+} ShaderCacheHeader;
+
+/* 상수 정의에 따라 따로 컴파일된 셰이더 프로그램 */
+typedef struct ShaderVariant_ {
+    uint64_t keyHash;  // 상수 정의와 셰이더 소스 코드의 해시 값
+    Shader shader;     // 셰이더 프로그램
+    int refCount;      // 셰이더 프로그램을 사용하고 있는 곳의 개수
+} ShaderVariant;
+
+/* OpenGL 함수들의 형식 */
+typedef const unsigned char *(GL_API_ENTRY *GlGetStringFunc)(unsigned int);
+typedef void(GL_API_ENTRY *GlGetIntegervFunc)(unsigned int, int *);
+typedef unsigned int(GL_API_ENTRY *GlCreateProgramFunc)(void);
+typedef void(GL_API_ENTRY *GlDeleteProgramFunc)(unsigned int);
+typedef void(GL_API_ENTRY *GlGetProgramivFunc)(unsigned int,
+                                                unsigned int,
+                                                int *);
+typedef void(GL_API_ENTRY *GlGetProgramBinaryFunc)(unsigned int,
+                                                    int,
+                                                    int *,
+                                                    unsigned int *,
+                                                    void *);
+typedef void(GL_API_ENTRY *GlProgramBinaryFunc)(unsigned int,
+                                                 unsigned int,
+                                                 const void *,
+                                                 int);
+
+/* OpenGL 함수들의 주소 */
+typedef struct GlProgramBinaryFuncs_ {
+    GlGetStringFunc getString;
+    GlGetIntegervFunc getIntegerv;
+    GlCreateProgramFunc createProgram;
+    GlDeleteProgramFunc deleteProgram;
+    GlGetProgramivFunc getProgramiv;
+    GlGetProgramBinaryFunc getProgramBinary;
+    GlProgramBinaryFunc programBinary;
+} GlProgramBinaryFuncs;
+
+/* Private Variables ======================================================= */
+
+/* 셰이더 프로그램 바이너리를 다루는 OpenGL 함수들의 주소 */
+static GlProgramBinaryFuncs gl;
+
+/* 셰이더 프로그램 바이너리 캐시를 사용할 수 있는지 여부 (-1: 확인하기 전) */
+static int isProgramBinarySupported = -1;
+
+/* 셰이더 프로그램 바이너리 캐시에서 셰이더 프로그램을 찾은 횟수 */
+static int shaderCacheHitCount = 0;
+
+/* 셰이더 프로그램 바이너리 캐시에서 셰이더 프로그램을 찾지 못한 횟수 */
+static int shaderCacheMissCount = 0;
+
+/* 지금까지 불러온 셰이더 변형 목록 */
+static ShaderVariant shaderVariants[SHADER_VARIANT_CAPACITY];
+
+/* Private Function Prototypes ============================================= */
+
+/* `#version` 지시문과 상수 정의로 셰이더 소스 코드의 앞부분을 만드는 함수 */
+static int BuildShaderPrologue(char *buffer,
+                               int bufferSize,
+                               const ShaderDefine *defines,
+                               int defineCount);
+
+/* FNV-1a 해시 함수로 `text`의 해시 값을 `hash`에 누적하는 함수 */
+static uint64_t HashShaderText(uint64_t hash, const char *text);
+
+/* `prologue`와 `code`를 이어붙인 셰이더 소스 코드를 만드는 함수 */
+static char *JoinShaderSource(const char *prologue, const char *code);
+
+/* 셰이더 프로그램 바이너리를 다루는 OpenGL 함수들을 불러오는 함수 */
+static bool LoadProgramBinaryFuncs(void);
+
+/* 셰이더 프로그램 바이너리 캐시 파일로 셰이더 프로그램을 만드는 함수 */
+static unsigned int LoadProgramFromCache(const char *fileName,
+                                         uint64_t keyHash);
+
+/* 셰이더 프로그램으로 raylib의 셰이더를 만드는 함수 */
+static Shader LoadShaderFromProgram(unsigned int programId);
+
+/* 셰이더 프로그램의 바이너리를 캐시 파일에 저장하는 함수 */
+static bool SaveProgramToCache(const char *fileName,
+                               uint64_t keyHash,
+                               unsigned int programId);
+
+/* Public Functions ======================================================== */
+
+/* 셰이더 프로그램 바이너리 캐시를 사용하여 셰이더 프로그램을 만드는 함수 */
+Shader LoadCachedShader(const char *vsCode, const char *fsCode) {
+    if (!LoadProgramBinaryFuncs())
+        return LoadShaderFromMemory(vsCode, fsCode);
+
+    uint64_t keyHash = FNV_OFFSET_BASIS;
+
+    {
+        /*
+            NOTE: 셰이더 프로그램 바이너리는 같은 GPU와 드라이버에서만 사용할 수
+            있으므로, 드라이버 정보와 소스 코드를 모두 캐시 키에 포함함
+        */
+
+        const unsigned int keyStrings[] = { GL_VENDOR,
+                                            GL_RENDERER,
+                                            GL_VERSION };
+
+        for (int i = 0; i < (int) (sizeof keyStrings / sizeof *keyStrings); i++)
+            keyHash = HashShaderText(
+                keyHash,
+                (const char *) gl.getString(keyStrings[i]));
+
+        keyHash = HashShaderText(keyHash, vsCode);
+        keyHash = HashShaderText(keyHash, fsCode);
+    }
+
+    const char *fileName = TextFormat(SHADER_CACHE_FILE_NAME,
+                                      SHADER_CACHE_DIRECTORY,
+                                      (unsigned long long) keyHash);
+
+    unsigned int programId = LoadProgramFromCache(fileName, keyHash);
+
+    if (programId > 0) {
+        shaderCacheHitCount++;
+
+        TraceLog(LOG_INFO,
+                 "SHADER: [%016llx] Program binary cache hit (%d hit(s), "
+                 "%d miss(es))",
+                 (unsigned long long) keyHash,
+                 shaderCacheHitCount,
+                 shaderCacheMissCount);
+
+        return LoadShaderFromProgram(programId);
+    }
+
+    shaderCacheMissCount++;
+
+    TraceLog(LOG_INFO,
+             "SHADER: [%016llx] Program binary cache miss (%d hit(s), "
+             "%d miss(es))",
+             (unsigned long long) keyHash,
+             shaderCacheHitCount,
+             shaderCacheMissCount);
+
+    // 캐시 파일이 없거나 사용할 수 없다면, 소스 코드를 컴파일하고 다시 저장
+    Shader result = LoadShaderFromMemory(vsCode, fsCode);
+
+    if (result.id > 0 && result.id != rlGetShaderIdDefault())
+        SaveProgramToCache(fileName, keyHash, result.id);
+
+    return result;
+}
+
+/* 상수 정의를 추가한 셰이더 변형을 만들거나, 이미 만든 셰이더 변형을 반환하는 함수 */
+Shader LoadShaderVariant(const char *vsCode,
+                         const char *fsCode,
+                         const ShaderDefine *defines,
+                         int defineCount) {
+    char prologue[SHADER_PROLOGUE_LENGTH];
+
+    if (BuildShaderPrologue(prologue,
+                            sizeof prologue,
+                            defines,
+                            defineCount) < 0) {
+        TraceLog(LOG_WARNING,
+                 "SHADER: Too many defines for a shader variant (%d)",
+                 defineCount);
+
+        // NOTE: 셰이더 변형을 만들 수 없다면, raylib의 기본 셰이더를 반환
+        return LoadShaderFromMemory(NULL, NULL);
+    }
+
+    uint64_t keyHash = HashShaderText(FNV_OFFSET_BASIS, prologue);
+
+    keyHash = HashShaderText(keyHash, vsCode);
+    keyHash = HashShaderText(keyHash, fsCode);
+
+    int freeIndex = -1;
+
+    for (int i = 0; i < SHADER_VARIANT_CAPACITY; i++) {
+        ShaderVariant *variant = &shaderVariants[i];
+
+        if (variant->refCount <= 0) {
+            if (freeIndex < 0) freeIndex = i;
+
+            continue;
+        }
+
+        // 같은 상수 정의로 이미 만든 셰이더 변형이 있다면, 그대로 반환
+        if (variant->keyHash == keyHash) {
+            variant->refCount++;
+
+            return variant->shader;
+        }
+    }
+
+    char *vsSource = (vsCode != NULL) ? JoinShaderSource(prologue, vsCode)
+                                      : NULL;
+    char *fsSource = (fsCode != NULL) ? JoinShaderSource(prologue, fsCode)
+                                      : NULL;
+
+    Shader result = LoadCachedShader(vsSource, fsSource);
+
+    RL_FREE(vsSource), RL_FREE(fsSource);
+
+    // NOTE: 컴파일에 실패했거나 목록이 가득 찼다면, 목록에 추가하지 않음
+    if (result.id == rlGetShaderIdDefault()) return result;
+
+    if (freeIndex < 0) {
+        TraceLog(LOG_WARNING,
+                 "SHADER: Too many shader variants (%d)",
+                 SHADER_VARIANT_CAPACITY);
+
+        return result;
+    }
+
+    shaderVariants[freeIndex] = (ShaderVariant) { .keyHash = keyHash,
+                                                  .shader = result,
+                                                  .refCount = 1 };
+
+    TraceLog(LOG_INFO,
+             "SHADER: [%016llx] Shader variant loaded (%d define(s))",
+             (unsigned long long) keyHash,
+             defineCount);
+
+    return result;
+}
+
+/* 셰이더 변형을 더 이상 사용하지 않는다면, 셰이더 변형을 해제하는 함수 */
+void UnloadShaderVariant(Shader shader) {
+    for (int i = 0; i < SHADER_VARIANT_CAPACITY; i++) {
+        ShaderVariant *variant = &shaderVariants[i];
+
+        if (variant->refCount <= 0 || variant->shader.id != shader.id)
+            continue;
+
+        if (--variant->refCount == 0)
+            UnloadShader(variant->shader), *variant = (ShaderVariant) { 0 };
+
+        return;
+    }
+
+    // NOTE: 목록에 없는 셰이더 프로그램은 바로 해제
+    UnloadShader(shader);
+}
+
+/* 상수로 추가하지 않은 셰이더 변형의 Uniform 값을 바꾸는 함수 */
+void SetShaderVariantValue(Shader shader, const char *name, float value) {
+    int location = GetShaderLocation(shader, name);
+
+    // NOTE: 상수로 추가된 값은 Uniform이 아니므로, 셰이더 변형을 다시 만들어야 함
+    if (location < 0) {
+        TraceLog(LOG_WARNING,
+                 "SHADER: [ID %u] `%s` is not a uniform in this variant",
+                 shader.id,
+                 name);
+
+        return;
+    }
+
+    SetShaderValue(shader, location, &value, SHADER_UNIFORM_FLOAT);
+}
+
+/* Private Functions ======================================================= */
+
+/* `#version` 지시문과 상수 정의로 셰이더 소스 코드의 앞부분을 만드는 함수 */
+static int BuildShaderPrologue(char *buffer,
+                               int bufferSize,
+                               const ShaderDefine *defines,
+                               int defineCount) {
+#ifdef PLATFORM_WEB
+    int result = snprintf(buffer,
+                          bufferSize,
+                          "#version 300 es\n\nprecision highp float;\n");
+#else
+    int result = snprintf(buffer, bufferSize, "#version 330\n");
+#endif
+
+    for (int i = 0; i < defineCount && result < bufferSize; i++) {
+        /*
+            NOTE: GLSL ES에서는 정수를 실수로 자동 변환하지 않으므로,
+            항상 소수점이 포함되도록 기록함
+        */
+        result += snprintf(buffer + result,
+                           bufferSize - result,
+                           "#define %s %#.9g\n",
+                           defines[i].name,
+                           defines[i].value);
+    }
+
+    return (result < bufferSize) ? result : -1;
+}
+
+/* FNV-1a 해시 함수로 `text`의 해시 값을 `hash`에 누적하는 함수 */
+static uint64_t HashShaderText(uint64_t hash, const char *text) {
+    if (text != NULL)
+        for (const unsigned char *ptr = (const unsigned char *) text;
+             *ptr != '\0';
+             ptr++)
+            hash = (hash ^ *ptr) * FNV_PRIME;
+
+    // NOTE: 문자열의 경계도 해시 값에 반영
+    return (hash ^ 0xff) * FNV_PRIME;
+}
+
+/* `prologue`와 `code`를 이어붙인 셰이더 소스 코드를 만드는 함수 */
+static char *JoinShaderSource(const char *prologue, const char *code) {
+    size_t prologueLength = strlen(prologue), codeLength = strlen(code);
+
+    char *result = RL_MALLOC(prologueLength + codeLength + 1);
+
+    memcpy(result, prologue, prologueLength);
+    memcpy(result + prologueLength, code, codeLength + 1);
+
+    return result;
+}
+
+/* 셰이더 프로그램 바이너리를 다루는 OpenGL 함수들을 불러오는 함수 */
+static bool LoadProgramBinaryFuncs(void) {
+#ifdef SHADER_USE_PROGRAM_BINARY
+    if (isProgramBinarySupported >= 0) return isProgramBinarySupported;
+
+    gl = (GlProgramBinaryFuncs) {
+        .getString = (GlGetStringFunc) glfwGetProcAddress("glGetString"),
+        .getIntegerv = (GlGetIntegervFunc) glfwGetProcAddress("glGetIntegerv"),
+        .createProgram = (GlCreateProgramFunc) glfwGetProcAddress(
+            "glCreateProgram"),
+        .deleteProgram = (GlDeleteProgramFunc) glfwGetProcAddress(
+            "glDeleteProgram"),
+        .getProgramiv = (GlGetProgramivFunc) glfwGetProcAddress(
+            "glGetProgramiv"),
+        .getProgramBinary = (GlGetProgramBinaryFunc) glfwGetProcAddress(
+            "glGetProgramBinary"),
+        .programBinary = (GlProgramBinaryFunc) glfwGetProcAddress(
+            "glProgramBinary")
+    };
+
+    int formatCount = 0;
+
+    if (gl.getIntegerv != NULL)
+        gl.getIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+
+    // OpenGL 4.1 또는 `GL_ARB_get_program_binary` 확장 기능이 필요함
+    isProgramBinarySupported = (gl.getString != NULL
+                                && gl.createProgram != NULL
+                                && gl.deleteProgram != NULL
+                                && gl.getProgramiv != NULL
+                                && gl.getProgramBinary != NULL
+                                && gl.programBinary != NULL
+                                && formatCount > 0);
+
+    if (!isProgramBinarySupported)
+        TraceLog(LOG_INFO, "SHADER: Program binaries are not supported");
+    else if (!DirectoryExists(SHADER_CACHE_DIRECTORY))
+        MakeDirectory(SHADER_CACHE_DIRECTORY);
+
+    return isProgramBinarySupported;
+#else
+    isProgramBinarySupported = false;
+
+    return false;
+#endif
+}
+
+/* 셰이더 프로그램 바이너리 캐시 파일로 셰이더 프로그램을 만드는 함수 */
+static unsigned int LoadProgramFromCache(const char *fileName,
+                                         uint64_t keyHash) {
+    if (!FileExists(fileName)) return 0;
+
+    int fileSize = 0;
+
+    unsigned char *fileData = LoadFileData(fileName, &fileSize);
+
+    if (fileData == NULL) return 0;
+
+    ShaderCacheHeader header = { 0 };
+
+    if (fileSize >= (int) sizeof header)
+        memcpy(&header, fileData, sizeof header);
+
+    bool isHeaderValid = (fileSize >= (int) sizeof header
+                          && memcmp(header.magic,
+                                    SHADER_CACHE_FILE_MAGIC,
+                                    sizeof header.magic)
+                                 == 0
+                          && header.version == SHADER_CACHE_FILE_VERSION
+                          && header.keyHash == keyHash
+                          && header.binarySize
+                                 == (unsigned int) fileSize - sizeof header);
+
+    unsigned int programId = 0;
+
+    if (isHeaderValid) {
+        programId = gl.createProgram();
+
+        gl.programBinary(programId,
+                         header.format,
+                         fileData + sizeof header,
+                         header.binarySize);
+
+        int linkStatus = 0;
+
+        gl.getProgramiv(programId, GL_LINK_STATUS, &linkStatus);
+
+        // NOTE: 드라이버가 업데이트되면 기존 바이너리를 거부할 수 있음
+        if (!linkStatus) {
+            TraceLog(LOG_WARNING,
+                     "SHADER: [%s] Program binary rejected by driver",
+                     fileName);
+
+            gl.deleteProgram(programId), programId = 0;
+        }
+    } else {
+        TraceLog(LOG_WARNING,
+                 "SHADER: [%s] Invalid program binary cache file",
+                 fileName);
+    }
+
+    UnloadFileData(fileData);
+
+    return programId;
+}
+
+/* 셰이더 프로그램으로 raylib의 셰이더를 만드는 함수 */
+static Shader LoadShaderFromProgram(unsigned int programId) {
+    Shader result = { .id = programId,
+                      .locs = RL_CALLOC(RL_MAX_SHADER_LOCATIONS,
+                                        sizeof *result.locs) };
+
+    if (result.locs == NULL) return result;
+
+    // NOTE: `LoadShaderFromMemory()`와 같은 방법으로 기본 변수의 위치를 찾음
+    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++)
+        result.locs[i] = -1;
+
+    {
+        const struct {
+            int index;
+            const char *name;
+        } attribs[] = {
+            { SHADER_LOC_VERTEX_POSITION,
+              RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION },
+            { SHADER_LOC_VERTEX_TEXCOORD01,
+              RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD },
+            { SHADER_LOC_VERTEX_TEXCOORD02,
+              RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2 },
+            { SHADER_LOC_VERTEX_NORMAL, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL },
+            { SHADER_LOC_VERTEX_TANGENT,
+              RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT },
+            { SHADER_LOC_VERTEX_COLOR, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR },
+            { SHADER_LOC_VERTEX_BONEIDS,
+              RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS },
+            { SHADER_LOC_VERTEX_BONEWEIGHTS,
+              RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS }
+        };
+
+        for (int i = 0; i < (int) (sizeof attribs / sizeof *attribs); i++)
+            result.locs[attribs[i].index] = rlGetLocationAttrib(
+                programId,
+                attribs[i].name);
+    }
+
+    {
+        const struct {
+            int index;
+            const char *name;
+        } uniforms[] = {
+            { SHADER_LOC_MATRIX_MVP, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP },
+            { SHADER_LOC_MATRIX_VIEW, RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW },
+            { SHADER_LOC_MATRIX_PROJECTION,
+              RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION },
+            { SHADER_LOC_MATRIX_MODEL, RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL },
+            { SHADER_LOC_MATRIX_NORMAL,
+              RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL },
+            { SHADER_LOC_BONE_MATRICES,
+              RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES },
+            { SHADER_LOC_COLOR_DIFFUSE, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR },
+            { SHADER_LOC_MAP_DIFFUSE,
+              RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0 },
+            { SHADER_LOC_MAP_SPECULAR,
+              RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1 },
+            { SHADER_LOC_MAP_NORMAL,
+              RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2 }
+        };
+
+        for (int i = 0; i < (int) (sizeof uniforms / sizeof *uniforms); i++)
+            result.locs[uniforms[i].index] = rlGetLocationUniform(
+                programId,
+                uniforms[i].name);
+    }
+
+    return result;
+}
+
+/* 셰이더 프로그램의 바이너리를 캐시 파일에 저장하는 함수 */
+static bool SaveProgramToCache(const char *fileName,
+                               uint64_t keyHash,
+                               unsigned int programId) {
+    int binarySize = 0;
+
+    gl.getProgramiv(programId, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+
+    // NOTE: 바이너리를 가져올 수 없는 드라이버도 있음
+    if (binarySize <= 0) return false;
+
+    unsigned char *fileData = RL_MALLOC(sizeof(ShaderCacheHeader)
+                                        + binarySize);
+
+    if (fileData == NULL) return false;
+
+    ShaderCacheHeader header = { .version = SHADER_CACHE_FILE_VERSION,
+                                 .keyHash = keyHash };
+
+    memcpy(header.magic, SHADER_CACHE_FILE_MAGIC, sizeof header.magic);
+
+    int length = 0;
+
+    gl.getProgramBinary(programId,
+                        binarySize,
+                        &length,
+                        &header.format,
+                        fileData + sizeof header);
+
+    header.binarySize = length;
+
+    memcpy(fileData, &header, sizeof header);
+
+    bool result = (length > 0
+                   && SaveFileData(fileName,
+                                   fileData,
+                                   sizeof header + length));
+
+    if (!result)
+        TraceLog(LOG_WARNING,
+                 "SHADER: [%s] Failed to save program binary cache file",
+                 fileName);
+
+    RL_FREE(fileData);
+
+    return result;
+}
@@ -0,0 +1,149 @@
+/*
+    Copyright (c) 2024 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ================================================================ */
+
+#include "mvp-demo.h"
+
+#include <string.h>
+
+#if !defined(_WIN32) && !defined(PLATFORM_WEB)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+
+    #define SNAPSHOT_USE_MMAP
+#endif
+
+/* Macro Constants ========================================================= */
+
+// clang-format off
+
+/* 장면 스냅샷 파일의 식별자와 버전 */
+#define SNAPSHOT_FILE_MAGIC                 "MVPS"
+#define SNAPSHOT_FILE_VERSION               1
+
+// clang-format on
+
+/* Typedefs ================================================================ */
+
+/*
+    NOTE: 입력 기록 파일과 마찬가지로, 같은 환경에서 빌드한 프로그램끼리 주고받기 위한
+    것이므로 `SceneSnapshot` 구조체를 (바이트 순서 변환 없이) 그대로 저장함
+*/
+
+/* 장면 스냅샷 파일의 헤더 */
+typedef struct SnapshotHeader_ {
+    char magic[4];          // 파일 식별자 (`SNAPSHOT_FILE_MAGIC`)
+    unsigned int version;   // 파일 버전
+    unsigned int dataSize;  // `SceneSnapshot` 구조체의 크기
+} SnapshotHeader;
+
+/* 장면 스냅샷 파일 */
+typedef struct SnapshotFile_ {
+    SnapshotHeader header;  // 파일의 헤더
+    SceneSnapshot data;     // 장면 스냅샷
+} SnapshotFile;
+
+/* Public Functions ======================================================== */
+
+/* `fileName` 파일에서 장면 스냅샷을 읽는 함수 */
+bool ReadSceneSnapshot(const char *fileName, SceneSnapshot *snapshot) {
+    if (fileName == NULL || snapshot == NULL) return false;
+
+    const SnapshotFile *file = NULL;
+
+    size_t fileSize = 0;
+
+#ifdef SNAPSHOT_USE_MMAP
+    int fd = open(fileName, O_RDONLY);
+
+    if (fd < 0) {
+        TraceLog(LOG_WARNING, "SNAPSHOT: [%s] Failed to open file", fileName);
+
+        return false;
+    }
+
+    struct stat fileStat;
+
+    if (fstat(fd, &fileStat) == 0) fileSize = (size_t) fileStat.st_size;
+
+    // NOTE: 파일을 메모리에 올리고, 텍스트 해석 없이 구조체를 그대로 복사함
+    void *data = (fileSize >= sizeof *file)
+                     ? mmap(NULL, fileSize, PROT_READ, MAP_PRIVATE, fd, 0)
+                     : MAP_FAILED;
+
+    close(fd);
+
+    if (data != MAP_FAILED) file = data;
+#else
+    int dataSize = 0;
+
+    file = (const SnapshotFile *) LoadFileData(fileName, &dataSize);
+
+    fileSize = (size_t) dataSize;
+#endif
+
+    bool result = (file != NULL && fileSize == sizeof *file
+                   && memcmp(file->header.magic,
+                             SNAPSHOT_FILE_MAGIC,
+                             sizeof file->header.magic)
+                          == 0
+                   && file->header.version == SNAPSHOT_FILE_VERSION
+                   && file->header.dataSize == sizeof file->data);
+
+    if (result)
+        memcpy(snapshot, &file->data, sizeof *snapshot);
+    else
+        TraceLog(LOG_WARNING,
+                 "SNAPSHOT: [%s] Invalid snapshot file",
+                 fileName);
+
+#ifdef SNAPSHOT_USE_MMAP
+    if (file != NULL) munmap((void *) file, fileSize);
+#else
+    UnloadFileData((unsigned char *) file);
+#endif
+
+    return result;
+}
+
+/* `fileName` 파일에 장면 스냅샷을 저장하는 함수 */
+bool WriteSceneSnapshot(const char *fileName, const SceneSnapshot *snapshot) {
+    if (fileName == NULL || snapshot == NULL) return false;
+
+    SnapshotFile file = { .header = { .version = SNAPSHOT_FILE_VERSION,
+                                      .dataSize = sizeof file.data },
+                          .data = *snapshot };
+
+    memcpy(file.header.magic, SNAPSHOT_FILE_MAGIC, sizeof file.header.magic);
+
+    bool result = SaveFileData(fileName, &file, sizeof file);
+
+    if (!result)
+        TraceLog(LOG_WARNING,
+                 "SNAPSHOT: [%s] Failed to save snapshot file",
+                 fileName);
+
+    return result;
+}
@@ -0,0 +1,446 @@
+/*
+    Copyright (c) 2024 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ================================================================ */
+
+#include "mvp-demo.h"
+
+/* Macro Constants ========================================================= */
+
+// clang-format off
+
+/* 깊이 버퍼의 픽셀 하나가 차지하는 크기 (바이트) */
+#define RENDER_TEXTURE_DEPTH_BYTES          4
+
+// clang-format on
+
+/* Typedefs ================================================================ */
+
+/* 렌더 텍스처 풀에 저장된 렌더 텍스처 */
+typedef struct RenderTexturePoolEntry_ {
+    RenderTexture renderTexture;  // 실제로 할당된 렌더 텍스처
+    int format;                   // 요청된 색상 버퍼의 픽셀 형식
+    bool inUse;                   // 사용 중인지 여부
+    double releaseTime;           // 마지막으로 반환된 시간
+} RenderTexturePoolEntry;
+
+/* 크기가 같은 렌더 텍스처들이 함께 사용하는 깊이 버퍼 */
+typedef struct RenderTextureDepthEntry_ {
+    Texture depth;  // 렌더버퍼 (renderbuffer) 형식의 깊이 버퍼
+    int refCount;   // 이 깊이 버퍼가 연결된 렌더 텍스처의 개수
+} RenderTextureDepthEntry;
+
+/* Private Variables ======================================================= */
+
+/* 크기 단위별로 렌더 텍스처를 저장하는 렌더 텍스처 풀 */
+static RenderTexturePoolEntry pool[RENDER_TEXTURE_POOL_CAPACITY];
+
+/* 크기 단위별로 렌더 텍스처들이 함께 사용하는 깊이 버퍼 */
+static RenderTextureDepthEntry depthEntries[RENDER_TEXTURE_POOL_CAPACITY];
+
+/* Private Function Prototypes ============================================= */
+
+/* `width` x `height` 크기의 렌더 텍스처들이 함께 사용하는 깊이 버퍼를 가져오는 함수 */
+static Texture AcquireSharedDepth(int width, int height);
+
+/* 렌더 텍스처의 크기를 크기 단위로 올림하는 함수 */
+static int GetBucketSize(int size);
+
+/* 렌더 텍스처 번호 `id`에 해당하는 항목을 반환하는 함수 */
+static RenderTexturePoolEntry *GetPoolEntry(unsigned int id);
+
+/* 깊이 버퍼 없이 `width` x `height` 크기의 렌더 텍스처를 만드는 함수 */
+static RenderTexture LoadPoolRenderTexture(int width, int height, int format);
+
+/* `width` x `height` 크기의 공유 깊이 버퍼를 반환하고, 필요 없다면 해제하는 함수 */
+static void ReleaseSharedDepth(int width, int height);
+
+/* 공유 깊이 버퍼를 떼어낸 다음, 렌더 텍스처를 해제하는 함수 */
+static void UnloadPoolRenderTexture(RenderTexture renderTexture);
+
+/* 렌더버퍼 (renderbuffer) 형식의 깊이 버퍼를 해제하는 함수 */
+static void UnloadDepthRenderbuffer(unsigned int id);
+
+/* Public Functions ======================================================== */
+
+/* 렌더 텍스처 풀에서 `width` x `height` 크기의 렌더 텍스처를 가져오는 함수 */
+RenderTexture AcquireRenderTexture(int width, int height) {
+    return AcquireRenderTextureEx(width, height, RENDER_TEXTURE_FORMAT);
+}
+
+/* 렌더 텍스처 풀에서 색상 버퍼의 픽셀 형식이 `format`인 렌더 텍스처를 가져오는 함수 */
+RenderTexture AcquireRenderTextureEx(int width, int height, int format) {
+    if (width <= 0 || height <= 0) return (RenderTexture) { 0 };
+
+    int bucketWidth = GetBucketSize(width);
+    int bucketHeight = GetBucketSize(height);
+
+    RenderTexturePoolEntry *entry = NULL;
+
+    {
+        /*
+            NOTE: 크기가 같은 렌더 텍스처를 우선 재사용하고, 없으면 빈 자리 또는
+            가장 오래 전에 반환된 렌더 텍스처의 자리를 사용함
+        */
+
+        RenderTexturePoolEntry *emptyEntry = NULL, *oldestEntry = NULL;
+
+        for (int i = 0; i < RENDER_TEXTURE_POOL_CAPACITY; i++) {
+            RenderTexturePoolEntry *poolEntry = &pool[i];
+
+            if (poolEntry->inUse) continue;
+
+            if (poolEntry->renderTexture.id == 0) {
+                if (emptyEntry == NULL) emptyEntry = poolEntry;
+
+                continue;
+            }
+
+            if (poolEntry->renderTexture.texture.width == bucketWidth
+                && poolEntry->renderTexture.texture.height == bucketHeight
+                && poolEntry->format == format) {
+                entry = poolEntry;
+
+                break;
+            }
+
+            if (oldestEntry == NULL
+                || oldestEntry->releaseTime > poolEntry->releaseTime)
+                oldestEntry = poolEntry;
+        }
+
+        if (entry == NULL) {
+            entry = (emptyEntry != NULL) ? emptyEntry : oldestEntry;
+
+            if (entry == NULL) {
+                TraceLog(LOG_WARNING,
+                         "POOL: Failed to acquire render texture (%d x %d)",
+                         width,
+                         height);
+
+                return (RenderTexture) { 0 };
+            }
+
+            if (entry->renderTexture.id > 0)
+                UnloadPoolRenderTexture(entry->renderTexture);
+
+            entry->renderTexture = LoadPoolRenderTexture(bucketWidth,
+                                                         bucketHeight,
+                                                         format);
+
+            entry->format = format;
+
+            if (entry->renderTexture.id == 0) {
+                *entry = (RenderTexturePoolEntry) { 0 };
+
+                return (RenderTexture) { 0 };
+            }
+
+            /*
+                NOTE: WebGL 2에서는 크기가 다른 버퍼들을 한 프레임버퍼에 연결할 수
+                없으므로, 실제로 할당된 크기가 같은 깊이 버퍼만 연결함
+            */
+            entry->renderTexture.depth = AcquireSharedDepth(bucketWidth,
+                                                            bucketHeight);
+
+            rlFramebufferAttach(entry->renderTexture.id,
+                                entry->renderTexture.depth.id,
+                                RL_ATTACHMENT_DEPTH,
+                                RL_ATTACHMENT_RENDERBUFFER,
+                                0);
+
+            TraceLog(LOG_INFO,
+                     "POOL: Render texture loaded (%d x %d), "
+                     "%.2f MiB in use",
+                     bucketWidth,
+                     bucketHeight,
+                     GetRenderTextureMemoryUsage() / (1024.0 * 1024.0));
+        }
+    }
+
+    entry->inUse = true;
+
+    RenderTexture result = entry->renderTexture;
+
+    /*
+        NOTE: `BeginTextureMode()`는 텍스처 크기로 뷰포트를 설정하므로,
+        실제로 할당된 크기 대신 요청된 크기를 반환함
+    */
+    result.texture.width = width, result.texture.height = height;
+
+    return result;
+}
+
+/* 렌더 텍스처를 렌더 텍스처 풀에 반환하는 함수 */
+void ReleaseRenderTexture(RenderTexture renderTexture) {
+    RenderTexturePoolEntry *entry = GetPoolEntry(renderTexture.id);
+
+    if (entry == NULL) return;
+
+    entry->inUse = false;
+
+    entry->releaseTime = GetTime();
+}
+
+/* 렌더 텍스처에 실제로 할당된 (크기 단위로 올림된) 텍스처를 반환하는 함수 */
+Texture GetRenderTextureStorage(RenderTexture renderTexture) {
+    RenderTexturePoolEntry *entry = GetPoolEntry(renderTexture.id);
+
+    return (entry != NULL) ? entry->renderTexture.texture
+                           : renderTexture.texture;
+}
+
+/* 오랫동안 사용되지 않은 렌더 텍스처를 해제하는 함수 */
+void TrimRenderTexturePool(void) {
+    double currentTime = GetTime();
+
+    bool isTrimmed = false;
+
+    for (int i = 0; i < RENDER_TEXTURE_POOL_CAPACITY; i++) {
+        RenderTexturePoolEntry *entry = &pool[i];
+
+        if (entry->inUse || entry->renderTexture.id == 0) continue;
+
+        // NOTE: 창 크기를 계속 조절하는 동안에는 렌더 텍스처를 해제하지 않음
+        if (currentTime - entry->releaseTime < RENDER_TEXTURE_IDLE_DURATION)
+            continue;
+
+        UnloadPoolRenderTexture(entry->renderTexture);
+
+        *entry = (RenderTexturePoolEntry) { 0 };
+
+        isTrimmed = true;
+    }
+
+    if (!isTrimmed) return;
+
+    TraceLog(LOG_INFO,
+             "POOL: Render texture pool trimmed, %.2f MiB in use",
+             GetRenderTextureMemoryUsage() / (1024.0 * 1024.0));
+}
+
+/* 렌더 텍스처 풀에 할당된 메모리 공간을 해제하는 함수 */
+void UnloadRenderTexturePool(void) {
+    for (int i = 0; i < RENDER_TEXTURE_POOL_CAPACITY; i++) {
+        if (pool[i].renderTexture.id > 0)
+            UnloadPoolRenderTexture(pool[i].renderTexture);
+
+        pool[i] = (RenderTexturePoolEntry) { 0 };
+    }
+}
+
+/* 렌더 텍스처 풀이 사용하고 있는 GPU 메모리의 크기 (바이트)를 계산하는 함수 */
+size_t GetRenderTextureMemoryUsage(void) {
+    /*
+        NOTE: 실제 크기는 GPU 드라이버에 따라 다르므로, 각 텍스처의 픽셀 형식과
+        깊이 버퍼의 크기로 추정함
+    */
+
+    size_t result = 0;
+
+    for (int i = 0; i < RENDER_TEXTURE_POOL_CAPACITY; i++) {
+        const Texture *depth = &depthEntries[i].depth;
+
+        result += (size_t) depth->width * depth->height
+                  * RENDER_TEXTURE_DEPTH_BYTES;
+    }
+
+    for (int i = 0; i < RENDER_TEXTURE_POOL_CAPACITY; i++) {
+        const Texture *texture = &pool[i].renderTexture.texture;
+
+        if (pool[i].renderTexture.id == 0) continue;
+
+        result += GetPixelDataSize(texture->width,
+                                   texture->height,
+                                   texture->format);
+    }
+
+    return result;
+}
+
+/* Private Functions ======================================================= */
+
+/* `width` x `height` 크기의 렌더 텍스처들이 함께 사용하는 깊이 버퍼를 가져오는 함수 */
+static Texture AcquireSharedDepth(int width, int height) {
+    RenderTextureDepthEntry *emptyEntry = NULL;
+
+    for (int i = 0; i < RENDER_TEXTURE_POOL_CAPACITY; i++) {
+        RenderTextureDepthEntry *entry = &depthEntries[i];
+
+        if (entry->refCount == 0) {
+            if (emptyEntry == NULL) emptyEntry = entry;
+
+            continue;
+        }
+
+        /*
+            NOTE: 각 공간은 차례대로 그려지고, 그리기 전에 깊이 버퍼를 초기화하므로
+            크기가 같은 렌더 텍스처들은 깊이 버퍼 하나를 함께 사용해도 됨
+        */
+        if (entry->depth.width == width && entry->depth.height == height) {
+            entry->refCount++;
+
+            return entry->depth;
+        }
+    }
+
+    // NOTE: 렌더 텍스처 풀보다 깊이 버퍼가 많을 수 없으므로, 빈 자리가 항상 있음
+    if (emptyEntry == NULL) return (Texture) { 0 };
+
+    unsigned int id = rlLoadTextureDepth(width, height, true);
+
+    if (id == 0) return (Texture) { 0 };
+
+    *emptyEntry = (RenderTextureDepthEntry) {
+        .depth = { .id = id,
+                   .width = width,
+                   .height = height,
+                   .mipmaps = 1,
+                   .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE },
+        .refCount = 1
+    };
+
+    return emptyEntry->depth;
+}
+
+/* 렌더 텍스처의 크기를 크기 단위로 올림하는 함수 */
+static int GetBucketSize(int size) {
+    return ((size + (RENDER_TEXTURE_BUCKET_SIZE - 1))
+            / RENDER_TEXTURE_BUCKET_SIZE)
+           * RENDER_TEXTURE_BUCKET_SIZE;
+}
+
+/* 렌더 텍스처 번호 `id`에 해당하는 항목을 반환하는 함수 */
+static RenderTexturePoolEntry *GetPoolEntry(unsigned int id) {
+    if (id == 0) return NULL;
+
+    for (int i = 0; i < RENDER_TEXTURE_POOL_CAPACITY; i++)
+        if (pool[i].renderTexture.id == id) return &pool[i];
+
+    return NULL;
+}
+
+/* 깊이 버퍼 없이 `width` x `height` 크기의 렌더 텍스처를 만드는 함수 */
+static RenderTexture LoadPoolRenderTexture(int width, int height, int format) {
+    RenderTexture result = { .id = rlLoadFramebuffer() };
+
+    if (result.id == 0) return result;
+
+    rlEnableFramebuffer(result.id);
+
+    result.texture = (Texture) {
+        .id = rlLoadTexture(NULL, width, height, format, 1),
+        .width = width,
+        .height = height,
+        .mipmaps = 1,
+        .format = format
+    };
+
+    rlFramebufferAttach(result.id,
+                        result.texture.id,
+                        RL_ATTACHMENT_COLOR_CHANNEL0,
+                        RL_ATTACHMENT_TEXTURE2D,
+                        0);
+
+    // NOTE: 깊이 버퍼는 나중에 연결하므로, 색상 버퍼의 형식만 확인
+    bool isComplete = rlFramebufferComplete(result.id);
+
+    rlDisableFramebuffer();
+
+    if (isComplete) return result;
+
+    UnloadRenderTexture(result);
+
+    if (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
+        TraceLog(LOG_WARNING,
+                 "POOL: Failed to load render texture (%d x %d)",
+                 width,
+                 height);
+
+        return (RenderTexture) { 0 };
+    }
+
+    // 렌더링할 수 없는 픽셀 형식이라면, 기본 픽셀 형식으로 다시 시도
+    TraceLog(LOG_WARNING,
+             "POOL: Pixel format %d is not renderable, falling back to RGBA8",
+             format);
+
+    return LoadPoolRenderTexture(width,
+                                 height,
+                                 PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+}
+
+/* `width` x `height` 크기의 공유 깊이 버퍼를 반환하고, 필요 없다면 해제하는 함수 */
+static void ReleaseSharedDepth(int width, int height) {
+    for (int i = 0; i < RENDER_TEXTURE_POOL_CAPACITY; i++) {
+        RenderTextureDepthEntry *entry = &depthEntries[i];
+
+        if (entry->refCount == 0 || entry->depth.width != width
+            || entry->depth.height != height)
+            continue;
+
+        if (--entry->refCount > 0) return;
+
+        UnloadDepthRenderbuffer(entry->depth.id);
+
+        *entry = (RenderTextureDepthEntry) { 0 };
+
+        return;
+    }
+}
+
+/* 공유 깊이 버퍼를 떼어낸 다음, 렌더 텍스처를 해제하는 함수 */
+static void UnloadPoolRenderTexture(RenderTexture renderTexture) {
+    /*
+        NOTE: `rlUnloadFramebuffer()`는 프레임버퍼에 연결된 깊이 버퍼도 함께
+        해제하므로, 다른 렌더 텍스처가 사용하는 깊이 버퍼를 먼저 떼어냄
+    */
+    rlFramebufferAttach(renderTexture.id,
+                        0,
+                        RL_ATTACHMENT_DEPTH,
+                        RL_ATTACHMENT_RENDERBUFFER,
+                        0);
+
+    UnloadRenderTexture(renderTexture);
+
+    if (renderTexture.depth.id > 0)
+        ReleaseSharedDepth(renderTexture.depth.width,
+                           renderTexture.depth.height);
+}
+
+/* 렌더버퍼 (renderbuffer) 형식의 깊이 버퍼를 해제하는 함수 */
+static void UnloadDepthRenderbuffer(unsigned int id) {
+    if (id == 0) return;
+
+    // NOTE: rlgl에는 렌더버퍼만 해제하는 함수가 없으므로, 임시 프레임버퍼를 사용
+    unsigned int framebufferId = rlLoadFramebuffer();
+
+    if (framebufferId == 0) return;
+
+    rlFramebufferAttach(framebufferId,
+                        id,
+                        RL_ATTACHMENT_DEPTH,
+                        RL_ATTACHMENT_RENDERBUFFER,
+                        0);
+
+    rlUnloadFramebuffer(framebufferId);
+}
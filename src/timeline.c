@@ -0,0 +1,384 @@
+/*
+    Copyright (c) 2024 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ================================================================ */
+
+#include "mvp-demo.h"
+
+#include <math.h>
+#include <string.h>
+
+/* Macro Constants ========================================================= */
+
+// clang-format off
+
+/* 미리 계산해 놓을 수 있는 샘플의 최대 개수 */
+#define TIMELINE_SAMPLE_COUNT               ((TIMELINE_MAX_DURATION       \
+                                              * TIMELINE_SAMPLE_RATE) + 1)
+
+// clang-format on
+
+/* Typedefs ================================================================ */
+
+/* 타임라인의 키프레임 */
+typedef struct TimelineKeyframe_ {
+    float time;                           // 키프레임의 시간 (초)
+    Vector3 value;                        // 키프레임의 값
+    TimelineInterpolation interpolation;  // 다음 키프레임까지의 보간 방법
+} TimelineKeyframe;
+
+/* Private Variables ======================================================= */
+
+/* 각 채널의 키프레임 (시간 순서로 정렬됨) */
+static TimelineKeyframe timelineKeyframes[TIMELINE_CHANNEL_COUNT_]
+                                         [TIMELINE_KEYFRAME_CAPACITY];
+
+/* 각 채널의 키프레임 개수 */
+static int timelineKeyframeCounts[TIMELINE_CHANNEL_COUNT_];
+
+/* 각 채널의 값을 일정한 간격으로 미리 계산해 놓은 샘플 */
+static Vector3 timelineSamples[TIMELINE_CHANNEL_COUNT_][TIMELINE_SAMPLE_COUNT];
+
+/* 미리 계산해 놓은 샘플의 개수 */
+static int timelineSampleCount = 0;
+
+/* 샘플을 다시 계산해야 하는지 여부 */
+static bool isTimelineCacheDirty = false;
+
+/* 타임라인의 길이 (= 마지막 키프레임의 시간) */
+static float timelineDuration = 0.0f;
+
+/* 타임라인의 현재 시간 */
+static float timelineTime = 0.0f;
+
+/* 마지막으로 샘플을 반영한 시간 */
+static float timelineAppliedTime = -1.0f;
+
+/* 타임라인의 재생 여부 */
+static bool isTimelinePlaying = false;
+
+/* Private Function Prototypes ============================================= */
+
+/* 각 채널의 값을 일정한 간격으로 미리 계산하는 함수 */
+static void BuildTimelineSampleCache(void);
+
+/* `channel` 채널의 `index`번째 키프레임 구간에서 `time`초의 값을 계산하는 함수 */
+static Vector3 EvaluateTimelineChannel(TimelineChannel channel,
+                                       int index,
+                                       float time);
+
+/* 오일러 각 (도)을 사원수로 변환하는 함수 */
+static Quaternion QuaternionFromEulerDegrees(Vector3 angle);
+
+/* 사원수를 오일러 각 (도)으로 변환하는 함수 */
+static Vector3 QuaternionToEulerDegrees(Quaternion rotation);
+
+/* 각도 (도)를 [0, 360) 범위로 변환하는 함수 */
+static float WrapDegrees(float angle);
+
+/* Public Functions ======================================================== */
+
+/* `channel` 채널의 `time`초에 키프레임을 추가하고, 그 번호를 반환하는 함수 */
+int AddTimelineKeyframe(TimelineChannel channel,
+                        float time,
+                        Vector3 value,
+                        TimelineInterpolation interpolation) {
+    if (channel < 0 || channel >= TIMELINE_CHANNEL_COUNT_) return -1;
+
+    TimelineKeyframe *keyframes = timelineKeyframes[channel];
+
+    int *keyframeCount = &timelineKeyframeCounts[channel];
+
+    // NOTE: 키프레임의 시간을 샘플 간격에 맞춤
+    time = roundf(Clamp(time, 0.0f, (float) TIMELINE_MAX_DURATION)
+                  * TIMELINE_SAMPLE_RATE)
+           / TIMELINE_SAMPLE_RATE;
+
+    int index = 0;
+
+    while (index < *keyframeCount && keyframes[index].time < time)
+        index++;
+
+    // 같은 시간에 이미 키프레임이 있다면, 그 키프레임을 덮어씀
+    bool shouldReplace = (index < *keyframeCount)
+                         && (keyframes[index].time == time);
+
+    if (!shouldReplace) {
+        if (*keyframeCount >= TIMELINE_KEYFRAME_CAPACITY) {
+            TraceLog(LOG_WARNING,
+                     "TIMELINE: Failed to add keyframe (%d / %d in use)",
+                     *keyframeCount,
+                     TIMELINE_KEYFRAME_CAPACITY);
+
+            return -1;
+        }
+
+        memmove(&keyframes[index + 1],
+                &keyframes[index],
+                (*keyframeCount - index) * sizeof *keyframes);
+
+        (*keyframeCount)++;
+    }
+
+    keyframes[index] = (TimelineKeyframe) { .time = time,
+                                            .value = value,
+                                            .interpolation = interpolation };
+
+    isTimelineCacheDirty = true;
+
+    return index;
+}
+
+/* 타임라인의 모든 키프레임을 제거하는 함수 */
+void ClearTimeline(void) {
+    for (int i = 0; i < TIMELINE_CHANNEL_COUNT_; i++)
+        timelineKeyframeCounts[i] = 0;
+
+    timelineSampleCount = 0, timelineDuration = 0.0f;
+
+    timelineTime = 0.0f, timelineAppliedTime = -1.0f;
+
+    isTimelineCacheDirty = false, isTimelinePlaying = false;
+}
+
+/* 타임라인의 현재 시간을 반환하는 함수 */
+float GetTimelineTime(void) {
+    return timelineTime;
+}
+
+/* 타임라인의 현재 시간을 설정하는 함수 */
+void SetTimelineTime(float time) {
+    timelineTime = Clamp(time, 0.0f, (float) TIMELINE_MAX_DURATION);
+}
+
+/* 타임라인의 길이를 반환하는 함수 */
+float GetTimelineDuration(void) {
+    if (isTimelineCacheDirty) BuildTimelineSampleCache();
+
+    return timelineDuration;
+}
+
+/* 타임라인의 모든 채널에 있는 키프레임의 개수를 반환하는 함수 */
+int GetTimelineKeyframeCount(void) {
+    int result = 0;
+
+    for (int i = 0; i < TIMELINE_CHANNEL_COUNT_; i++)
+        result += timelineKeyframeCounts[i];
+
+    return result;
+}
+
+/* 현재 시간에서 `channel` 채널의 값을 반환하는 함수 */
+bool GetTimelineSample(TimelineChannel channel, Vector3 *value) {
+    if (channel < 0 || channel >= TIMELINE_CHANNEL_COUNT_ || value == NULL)
+        return false;
+
+    if (isTimelineCacheDirty) BuildTimelineSampleCache();
+
+    if (timelineKeyframeCounts[channel] <= 0 || timelineSampleCount <= 0)
+        return false;
+
+    // NOTE: 미리 계산해 놓은 샘플 중 가장 가까운 샘플을 반환 (`O(1)`)
+    int index = (int) (timelineTime * TIMELINE_SAMPLE_RATE + 0.5f);
+
+    if (index >= timelineSampleCount) index = timelineSampleCount - 1;
+
+    *value = timelineSamples[channel][index];
+
+    return true;
+}
+
+/* 타임라인의 재생 여부를 반환하는 함수 */
+bool IsTimelinePlaying(void) {
+    return isTimelinePlaying;
+}
+
+/* 타임라인의 재생 여부를 설정하는 함수 */
+void SetTimelinePlaying(bool playing) {
+    isTimelinePlaying = playing && (GetTimelineKeyframeCount() > 0);
+}
+
+/* 타임라인을 업데이트하고, 새로운 샘플을 반영해야 하는지 확인하는 함수 */
+bool UpdateTimeline(float deltaTime) {
+    if (isTimelineCacheDirty) BuildTimelineSampleCache();
+
+    if (timelineSampleCount <= 0) return false;
+
+    // 마지막 키프레임까지 재생했다면, 처음부터 다시 재생
+    if (isTimelinePlaying && timelineDuration > 0.0f)
+        timelineTime = fmodf(timelineTime + deltaTime, timelineDuration);
+
+    if (timelineTime == timelineAppliedTime) return false;
+
+    timelineAppliedTime = timelineTime;
+
+    return true;
+}
+
+/* Private Functions ======================================================= */
+
+/* 각 채널의 값을 일정한 간격으로 미리 계산하는 함수 */
+static void BuildTimelineSampleCache(void) {
+    timelineDuration = 0.0f;
+
+    for (int i = 0; i < TIMELINE_CHANNEL_COUNT_; i++) {
+        int keyframeCount = timelineKeyframeCounts[i];
+
+        if (keyframeCount <= 0) continue;
+
+        float lastTime = timelineKeyframes[i][keyframeCount - 1].time;
+
+        if (timelineDuration < lastTime) timelineDuration = lastTime;
+    }
+
+    timelineSampleCount = (GetTimelineKeyframeCount() > 0)
+                              ? (int) (timelineDuration * TIMELINE_SAMPLE_RATE
+                                       + 0.5f)
+                                    + 1
+                              : 0;
+
+    for (int i = 0; i < TIMELINE_CHANNEL_COUNT_; i++) {
+        const TimelineKeyframe *keyframes = timelineKeyframes[i];
+
+        int keyframeCount = timelineKeyframeCounts[i];
+
+        if (keyframeCount <= 0) continue;
+
+        // NOTE: 샘플의 시간이 계속 증가하므로, 키프레임 구간을 처음부터 찾지 않음
+        for (int j = 0, k = 0; j < timelineSampleCount; j++) {
+            float time = (float) j / TIMELINE_SAMPLE_RATE;
+
+            while (k + 1 < keyframeCount && keyframes[k + 1].time <= time)
+                k++;
+
+            timelineSamples[i][j] = EvaluateTimelineChannel(i, k, time);
+        }
+    }
+
+    // 샘플이 바뀌었으므로, 현재 시간의 샘플을 다시 반영해야 함
+    timelineTime = Clamp(timelineTime, 0.0f, timelineDuration);
+
+    timelineAppliedTime = -1.0f;
+
+    isTimelineCacheDirty = false;
+}
+
+/* `channel` 채널의 `index`번째 키프레임 구간에서 `time`초의 값을 계산하는 함수 */
+static Vector3 EvaluateTimelineChannel(TimelineChannel channel,
+                                       int index,
+                                       float time) {
+    const TimelineKeyframe *keyframes = timelineKeyframes[channel];
+
+    int keyframeCount = timelineKeyframeCounts[channel];
+
+    // 첫 번째 키프레임 전과 마지막 키프레임 후에는 그 값을 그대로 유지
+    if (time <= keyframes[0].time) return keyframes[0].value;
+
+    if (index >= keyframeCount - 1) return keyframes[keyframeCount - 1].value;
+
+    const TimelineKeyframe *k1 = &keyframes[index];
+    const TimelineKeyframe *k2 = &keyframes[index + 1];
+
+    // NOTE: 키프레임의 시간에서는 (사원수 변환 오차 없이) 그 값을 그대로 반환
+    if (time <= k1->time) return k1->value;
+
+    float duration = k2->time - k1->time;
+
+    float t = (duration > 0.0f) ? (time - k1->time) / duration : 1.0f;
+
+    if (k1->interpolation == TIMELINE_INTERP_SLERP
+        && channel == TIMELINE_CHANNEL_MODEL_ROTATE) {
+        // NOTE: 오일러 각을 직접 보간하지 않고, 사원수로 변환하여 구면 보간
+        return QuaternionToEulerDegrees(
+            QuaternionSlerp(QuaternionFromEulerDegrees(k1->value),
+                            QuaternionFromEulerDegrees(k2->value),
+                            t));
+    } else if (k1->interpolation == TIMELINE_INTERP_CUBIC) {
+        /* 이웃한 키프레임으로 접선을 구하는 "Catmull-Rom" 스플라인 */
+
+        const TimelineKeyframe *k0 = &keyframes[(index > 0) ? index - 1
+                                                            : index];
+        const TimelineKeyframe *k3 = &keyframes[(index + 2 < keyframeCount)
+                                                    ? index + 2
+                                                    : index + 1];
+
+        Vector3 m1 = Vector3Zero(), m2 = Vector3Zero();
+
+        if (k2->time > k0->time)
+            m1 = Vector3Scale(Vector3Subtract(k2->value, k0->value),
+                              duration / (k2->time - k0->time));
+
+        if (k3->time > k1->time)
+            m2 = Vector3Scale(Vector3Subtract(k3->value, k1->value),
+                              duration / (k3->time - k1->time));
+
+        float t2 = t * t, t3 = t2 * t;
+
+        Vector3 result = Vector3Scale(k1->value, 2.0f * t3 - 3.0f * t2 + 1.0f);
+
+        result = Vector3Add(result, Vector3Scale(m1, t3 - 2.0f * t2 + t));
+        result = Vector3Add(result,
+                            Vector3Scale(k2->value, -2.0f * t3 + 3.0f * t2));
+        result = Vector3Add(result, Vector3Scale(m2, t3 - t2));
+
+        return result;
+    } else {
+        return Vector3Lerp(k1->value, k2->value, t);
+    }
+}
+
+/* 오일러 각 (도)을 사원수로 변환하는 함수 */
+static Quaternion QuaternionFromEulerDegrees(Vector3 angle) {
+    // NOTE: "모델 행렬"과 같은 순서로 회전하도록 `MatrixRotateXYZ()`를 사용
+    return QuaternionFromMatrix(
+        MatrixRotateXYZ(Vector3Scale(angle, DEG2RAD)));
+}
+
+/* 사원수를 오일러 각 (도)으로 변환하는 함수 */
+static Vector3 QuaternionToEulerDegrees(Quaternion rotation) {
+    Matrix rotationMat = QuaternionToMatrix(rotation);
+
+    Vector3 result = { 0 };
+
+    // `MatrixRotateXYZ()`의 각 요소로부터 회전 각도를 역으로 계산
+    if (fabsf(rotationMat.m8) < 0.9999f) {
+        result.x = atan2f(-rotationMat.m9, rotationMat.m10);
+        result.y = asinf(rotationMat.m8);
+        result.z = atan2f(-rotationMat.m4, rotationMat.m0);
+    } else {
+        // NOTE: 짐벌 락 (gimbal lock) 상태에서는 X축 회전 각도를 0으로 고정
+        result.y = (rotationMat.m8 > 0.0f) ? (0.5f * PI) : (-0.5f * PI);
+        result.z = atan2f(rotationMat.m1, rotationMat.m5);
+    }
+
+    // GUI의 입력 범위에 맞게 [0, 360) 범위로 변환
+    return (Vector3) { .x = WrapDegrees(RAD2DEG * result.x),
+                       .y = WrapDegrees(RAD2DEG * result.y),
+                       .z = WrapDegrees(RAD2DEG * result.z) };
+}
+
+/* 각도 (도)를 [0, 360) 범위로 변환하는 함수 */
+static float WrapDegrees(float angle) {
+    float result = fmodf(angle, 360.0f);
+
+    return (result < 0.0f) ? result + 360.0f : result;
+}
@@ -0,0 +1,466 @@
+/*
+    Copyright (c) 2024 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ================================================================ */
+
+#include "mvp-demo.h"
+
+#include <pthread.h>
+#include <stdio.h>
+
+/* Macro Constants ========================================================= */
+
+// clang-format off
+
+/* 삼중 버퍼의 중간 버퍼에 새로운 데이터가 있다는 표시 */
+#define TRIPLE_BUFFER_FRESH_BIT             0x04U
+
+/* 삼중 버퍼의 중간 버퍼 번호를 꺼낼 때 사용하는 마스크 */
+#define TRIPLE_BUFFER_INDEX_MASK            0x03U
+
+// clang-format on
+
+/* Typedefs ================================================================ */
+
+/*
+    NOTE: 쓰는 쪽과 읽는 쪽이 각자 버퍼를 하나씩 가지고, 남은 하나 (중간 버퍼)만
+    원자적으로 교환하므로 어느 쪽도 다른 쪽을 기다리지 않음
+*/
+
+/* 스레드 하나가 쓰고, 다른 스레드 하나가 읽는 삼중 버퍼 */
+typedef struct TripleBuffer_ {
+    unsigned char *slots;      // 버퍼 3개의 메모리 공간
+    size_t slotSize;           // 버퍼 하나의 크기
+    unsigned int writeIndex;   // 쓰는 쪽이 사용 중인 버퍼의 번호
+    unsigned int middleIndex;  // 중간 버퍼의 번호와 `TRIPLE_BUFFER_FRESH_BIT`
+    unsigned int readIndex;    // 읽는 쪽이 사용 중인 버퍼의 번호
+} TripleBuffer;
+
+/* 각 공간의 스냅샷을 만드는 작업에 전달할 데이터 */
+typedef struct SnapshotJobData_ {
+    const FrameInput *input;  // 가장 최근의 입력
+    FrameSnapshot *snapshot;  // 새로 만들 스냅샷
+} SnapshotJobData;
+
+/* Private Variables ======================================================= */
+
+/* 렌더링 스레드가 업데이트 스레드에 입력을 전달하는 삼중 버퍼 */
+static TripleBuffer inputBuffer;
+
+/* 업데이트 스레드가 렌더링 스레드에 스냅샷을 전달하는 삼중 버퍼 */
+static TripleBuffer snapshotBuffer;
+
+/* 각 공간의 좌표 문자열을 배치할 때 사용하는 레이블 배치 상태 */
+static LabelLayout *labelLayouts[MVP_RENDER_COUNT_];
+
+/* 렌더링 스레드가 현재 프레임에 사용하는 스냅샷 */
+static const FrameSnapshot *currentSnapshot;
+
+/* 렌더링 스레드가 마지막으로 전달한 입력의 프레임 번호 */
+static unsigned int submittedFrameIndex;
+
+/* 마지막으로 만든 스냅샷의 프레임 번호 (`snapshotMutex`로 보호) */
+static unsigned int builtFrameIndex;
+
+/* 두 스레드가 동시에 스냅샷을 만들지 않도록 할 때 사용하는 뮤텍스 */
+static pthread_mutex_t snapshotMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* 업데이트 스레드 */
+static pthread_t updateThread;
+
+/* 업데이트 스레드를 깨울 때 사용하는 뮤텍스와 조건 변수 */
+static pthread_mutex_t updateMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t updateCond = PTHREAD_COND_INITIALIZER;
+
+/* 업데이트 스레드가 아직 처리하지 않은 입력이 있는지 여부 */
+static bool isUpdatePending = false;
+
+/* 업데이트 스레드를 종료해야 하는지 여부 */
+static bool shouldUpdateThreadExit = false;
+
+/* 업데이트 스레드가 실행 중인지 여부 */
+static bool isUpdateThreadRunning = false;
+
+/* Private Function Prototypes ============================================= */
+
+/* 버퍼 하나의 크기가 `slotSize`인 삼중 버퍼를 초기화하는 함수 */
+static bool InitTripleBuffer(TripleBuffer *buffer, size_t slotSize);
+
+/* 삼중 버퍼에서 쓰는 쪽이 사용할 버퍼를 반환하는 함수 */
+static void *GetTripleBufferWriteSlot(TripleBuffer *buffer);
+
+/* 쓰는 쪽이 사용하던 버퍼를 중간 버퍼와 교환하는 함수 */
+static void PublishTripleBuffer(TripleBuffer *buffer);
+
+/* 새로운 데이터가 있다면 중간 버퍼와 교환하고, 가장 최근의 버퍼를 반환하는 함수 */
+static const void *AcquireTripleBuffer(TripleBuffer *buffer);
+
+/* 삼중 버퍼에 할당된 메모리 공간을 해제하는 함수 */
+static void UnloadTripleBuffer(TripleBuffer *buffer);
+
+/* 업데이트 스레드에서 실행되는 함수 */
+static void *RunUpdateThread(void *arg);
+
+/* 가장 최근의 입력으로 새로운 스냅샷을 만드는 함수 */
+static void UpdateFrameSnapshot(void);
+
+/* 작업 스레드에서 `index + 1`번째 공간의 스냅샷을 만드는 함수 */
+static void UpdateSpaceSnapshotJob(void *userData, int index);
+
+/* 한 공간에 그릴 플레이어 모델의 정점과 좌표 문자열을 계산하는 함수 */
+static void UpdateSpaceVertexSnapshot(const FrameInput *input,
+                                      MvpRenderMode renderMode,
+                                      SpaceVertexSnapshot *snapshot);
+
+/* Public Functions ======================================================== */
+
+/* 업데이트 스레드를 초기화하는 함수 */
+bool InitUpdateThread(void) {
+    if (!InitTripleBuffer(&inputBuffer, sizeof(FrameInput))
+        || !InitTripleBuffer(&snapshotBuffer, sizeof(FrameSnapshot))) {
+        UnloadTripleBuffer(&inputBuffer);
+
+        return false;
+    }
+
+    // NOTE: 각 공간을 서로 다른 작업 스레드에서 처리하므로, 배치 상태도 따로 만듦
+    for (int i = MVP_RENDER_ALL + 1; i < MVP_RENDER_COUNT_; i++)
+        labelLayouts[i] = LoadLabelLayout(GAME_OBJECT_VERTEX_COUNT);
+
+    currentSnapshot = AcquireTripleBuffer(&snapshotBuffer);
+
+    submittedFrameIndex = 0, builtFrameIndex = 0;
+
+    shouldUpdateThreadExit = false, isUpdatePending = false;
+
+    // 스레드를 만들 수 없는 환경에서는 입력을 받을 때마다 현재 스레드에서 처리
+    isUpdateThreadRunning = (pthread_create(&updateThread,
+                                            NULL,
+                                            RunUpdateThread,
+                                            NULL)
+                             == 0);
+
+    if (!isUpdateThreadRunning)
+        TraceLog(LOG_WARNING,
+                 "UPDATE: Failed to create update thread, "
+                 "falling back to the main thread");
+
+    return true;
+}
+
+/* 업데이트 스레드에 전달할 입력을 작성하기 시작하는 함수 */
+FrameInput *BeginFrameInput(void) {
+    if (inputBuffer.slots == NULL) return NULL;
+
+    return GetTripleBufferWriteSlot(&inputBuffer);
+}
+
+/* 작성한 입력을 업데이트 스레드에 전달하는 함수 */
+void EndFrameInput(void) {
+    if (inputBuffer.slots == NULL) return;
+
+    FrameInput *input = GetTripleBufferWriteSlot(&inputBuffer);
+
+    input->frameIndex = ++submittedFrameIndex;
+
+    PublishTripleBuffer(&inputBuffer);
+
+    if (!isUpdateThreadRunning) {
+        UpdateFrameSnapshot();
+
+        return;
+    }
+
+    // NOTE: 뮤텍스는 업데이트 스레드를 깨울 때만 사용하고, 데이터 교환에는 사용하지 않음
+    pthread_mutex_lock(&updateMutex);
+
+    isUpdatePending = true;
+
+    pthread_cond_signal(&updateCond);
+
+    pthread_mutex_unlock(&updateMutex);
+}
+
+/* 업데이트 스레드가 만든 가장 최근의 스냅샷을 가져오는 함수 */
+const FrameSnapshot *AcquireFrameSnapshot(void) {
+    if (snapshotBuffer.slots == NULL) return NULL;
+
+    currentSnapshot = AcquireTripleBuffer(&snapshotBuffer);
+
+    return currentSnapshot;
+}
+
+/* 현재 프레임의 입력으로 만든 스냅샷을 반환하는 함수 */
+const FrameSnapshot *GetFrameSnapshot(void) {
+    if (currentSnapshot == NULL
+        || currentSnapshot->frameIndex == submittedFrameIndex)
+        return currentSnapshot;
+
+    /*
+        NOTE: 이전 프레임의 스냅샷을 그리면 좌표 문자열이 정점보다 한 프레임 늦게
+        움직이므로, 업데이트 스레드가 아직 처리하지 않았다면 현재 스레드에서 만듦
+    */
+    UpdateFrameSnapshot();
+
+    currentSnapshot = AcquireTripleBuffer(&snapshotBuffer);
+
+    return currentSnapshot;
+}
+
+/* 업데이트 스레드를 종료하고, 할당된 메모리 공간을 해제하는 함수 */
+void DeinitUpdateThread(void) {
+    if (isUpdateThreadRunning) {
+        pthread_mutex_lock(&updateMutex);
+
+        shouldUpdateThreadExit = true;
+
+        pthread_cond_signal(&updateCond);
+
+        pthread_mutex_unlock(&updateMutex);
+
+        pthread_join(updateThread, NULL), isUpdateThreadRunning = false;
+    }
+
+    currentSnapshot = NULL;
+
+    for (int i = MVP_RENDER_ALL + 1; i < MVP_RENDER_COUNT_; i++)
+        UnloadLabelLayout(labelLayouts[i]), labelLayouts[i] = NULL;
+
+    UnloadTripleBuffer(&inputBuffer), UnloadTripleBuffer(&snapshotBuffer);
+}
+
+/* Private Functions ======================================================= */
+
+/* 버퍼 하나의 크기가 `slotSize`인 삼중 버퍼를 초기화하는 함수 */
+static bool InitTripleBuffer(TripleBuffer *buffer, size_t slotSize) {
+    unsigned char *slots = RL_CALLOC(3, slotSize);
+
+    if (slots == NULL) {
+        TraceLog(LOG_WARNING,
+                 "UPDATE: Failed to allocate triple buffer (%u bytes)",
+                 (unsigned int) (3 * slotSize));
+
+        return false;
+    }
+
+    *buffer = (TripleBuffer) { .slots = slots,
+                               .slotSize = slotSize,
+                               .writeIndex = 0,
+                               .middleIndex = 1,
+                               .readIndex = 2 };
+
+    return true;
+}
+
+/* 삼중 버퍼에서 쓰는 쪽이 사용할 버퍼를 반환하는 함수 */
+static void *GetTripleBufferWriteSlot(TripleBuffer *buffer) {
+    return buffer->slots + buffer->writeIndex * buffer->slotSize;
+}
+
+/* 쓰는 쪽이 사용하던 버퍼를 중간 버퍼와 교환하는 함수 */
+static void PublishTripleBuffer(TripleBuffer *buffer) {
+    // NOTE: 버퍼에 쓴 내용이 번호보다 먼저 보이도록 해제 (release) 순서로 교환
+    unsigned int oldIndex = __atomic_exchange_n(&buffer->middleIndex,
+                                                buffer->writeIndex
+                                                    | TRIPLE_BUFFER_FRESH_BIT,
+                                                __ATOMIC_ACQ_REL);
+
+    buffer->writeIndex = oldIndex & TRIPLE_BUFFER_INDEX_MASK;
+}
+
+/* 새로운 데이터가 있다면 중간 버퍼와 교환하고, 가장 최근의 버퍼를 반환하는 함수 */
+static const void *AcquireTripleBuffer(TripleBuffer *buffer) {
+    unsigned int middleIndex = __atomic_load_n(&buffer->middleIndex,
+                                               __ATOMIC_RELAXED);
+
+    if (middleIndex & TRIPLE_BUFFER_FRESH_BIT) {
+        unsigned int oldIndex = __atomic_exchange_n(&buffer->middleIndex,
+                                                    buffer->readIndex,
+                                                    __ATOMIC_ACQ_REL);
+
+        buffer->readIndex = oldIndex & TRIPLE_BUFFER_INDEX_MASK;
+    }
+
+    return buffer->slots + buffer->readIndex * buffer->slotSize;
+}
+
+/* 삼중 버퍼에 할당된 메모리 공간을 해제하는 함수 */
+static void UnloadTripleBuffer(TripleBuffer *buffer) {
+    RL_FREE(buffer->slots);
+
+    *buffer = (TripleBuffer) { 0 };
+}
+
+/* 업데이트 스레드에서 실행되는 함수 */
+static void *RunUpdateThread(void *arg) {
+    (void) arg;
+
+    pthread_mutex_lock(&updateMutex);
+
+    for (;;) {
+        while (!isUpdatePending && !shouldUpdateThreadExit)
+            pthread_cond_wait(&updateCond, &updateMutex);
+
+        if (shouldUpdateThreadExit) break;
+
+        isUpdatePending = false;
+
+        pthread_mutex_unlock(&updateMutex);
+
+        // NOTE: 그 사이에 들어온 입력은 건너뛰고, 항상 가장 최근의 입력만 처리
+        UpdateFrameSnapshot();
+
+        pthread_mutex_lock(&updateMutex);
+    }
+
+    pthread_mutex_unlock(&updateMutex);
+
+    return NULL;
+}
+
+/* 가장 최근의 입력으로 새로운 스냅샷을 만드는 함수 */
+static void UpdateFrameSnapshot(void) {
+    // NOTE: 두 스레드 모두 이 함수를 호출할 수 있으므로, 입력을 읽는 쪽도 함께 보호
+    pthread_mutex_lock(&snapshotMutex);
+
+    const FrameInput *input = AcquireTripleBuffer(&inputBuffer);
+
+    // 다른 스레드가 이미 가장 최근의 입력으로 스냅샷을 만들었다면 건너뜀
+    if (input->frameIndex == builtFrameIndex) {
+        pthread_mutex_unlock(&snapshotMutex);
+
+        return;
+    }
+
+    FrameSnapshot *snapshot = GetTripleBufferWriteSlot(&snapshotBuffer);
+
+    // NOTE: 쓰는 쪽의 버퍼에는 이전 스냅샷이 남아 있으므로, 모든 필드를 다시 작성
+    snapshot->isVertexVisible = input->isVertexVisible
+                                && input->targetSize.x > 0.0f
+                                && input->targetSize.y > 0.0f;
+
+    // 각 공간의 스냅샷은 서로 독립적이므로, 작업 스레드들에 나누어 처리
+    if (snapshot->isVertexVisible)
+        ParallelFor(MVP_RENDER_COUNT_ - (MVP_RENDER_ALL + 1),
+                    UpdateSpaceSnapshotJob,
+                    &(SnapshotJobData) { .input = input,
+                                         .snapshot = snapshot });
+
+    snapshot->frameIndex = builtFrameIndex = input->frameIndex;
+
+    PublishTripleBuffer(&snapshotBuffer);
+
+    pthread_mutex_unlock(&snapshotMutex);
+}
+
+/* 작업 스레드에서 `index + 1`번째 공간의 스냅샷을 만드는 함수 */
+static void UpdateSpaceSnapshotJob(void *userData, int index) {
+    const SnapshotJobData *jobData = userData;
+
+    MvpRenderMode renderMode = (MVP_RENDER_ALL + 1) + index;
+
+    UpdateSpaceVertexSnapshot(jobData->input,
+                              renderMode,
+                              &jobData->snapshot->spaces[renderMode]);
+}
+
+/* 한 공간에 그릴 플레이어 모델의 정점과 좌표 문자열을 계산하는 함수 */
+static void UpdateSpaceVertexSnapshot(const FrameInput *input,
+                                      MvpRenderMode renderMode,
+                                      SpaceVertexSnapshot *snapshot) {
+    const Camera *camera = &input->cameras[renderMode];
+
+    Matrix txMatrix = MatrixIdentity();
+
+    // "클립 공간"에서는 `BeginMode3D()`를 통해 세계 공간의 좌표를 변환
+    if (renderMode == MVP_RENDER_WORLD || renderMode == MVP_RENDER_CLIP)
+        txMatrix = input->modelMat;
+    else if (renderMode == MVP_RENDER_VIEW)
+        txMatrix = MatrixMultiply(input->modelMat, input->viewMat);
+
+    /*
+        NOTE: `GetWorldToScreenEx()`는 정점마다 행렬을 다시 만들고 rlgl의 상태를
+        읽으므로, 같은 계산을 하는 행렬을 공간마다 한 번만 만들어서 사용함
+    */
+    Matrix viewProjMat = MatrixMultiply(
+        MatrixLookAt(camera->position, camera->target, camera->up),
+        MatrixPerspective(camera->fovy * DEG2RAD,
+                          input->targetSize.x / input->targetSize.y,
+                          input->nearDistance,
+                          input->farDistance));
+
+    float textSizeMultiplier = Clamp(
+        0.35f * Vector3Distance(camera->position, camera->target), 1.0f, 1.25f);
+
+    snapshot->fontSize = input->fontBaseSize * textSizeMultiplier;
+
+    // 카메라와 가까운 정점부터, 좌표 문자열이 서로 겹치지 않도록 배치
+    LabelLayout *layout = labelLayouts[renderMode];
+
+    BeginLabelLayout(layout, input->targetSize.x, input->targetSize.y);
+
+    int labelIndices[GAME_OBJECT_VERTEX_COUNT];
+
+    for (int i = 0; i < GAME_OBJECT_VERTEX_COUNT; i++) {
+        Vector3 position = Vector3Transform(input->vertexPositions[i],
+                                            txMatrix);
+
+        snprintf(snapshot->texts[i],
+                 LABEL_TEXT_LENGTH,
+                 "#%d (%.1f, %.1f, %.1f)",
+                 i,
+                 position.x,
+                 position.y,
+                 position.z);
+
+        Quaternion clipPosition = QuaternionTransform(
+            (Quaternion) {
+                .x = position.x, .y = position.y, .z = position.z, .w = 1.0f },
+            viewProjMat);
+
+        labelIndices[i] = -1;
+
+        // NOTE: 카메라 뒤에 있는 정점은 `w`로 나누면 화면 안쪽으로 뒤집히므로 생략
+        if (clipPosition.w <= 0.0f) continue;
+
+        Vector2 anchor = {
+            .x = (0.5f + 0.5f * clipPosition.x / clipPosition.w)
+                 * input->targetSize.x,
+            .y = (0.5f - 0.5f * clipPosition.y / clipPosition.w)
+                 * input->targetSize.y
+        };
+
+        labelIndices[i] = AddLabelCandidate(
+            layout,
+            anchor,
+            MeasureSdfText(snapshot->texts[i], snapshot->fontSize, -1.0f),
+            1.5f * input->fontBaseSize,
+            Vector3DistanceSqr(camera->position, position));
+    }
+
+    EndLabelLayout(layout);
+
+    // NOTE: 생략된 정점의 문자열 상자 번호는 -1이므로, 화면에 나타나지 않음
+    for (int i = 0; i < GAME_OBJECT_VERTEX_COUNT; i++)
+        snapshot->isTextVisible[i] = GetLabelPosition(
+            layout, labelIndices[i], &snapshot->textPositions[i]);
+}
@@ -27,6 +27,10 @@
 
 #include "mvp-demo.h"
 
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
 #include "shaders/preload_shaders.h"
 
 /* Macro Constants ========================================================= */
@@ -38,6 +42,15 @@
 #define GUI_CAMERA_LOCKED_TEXT              "Locked"
 #define GUI_CAMERA_UNLOCKED_TEXT            "Unlocked"
 
+/* 관찰자 시점 카메라의 이동 속도 (초당 거리, raylib의 `UpdateCamera()`와 같음) */
+#define OBSERVER_CAMERA_MOVE_SPEED          5.4f
+
+/* 관찰자 시점 카메라의 회전 속도 (초당 라디안, raylib의 `UpdateCamera()`와 같음) */
+#define OBSERVER_CAMERA_ROTATION_SPEED      0.03f
+
+/* 마우스를 1픽셀 움직였을 때 관찰자 시점 카메라가 회전하는 각도 (라디안) */
+#define OBSERVER_CAMERA_MOUSE_SENSITIVITY   0.003f
+
 // clang-format on
 
 /* Constants =============================================================== */
@@ -56,8 +69,76 @@ static bool isObserverCameraLocked[MVP_RENDER_COUNT_] = {
     [MVP_RENDER_CLIP] = false
 };
 
+/* Private Function Prototypes ============================================= */
+
+/* 관찰자 시점 카메라를 대상 (`target`)을 중심으로 회전시키는 함수 */
+static void OrbitObserverCamera(Camera *camera, float yaw, float pitch);
+
 /* Public Functions ======================================================== */
 
+/* 크기, 회전 (사원수)과 이동 변환을 한 번에 합성한 "모델 행렬"을 반환하는 함수 */
+Matrix ComposeTRSMat(Vector3 translation, Quaternion rotation, Vector3 scale) {
+    /*
+        NOTE: `MatrixMultiply(MatrixMultiply(S, R), T)`와 같은 결과를 갖지만,
+        4x4 행렬 곱셈 없이 각 요소를 직접 계산함
+    */
+    float xx = rotation.x * rotation.x, yy = rotation.y * rotation.y;
+    float zz = rotation.z * rotation.z, xy = rotation.x * rotation.y;
+    float xz = rotation.x * rotation.z, yz = rotation.y * rotation.z;
+    float wx = rotation.w * rotation.x, wy = rotation.w * rotation.y;
+    float wz = rotation.w * rotation.z;
+
+    return (Matrix) { .m0 = scale.x * (1.0f - 2.0f * (yy + zz)),
+                      .m1 = scale.x * (2.0f * (xy + wz)),
+                      .m2 = scale.x * (2.0f * (xz - wy)),
+                      .m4 = scale.y * (2.0f * (xy - wz)),
+                      .m5 = scale.y * (1.0f - 2.0f * (xx + zz)),
+                      .m6 = scale.y * (2.0f * (yz + wx)),
+                      .m8 = scale.z * (2.0f * (xz + wy)),
+                      .m9 = scale.z * (2.0f * (yz - wx)),
+                      .m10 = scale.z * (1.0f - 2.0f * (xx + yy)),
+                      .m12 = translation.x,
+                      .m13 = translation.y,
+                      .m14 = translation.z,
+                      .m15 = 1.0f };
+}
+
+/* 크기, 회전 (오일러 각, 라디안)과 이동 변환을 한 번에 합성한 "모델 행렬"을 반환하는 함수 */
+Matrix ComposeEulerTRSMat(Vector3 translation, Vector3 angle, Vector3 scale) {
+    // NOTE: `MatrixRotateXYZ()`와 같은 순서로 회전 변환을 적용함
+    float cosx = cosf(-angle.x), sinx = sinf(-angle.x);
+    float cosy = cosf(-angle.y), siny = sinf(-angle.y);
+    float cosz = cosf(-angle.z), sinz = sinf(-angle.z);
+
+    return (Matrix) { .m0 = scale.x * (cosz * cosy),
+                      .m1 = scale.x * ((cosz * siny * sinx) - (sinz * cosx)),
+                      .m2 = scale.x * ((cosz * siny * cosx) + (sinz * sinx)),
+                      .m4 = scale.y * (sinz * cosy),
+                      .m5 = scale.y * ((sinz * siny * sinx) + (cosz * cosx)),
+                      .m6 = scale.y * ((sinz * siny * cosx) - (cosz * sinx)),
+                      .m8 = scale.z * (-siny),
+                      .m9 = scale.z * (cosy * sinx),
+                      .m10 = scale.z * (cosy * cosx),
+                      .m12 = translation.x,
+                      .m13 = translation.y,
+                      .m14 = translation.z,
+                      .m15 = 1.0f };
+}
+
+/* 물체 `count`개의 크기, 회전과 이동 변환을 합성한 "모델 행렬"들을 계산하는 함수 */
+void ComposeTRSMats(Matrix *result,
+                    const Vector3 *translations,
+                    const Quaternion *rotations,
+                    const Vector3 *scales,
+                    int count) {
+    if (result == NULL || translations == NULL || rotations == NULL
+        || scales == NULL)
+        return;
+
+    for (int i = 0; i < count; i++)
+        result[i] = ComposeTRSMat(translations[i], rotations[i], scales[i]);
+}
+
 /* 화살표를 그리는 함수 */
 void DrawArrow(Vector3 startPos, Vector3 endPos, Color color) {
     DrawCylinderEx(startPos, endPos, 0.015f, 0.015f, 16, color);
@@ -123,29 +204,27 @@ void DrawCameraHintText(RenderTexture renderTexture) {
 
     if (renderMode < MVP_RENDER_LOCAL || renderMode > MVP_RENDER_VIEW) return;
 
-    const char *cameraLockHintText = TextFormat(
+    const char *cameraLockHintText = FrameTextFormat(
         GUI_CAMERA_LOCK_HINT_TEXT,
         (isObserverCameraLocked[renderMode] ? GUI_CAMERA_LOCKED_TEXT
                                             : GUI_CAMERA_UNLOCKED_TEXT));
 
     Font guiFont = GetDefaultFont();
 
-    Vector2 cameraLockHintTextSize = MeasureTextEx(guiFont,
-                                                   cameraLockHintText,
-                                                   guiFont.baseSize,
-                                                   0.0f);
-
-    DrawTextEx(guiFont,
-               cameraLockHintText,
-               (Vector2) { .x = renderTexture.texture.width
-                                - (cameraLockHintTextSize.x + 8.0f),
-                           .y = renderTexture.texture.height
-                                - (cameraLockHintTextSize.y + 8.0f) },
-               guiFont.baseSize,
-               0.0f,
-               ColorBrightness(GetColor(0xa0ffe6ff),
-                               (isObserverCameraLocked[renderMode] ? -0.35f
-                                                                   : -0.15f)));
+    Vector2 cameraLockHintTextSize = MeasureSdfText(cameraLockHintText,
+                                                    guiFont.baseSize,
+                                                    0.0f);
+
+    DrawSdfText(cameraLockHintText,
+                (Vector2) { .x = renderTexture.texture.width
+                                 - (cameraLockHintTextSize.x + 8.0f),
+                            .y = renderTexture.texture.height
+                                 - (cameraLockHintTextSize.y + 8.0f) },
+                guiFont.baseSize,
+                0.0f,
+                ColorBrightness(GetColor(0xa0ffe6ff),
+                                (isObserverCameraLocked[renderMode] ? -0.35f
+                                                                    : -0.15f)));
 }
 
 /* 게임 세계의 물체를 그리는 함수 */
@@ -255,13 +334,17 @@ void DrawInfiniteGrid(const Camera *camera) {
 
     Shader shaderProgram = GetCommonShader();
 
-    static int cameraPositionLoc = -1;
+    static int cameraPositionLoc = -1, farDistanceLoc = -1;
 
     if (cameraPositionLoc < 0) {
         // 셰이더의 Uniform 위치 찾기
         cameraPositionLoc = GetShaderLocation(shaderProgram, "cameraPosition");
+        farDistanceLoc = GetShaderLocation(shaderProgram, "farDistance");
     }
 
+    // NOTE: 격자 평면은 "Far Distance"보다 먼 곳까지 그릴 필요가 없음
+    float farDistance = rlGetCullDistanceFar();
+
     // Y 좌표가 0 이하일 때도 격자 무늬 그리기
     rlDisableBackfaceCulling();
 
@@ -274,6 +357,11 @@ void DrawInfiniteGrid(const Camera *camera) {
                        &camera->position,
                        SHADER_UNIFORM_VEC3);
 
+        SetShaderValue(shaderProgram,
+                       farDistanceLoc,
+                       &farDistance,
+                       SHADER_UNIFORM_FLOAT);
+
         // 격자 무늬는 셰이더가 알아서 다 그려줌
         DrawRectangleRec((Rectangle) { .width = SCREEN_WIDTH,
                                        .height = SCREEN_HEIGHT },
@@ -286,66 +374,35 @@ void DrawInfiniteGrid(const Camera *camera) {
 }
 
 /* 플레이어 모델의 정점 좌표를 표시하는 함수 */
-void DrawPlayerVertices(RenderTexture renderTexture, MvpRenderMode renderMode) {
+void DrawPlayerVertices(MvpRenderMode renderMode) {
     if (!IsVertexVisibilityModeEnabled()) return;
 
-    const GameObject *gameObject = GetGameObject(OBJ_TYPE_PLAYER);
+    const FrameSnapshot *snapshot = GetFrameSnapshot();
 
-    Matrix tmpModelMat = gameObject->model.transform;
+    /*
+        NOTE: 좌표 문자열과 그 위치는 업데이트 스레드가 미리 계산해 두므로,
+        여기서는 현재 프레임의 스냅샷에 있는 문자열을 그리기만 함
+    */
+    if (snapshot == NULL || !snapshot->isVertexVisible) return;
 
-    Matrix virtualCameraViewMat = GetVirtualCameraViewMat(false);
-    Matrix virtualCameraProjMat = GetVirtualCameraProjMat(false);
-
-    const Camera *camera = GetLocalObserverCamera();
-
-    Matrix txMatrix = MatrixIdentity();
+    const GameObject *gameObject = GetGameObject(OBJ_TYPE_PLAYER);
 
-    if (renderMode == MVP_RENDER_WORLD)
-        camera = GetWorldObserverCamera(), txMatrix = tmpModelMat;
-    else if (renderMode == MVP_RENDER_VIEW)
-        camera = GetViewObserverCamera(),
-        txMatrix = MatrixMultiply(tmpModelMat, virtualCameraViewMat);
-    else if (renderMode == MVP_RENDER_CLIP)
-        camera = GetVirtualCamera(), txMatrix = tmpModelMat;
+    const SpaceVertexSnapshot *spaceSnapshot = &snapshot->spaces[renderMode];
 
-    float textSizeMultiplier = Clamp(
-        0.35f * Vector3Distance(camera->position, camera->target), 1.0f, 1.25f);
+    // NOTE: 모든 정점의 좌표를 한 번의 그리기 호출로 그림
+    BeginSdfText();
 
-    Font guiFont = GetDefaultFont();
+    for (int i = 0; i < GAME_OBJECT_VERTEX_COUNT; i++) {
+        if (!spaceSnapshot->isTextVisible[i]) continue;
 
-    int vertexCount = sizeof gameObject->vertexData
-                      / sizeof *(gameObject->vertexData);
-
-    for (int i = 0; i < vertexCount; i++) {
-        Vector3 vertexPosition =
-            Vector3Transform(gameObject->vertexData[i].position, txMatrix);
-
-        const char *vertexCoordsText = TextFormat("#%d (%.1f, %.1f, %.1f)",
-                                                  i,
-                                                  vertexPosition.x,
-                                                  vertexPosition.y,
-                                                  vertexPosition.z);
-
-        Vector2 vertexCoordsTextSize = MeasureTextEx(guiFont,
-                                                     vertexCoordsText,
-                                                     guiFont.baseSize,
-                                                     -1.0f);
-
-        Vector2 textPosition =
-            Vector2Add(GetWorldToScreenEx(vertexPosition,
-                                          *camera,
-                                          renderTexture.texture.width,
-                                          renderTexture.texture.height),
-                       (Vector2) { .x = -0.5f * vertexCoordsTextSize.x,
-                                   .y = 1.5f * guiFont.baseSize });
-
-        DrawTextEx(guiFont,
-                   vertexCoordsText,
-                   textPosition,
-                   (guiFont.baseSize) * textSizeMultiplier,
-                   -1.0f,
-                   ColorAlpha(gameObject->vertexData[i].color, 0.95f));
+        DrawSdfText(spaceSnapshot->texts[i],
+                    spaceSnapshot->textPositions[i],
+                    spaceSnapshot->fontSize,
+                    -1.0f,
+                    ColorAlpha(gameObject->vertexData[i].color, 0.95f));
     }
+
+    EndSdfText();
 }
 
 /* 가상 카메라의 View Frustum을 그리는 함수 */
@@ -468,6 +525,61 @@ void DrawViewFrustum(MvpRenderMode renderMode, Color color) {
     }
 }
 
+/* 실수 `value`를 소수점 아래 `precision`자리까지 `buffer`에 기록하는 함수 */
+int FormatFixedFloat(char *buffer, int bufferSize, float value, int precision) {
+    static const double powersOfTen[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6 };
+
+    if (buffer == NULL || bufferSize <= 0) return 0;
+
+    precision = (precision < 0) ? 0 : ((precision > 6) ? 6 : precision);
+
+    // NOTE: 무한대, NaN 또는 매우 큰 값은 거의 없으므로 C 표준 라이브러리에 맡김
+    if (!isfinite(value) || fabsf(value) >= 1e9f)
+        return snprintf(buffer, bufferSize, "%.*f", precision, value);
+
+    /*
+        `float`의 가수부는 24비트이므로, 10^6 이하의 수를 곱한 결과는 `double`로
+        정확하게 나타낼 수 있음 (`snprintf()`와 같이 "round-half-to-even" 적용)
+    */
+    double scaledValue = fabs((double) value) * powersOfTen[precision];
+    double truncatedValue = floor(scaledValue);
+    double remainder = scaledValue - truncatedValue;
+
+    unsigned long long fixedValue = (unsigned long long) truncatedValue;
+
+    fixedValue += (remainder > 0.5)
+                  | ((remainder == 0.5) & (int) (fixedValue & 1ULL));
+
+    char digits[32];
+
+    int digitIndex = sizeof digits;
+
+    // 소수 부분을 뒤에서부터 기록
+    for (int i = 0; i < precision; i++, fixedValue /= 10ULL)
+        digits[--digitIndex] = '0' + (char) (fixedValue % 10ULL);
+
+    if (precision > 0) digits[--digitIndex] = '.';
+
+    // 정수 부분을 뒤에서부터 기록
+    do {
+        digits[--digitIndex] = '0' + (char) (fixedValue % 10ULL);
+
+        fixedValue /= 10ULL;
+    } while (fixedValue > 0ULL);
+
+    // NOTE: `snprintf()`와 마찬가지로 "-0.0"의 부호도 유지
+    if (signbit(value)) digits[--digitIndex] = '-';
+
+    int length = (int) sizeof digits - digitIndex;
+    int copyLength = (length < bufferSize) ? length : (bufferSize - 1);
+
+    memcpy(buffer, digits + digitIndex, copyLength);
+
+    buffer[copyLength] = '\0';
+
+    return length;
+}
+
 /* 마우스 커서 종류를 반환하는 함수 */
 MouseCursor GetMouseCursor(void) {
     return !isObserverCameraLocked[GetMvpRenderMode()] ? MOUSE_CURSOR_CROSSHAIR
@@ -481,34 +593,27 @@ bool IsObserverCameraLocked(void) {
 
 /* 공용 셰이더 프로그램을 반환하는 함수 */
 Shader LoadCommonShader(void) {
-    // 셰이더 소스 파일을 컴파일 및 링크하여 셰이더 프로그램 생성
-    Shader shaderProgram = LoadShaderFromMemory(resShadersCommonVsVert,
-                                                resShadersCommonFsFrag);
-
-    float gridSlicesValue = GRID_SLICES_VALUE;
-    float gridSpacingValue = GRID_SPACING_VALUE;
-    float gridThickValue = GRID_THICK_VALUE;
-
-    int slicesLoc = GetShaderLocation(shaderProgram, "slices");
-    int spacingLoc = GetShaderLocation(shaderProgram, "spacing");
-    int thickLoc = GetShaderLocation(shaderProgram, "thick");
-
-    SetShaderValue(shaderProgram,
-                   slicesLoc,
-                   &gridSlicesValue,
-                   SHADER_UNIFORM_FLOAT);
-
-    SetShaderValue(shaderProgram,
-                   spacingLoc,
-                   &gridSpacingValue,
-                   SHADER_UNIFORM_FLOAT);
-
-    SetShaderValue(shaderProgram,
-                   thickLoc,
-                   &gridThickValue,
-                   SHADER_UNIFORM_FLOAT);
-
-    return shaderProgram;
+    /*
+        NOTE: 격자의 값들은 바뀌지 않으므로, Uniform 대신 상수로 추가하여
+        셰이더 컴파일러가 계산을 미리 할 수 있도록 함 (값을 바꿔야 한다면,
+        그 상수를 빼고 셰이더 변형을 만든 다음 `SetShaderVariantValue()` 사용)
+    */
+    const ShaderDefine gridDefines[] = {
+        { .name = "GRID_SLICES", .value = GRID_SLICES_VALUE },
+        { .name = "GRID_SPACING", .value = GRID_SPACING_VALUE },
+        { .name = "GRID_LINE_WIDTH", .value = GRID_LINE_WIDTH_VALUE }
+    };
+
+    return LoadShaderVariant(resShadersCommonVsVert,
+                             resShadersCommonFsFrag,
+                             gridDefines,
+                             sizeof gridDefines / sizeof *gridDefines);
+}
+
+/* SDF 글꼴로 문자열을 그리는 셰이더 프로그램을 반환하는 함수 */
+Shader LoadSdfTextShader(void) {
+    // NOTE: 정점 셰이더는 raylib의 기본 정점 셰이더를 사용
+    return LoadShaderVariant(NULL, resShadersSdfFsFrag, NULL, 0);
 }
 
 /* 관찰자 시점 카메라의 잠금 여부를 변경하는 함수 */
@@ -520,3 +625,71 @@ void ToggleObserverCameraLock(void) {
     SetMouseCursor(!isObserverCameraLocked[renderMode] ? MOUSE_CURSOR_CROSSHAIR
                                                        : MOUSE_CURSOR_DEFAULT);
 }
+
+/* 기록된 프레임 시간으로 관찰자 시점 카메라를 업데이트하는 함수 */
+void UpdateObserverCamera(Camera *camera) {
+    if (camera == NULL) return;
+
+    /*
+        NOTE: `UpdateCamera()`는 실제 프레임 시간 (`GetFrameTime()`)을 사용하므로,
+        입력을 재생할 때도 같은 결과가 나오도록 기록된 프레임 시간을 사용함
+    */
+    float frameTime = GetReplayFrameTime();
+
+    float moveSpeed = OBSERVER_CAMERA_MOVE_SPEED * frameTime;
+    float rotationSpeed = OBSERVER_CAMERA_ROTATION_SPEED * frameTime;
+
+    {
+        Vector2 mouseDelta = GetMouseDelta();
+
+        float yaw = -mouseDelta.x * OBSERVER_CAMERA_MOUSE_SENSITIVITY;
+        float pitch = -mouseDelta.y * OBSERVER_CAMERA_MOUSE_SENSITIVITY;
+
+        yaw += (IsKeyDown(KEY_LEFT) - IsKeyDown(KEY_RIGHT)) * rotationSpeed;
+        pitch += (IsKeyDown(KEY_UP) - IsKeyDown(KEY_DOWN)) * rotationSpeed;
+
+        // NOTE: `CAMERA_THIRD_PERSON`처럼 대상을 중심으로 회전
+        OrbitObserverCamera(camera, yaw, pitch);
+    }
+
+    {
+        Vector3 movement = {
+            .x = (IsKeyDown(KEY_W) - IsKeyDown(KEY_S)) * moveSpeed,
+            .y = (IsKeyDown(KEY_D) - IsKeyDown(KEY_A)) * moveSpeed
+        };
+
+        // NOTE: `UpdateCameraPro()`의 회전 각도는 도 (degree) 단위
+        Vector3 rotation = {
+            .z = (IsKeyDown(KEY_E) - IsKeyDown(KEY_Q)) * rotationSpeed
+                 * RAD2DEG
+        };
+
+        float zoom = -GetMouseWheelMove();
+
+        if (IsKeyPressed(KEY_KP_SUBTRACT)) zoom += 2.0f;
+        if (IsKeyPressed(KEY_KP_ADD)) zoom -= 2.0f;
+
+        UpdateCameraPro(camera, movement, rotation, zoom);
+    }
+}
+
+/* Private Functions ======================================================= */
+
+/* 관찰자 시점 카메라를 대상 (`target`)을 중심으로 회전시키는 함수 */
+static void OrbitObserverCamera(Camera *camera, float yaw, float pitch) {
+    Vector3 up = Vector3Normalize(camera->up);
+
+    Vector3 targetOffset = Vector3Subtract(camera->target, camera->position);
+
+    // 카메라가 위쪽 또는 아래쪽을 똑바로 바라보지 않도록 "Pitch" 각도 제한
+    pitch = Clamp(pitch,
+                  0.001f - Vector3Angle(Vector3Negate(up), targetOffset),
+                  Vector3Angle(up, targetOffset) - 0.001f);
+
+    Vector3 right = Vector3Normalize(Vector3CrossProduct(targetOffset, up));
+
+    targetOffset = Vector3RotateByAxisAngle(targetOffset, right, pitch);
+    targetOffset = Vector3RotateByAxisAngle(targetOffset, up, yaw);
+
+    camera->position = Vector3Subtract(camera->target, targetOffset);
+}
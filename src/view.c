@@ -53,11 +53,6 @@ static Camera3D camera = {
 
 /* clang-format on */
 
-/* Private Function Prototypes ============================================= */
-
-/* 마우스 및 키보드 입력을 처리하는 함수 */
-static void HandleInputEvents(void);
-
 /* Public Functions ======================================================== */
 
 /* "카메라 (뷰) 공간"을 초기화하는 함수 */
@@ -65,45 +60,42 @@ void InitViewSpace(void) {
     // TODO: ...
 }
 
-/* 프레임버퍼에 "카메라 (뷰) 공간"을 그리는 함수 */
-void UpdateViewSpace(RenderTexture renderTexture) {
-    HandleInputEvents();
-
-    // 렌더 텍스처 (프레임버퍼) 초기화
-    BeginTextureMode(renderTexture);
-
-    {
-        ClearBackground(WHITE);
+/* "카메라 (뷰) 공간"의 마우스 및 키보드 입력을 처리하는 함수 */
+void HandleViewSpaceInput(void) {
+    if (GetMvpRenderMode() != MVP_RENDER_VIEW) return;
 
-        {
-            BeginMode3D(camera);
+    if (IsKeyPressed(KEY_ESCAPE)) ToggleObserverCameraLock();
 
-            DrawAxes();
+    if (!IsObserverCameraLocked()) UpdateObserverCamera(&camera);
+}
 
-            for (int i = 0; i < OBJ_TYPE_COUNT_; i++)
-                DrawGameObject(GetGameObject(i),
-                               renderTexture,
-                               MVP_RENDER_VIEW);
+/* "카메라 (뷰) 공간"을 그리는 명령들을 기록하는 함수 */
+void RecordViewSpace(DrawCommandList *commandList) {
+    commandList->camera = camera;
 
-            DrawInfiniteGrid(&camera);
+    AddDrawCommand(commandList, (DrawCommand) { .type = DRAW_COMMAND_AXES });
 
-            EndMode3D();
-        }
+    for (int i = 0; i < OBJ_TYPE_COUNT_; i++)
+        AddDrawCommand(commandList,
+                       (DrawCommand) { .type = DRAW_COMMAND_GAME_OBJECT,
+                                       .objectIndex = i });
 
-        DrawPlayerVertices(renderTexture, MVP_RENDER_VIEW);
+    AddDrawCommand(commandList,
+                   (DrawCommand) { .type = DRAW_COMMAND_INFINITE_GRID });
 
-        // NOTE: 알파 값이 높은 (불투명한) 물체일수록 먼저 그려야 함
-        DrawRectangleRec((Rectangle) { .width = renderTexture.texture.width,
-                                       .height = renderTexture.texture.height },
-                         ColorAlpha(GREEN, 0.05f));
+    // NOTE: 정점의 좌표와 도움말은 하나의 그리기 호출로 묶여서 그려짐
+    AddDrawCommand(commandList,
+                   (DrawCommand) { .type = DRAW_COMMAND_PLAYER_VERTICES });
 
-        DrawCameraHintText(renderTexture);
+    AddDrawCommand(commandList,
+                   (DrawCommand) { .type = DRAW_COMMAND_CAMERA_HINT_TEXT });
 
-        DrawFPS(8, 8);
-    }
+    // NOTE: 알파 값이 높은 (불투명한) 물체일수록 먼저 그려야 함
+    AddDrawCommand(commandList,
+                   (DrawCommand) { .type = DRAW_COMMAND_TINT,
+                                   .color = ColorAlpha(GREEN, 0.05f) });
 
-    // 기본 프레임버퍼 상태로 되돌아가기
-    EndTextureMode();
+    AddDrawCommand(commandList, (DrawCommand) { .type = DRAW_COMMAND_FPS });
 }
 
 /* "카메라 (뷰) 공간"에 필요한 메모리 공간을 해제하는 함수 */
@@ -116,15 +108,4 @@ void DeinitViewSpace(void) {
 /* "카메라 (뷰) 공간"의 관찰자 시점 카메라를 반환하는 함수 */
 Camera *GetViewObserverCamera(void) {
     return &camera;
-}
-
-/* Private Functions ======================================================= */
-
-/* 마우스 및 키보드 입력을 처리하는 함수 */
-static void HandleInputEvents(void) {
-    if (GetMvpRenderMode() != MVP_RENDER_VIEW) return;
-
-    if (IsKeyPressed(KEY_ESCAPE)) ToggleObserverCameraLock();
-
-    if (!IsObserverCameraLocked()) UpdateCamera(&camera, CAMERA_THIRD_PERSON);
 }
\ No newline at end of file
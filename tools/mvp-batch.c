@@ -0,0 +1,732 @@
+/*
+    Copyright (c) 2024 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ================================================================ */
+
+// NOTE: raylib 라이브러리 없이도 링크할 수 있도록 `raymath.h`의 함수를 내부에 포함
+#define RAYMATH_STATIC_INLINE
+
+#include "mvp-demo.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+/* Macro Constants ========================================================= */
+
+// clang-format off
+
+#define BATCH_LOG_PREFIX                    "MVP-BATCH: "
+
+/* 한 번에 메모리에 올릴 입력 파일의 최대 크기 (바이트) */
+#define BATCH_CHUNK_SIZE                    (64 * 1024 * 1024)
+
+/* 작업 스레드의 최대 개수 */
+#define BATCH_MAX_THREAD_COUNT              64
+
+/* 각 정점마다 출력할 값의 개수 (클립 좌표 4개, NDC 좌표 3개, 화면 좌표 2개) */
+#define BATCH_OUTPUT_VALUE_COUNT            9
+
+/*
+    CSV 형식으로 출력할 때, 각 값마다 필요한 문자열의 최대 길이
+    (`-FLT_MAX`를 `%.6f`로 출력한 39자리 정수부, 부호, 소수점, 소수부와 구분자)
+*/
+#define BATCH_CSV_VALUE_LENGTH              48
+
+/* CSV 형식으로 출력할 때, 각 정점마다 필요한 문자열의 최대 길이 */
+#define BATCH_CSV_LINE_LENGTH               (BATCH_OUTPUT_VALUE_COUNT \
+                                             * BATCH_CSV_VALUE_LENGTH)
+
+// clang-format on
+
+/* Typedefs ================================================================ */
+
+/* 4개의 `float`를 한 번에 계산하는 SIMD 벡터 */
+typedef float v4f __attribute__((vector_size(16)));
+
+/* 입력 파일의 형식 */
+typedef enum BatchInputFormat_ {
+    BATCH_INPUT_BIN,  // `float` 3개 (x, y, z)로 이루어진 정점 배열
+    BATCH_INPUT_OBJ   // Wavefront OBJ 파일의 `v` 요소
+} BatchInputFormat;
+
+/* 출력 파일의 형식 */
+typedef enum BatchOutputFormat_ {
+    BATCH_OUTPUT_CSV,  // 쉼표로 구분된 텍스트
+    BATCH_OUTPUT_BIN   // 정점마다 `float` 9개
+} BatchOutputFormat;
+
+/* 명령줄 옵션 */
+typedef struct BatchOptions_ {
+    const char *inputPath;                // 입력 파일의 경로
+    const char *outputPath;               // 출력 파일의 경로 (`NULL`: 표준 출력)
+    BatchInputFormat inputFormat;         // 입력 파일의 형식
+    BatchOutputFormat outputFormat;       // 출력 파일의 형식
+    int threadCount;                      // 작업 스레드의 개수
+    Vector3 scale, trans, rotate;         // "모델 행렬"의 각 변환 정보
+    Vector3 eye, at, up;                  // "뷰 행렬"의 각 벡터
+    float fov, nearDistance, farDistance; // "투영 행렬"의 각 값
+    int screenWidth, screenHeight;        // 화면 좌표를 계산할 화면의 크기
+} BatchOptions;
+
+/* 작업 스레드가 처리할 입력 데이터의 범위와 그 결과 */
+typedef struct BatchJob_ {
+    const unsigned char *begin, *end;  // 입력 데이터의 범위
+    unsigned char *output;             // 출력 데이터
+    size_t outputSize;                 // 출력 데이터의 크기
+    size_t outputCapacity;             // 출력 데이터 버퍼의 크기
+    size_t vertexCount;                // 처리한 정점의 개수
+    bool failed;                       // 작업 실패 여부
+} BatchJob;
+
+/* 입력 파일의 일부를 메모리에 올린 영역 */
+typedef struct BatchWindow_ {
+    unsigned char *base;  // 메모리에 올린 영역의 시작 주소
+    size_t baseSize;      // 메모리에 올린 영역의 크기
+    unsigned char *data;  // 요청한 위치의 시작 주소
+} BatchWindow;
+
+/* Private Variables ======================================================= */
+
+/* "MVP 행렬"의 각 열 */
+static v4f mvpColumns[4];
+
+/* 화면 좌표 계산에 사용할 화면의 크기 */
+static float screenWidth, screenHeight;
+
+/* 출력 파일의 형식 */
+static BatchOutputFormat outputFormat;
+
+/* 입력 파일의 형식 */
+static BatchInputFormat inputFormat;
+
+/* Private Function Prototypes ============================================= */
+
+/* 정점 하나를 변환하여 `job`의 출력 데이터에 추가하는 함수 */
+static void EmitVertex(BatchJob *job, float x, float y, float z);
+
+/* 입력 파일의 크기를 반환하는 함수 */
+static bool GetFileSize64(FILE *file, uint64_t *result);
+
+/* 입력 파일의 `offset` 위치부터 `size` 바이트를 메모리에 올리는 함수 */
+static bool MapFileWindow(FILE *file,
+                          uint64_t offset,
+                          size_t size,
+                          BatchWindow *window);
+
+/* 명령줄 옵션을 해석하는 함수 */
+static bool ParseOptions(int argc, char *argv[], BatchOptions *options);
+
+/* `x,y,z` 형식의 문자열을 해석하는 함수 */
+static bool ParseVector3(const char *text, Vector3 *result);
+
+/* 사용 방법을 출력하는 함수 */
+static void PrintUsage(const char *programName);
+
+/* 작업 스레드에서 입력 데이터의 범위를 처리하는 함수 */
+static void *ProcessJob(void *arg);
+
+/* `job`의 출력 데이터 버퍼에 `size` 바이트 이상의 공간을 확보하는 함수 */
+static bool ReserveJobOutput(BatchJob *job, size_t size);
+
+/* 메모리에 올린 입력 파일의 영역을 해제하는 함수 */
+static void UnmapFileWindow(BatchWindow *window);
+
+/* Public Functions ======================================================== */
+
+int main(int argc, char *argv[]) {
+    BatchOptions options = {
+        // NOTE: 각 값의 기본값은 프로그램을 처음 실행했을 때의 GUI 패널과 같음
+        .inputFormat = BATCH_INPUT_BIN,
+        .outputFormat = BATCH_OUTPUT_CSV,
+        .scale = { 1.0f, 1.0f, 1.0f },
+        .trans = { 2.0f, 0.5f, 2.0f },
+        .rotate = { 0.0f, 0.0f, 0.0f },
+        .eye = { -3.0f, 2.25f, -0.5f },
+        .at = { 0.0f, 0.0f, 0.0f },
+        .up = { 0.0f, 1.0f, 0.0f },
+        .fov = 60.0f,
+        .nearDistance = CULL_DISTANCE_NEAR_MIN_VALUE,
+        .farDistance = CULL_DISTANCE_FAR_MAX_VALUE,
+        .screenWidth = SCREEN_WIDTH - (SCREEN_WIDTH / 5),
+        .screenHeight = SCREEN_HEIGHT
+    };
+
+    if (!ParseOptions(argc, argv, &options)) {
+        PrintUsage(argv[0]);
+
+        return 1;
+    }
+
+    {
+        /* 프로그램과 같은 방법으로 "모델 / 뷰 / 투영 행렬" 계산 */
+
+        Matrix modelMat = MatrixMultiply(
+            MatrixMultiply(MatrixScale(options.scale.x,
+                                       options.scale.y,
+                                       options.scale.z),
+                           MatrixRotateXYZ(Vector3Scale(options.rotate,
+                                                        DEG2RAD))),
+            MatrixTranslate(options.trans.x, options.trans.y, options.trans.z));
+
+        Matrix viewMat = MatrixLookAt(options.eye, options.at, options.up);
+
+        Matrix projMat = MatrixPerspective(options.fov * DEG2RAD,
+                                           (double) options.screenWidth
+                                               / options.screenHeight,
+                                           options.nearDistance,
+                                           options.farDistance);
+
+        Matrix mvpMat = MatrixMultiply(MatrixMultiply(modelMat, viewMat),
+                                       projMat);
+
+        mvpColumns[0] = (v4f) { mvpMat.m0, mvpMat.m1, mvpMat.m2, mvpMat.m3 };
+        mvpColumns[1] = (v4f) { mvpMat.m4, mvpMat.m5, mvpMat.m6, mvpMat.m7 };
+        mvpColumns[2] = (v4f) { mvpMat.m8, mvpMat.m9, mvpMat.m10, mvpMat.m11 };
+        mvpColumns[3] = (v4f) { mvpMat.m12,
+                                mvpMat.m13,
+                                mvpMat.m14,
+                                mvpMat.m15 };
+
+        screenWidth = options.screenWidth, screenHeight = options.screenHeight;
+
+        inputFormat = options.inputFormat, outputFormat = options.outputFormat;
+    }
+
+    FILE *inputFile = fopen(options.inputPath, "rb");
+
+    if (inputFile == NULL) {
+        fprintf(stderr,
+                BATCH_LOG_PREFIX "Failed to open '%s': %s\n",
+                options.inputPath,
+                strerror(errno));
+
+        return 1;
+    }
+
+    FILE *outputFile = (options.outputPath != NULL)
+                           ? fopen(options.outputPath, "wb")
+                           : stdout;
+
+    if (outputFile == NULL) {
+        fprintf(stderr,
+                BATCH_LOG_PREFIX "Failed to open '%s': %s\n",
+                options.outputPath,
+                strerror(errno));
+
+        fclose(inputFile);
+
+        return 1;
+    }
+
+    uint64_t fileSize = 0, offset = 0, totalVertexCount = 0;
+
+    bool succeeded = GetFileSize64(inputFile, &fileSize);
+
+    BatchJob jobs[BATCH_MAX_THREAD_COUNT] = { { 0 } };
+
+    pthread_t threads[BATCH_MAX_THREAD_COUNT];
+
+    bool isThreadCreated[BATCH_MAX_THREAD_COUNT];
+
+    struct timespec startTime, endTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+    // NOTE: 입력 파일이 메모리보다 크더라도 처리할 수 있도록 일정 크기씩 처리
+    while (succeeded && offset < fileSize) {
+        size_t windowSize = (fileSize - offset < BATCH_CHUNK_SIZE)
+                                ? (size_t) (fileSize - offset)
+                                : BATCH_CHUNK_SIZE;
+
+        BatchWindow window = { 0 };
+
+        if (!MapFileWindow(inputFile, offset, windowSize, &window)) {
+            succeeded = false;
+
+            break;
+        }
+
+        const unsigned char *begin = window.data, *end = begin + windowSize;
+
+        if (inputFormat == BATCH_INPUT_BIN) {
+            // 정점의 일부만 포함되지 않도록, 정점 크기의 배수만큼만 처리
+            end = begin + (windowSize - (windowSize % (3 * sizeof(float))));
+        } else if (offset + windowSize < fileSize) {
+            // 줄의 일부만 포함되지 않도록, 마지막 줄바꿈 문자까지만 처리
+            while (end > begin && end[-1] != '\n')
+                end--;
+        }
+
+        if (end == begin) {
+            fprintf(stderr,
+                    BATCH_LOG_PREFIX "Malformed input near byte %llu\n",
+                    (unsigned long long) offset);
+
+            UnmapFileWindow(&window);
+
+            succeeded = false;
+
+            break;
+        }
+
+        {
+            /* 입력 데이터를 작업 스레드의 개수만큼 나누어 처리 */
+
+            size_t stride = (size_t) (end - begin) / options.threadCount;
+
+            if (inputFormat == BATCH_INPUT_BIN)
+                stride -= stride % (3 * sizeof(float));
+
+            const unsigned char *jobBegin = begin;
+
+            for (int i = 0; i < options.threadCount; i++) {
+                const unsigned char *jobEnd = end;
+
+                if (i < options.threadCount - 1) {
+                    jobEnd = jobBegin + stride;
+
+                    if (jobEnd > end) jobEnd = end;
+
+                    if (inputFormat == BATCH_INPUT_OBJ)
+                        while (jobEnd < end && jobEnd[-1] != '\n')
+                            jobEnd++;
+                }
+
+                jobs[i].begin = jobBegin, jobs[i].end = jobEnd;
+
+                jobs[i].outputSize = 0, jobs[i].vertexCount = 0;
+
+                isThreadCreated[i] = (pthread_create(&threads[i],
+                                                     NULL,
+                                                     ProcessJob,
+                                                     &jobs[i])
+                                      == 0);
+
+                jobBegin = jobEnd;
+            }
+
+            // 입력 순서대로 출력 데이터를 기록
+            for (int i = 0; i < options.threadCount; i++) {
+                // 스레드를 만들 수 없었다면, 현재 스레드에서 직접 처리
+                if (isThreadCreated[i])
+                    pthread_join(threads[i], NULL);
+                else
+                    ProcessJob(&jobs[i]);
+
+                if (jobs[i].failed) succeeded = false;
+
+                if (succeeded
+                    && fwrite(jobs[i].output, 1, jobs[i].outputSize, outputFile)
+                           != jobs[i].outputSize)
+                    succeeded = false;
+
+                totalVertexCount += jobs[i].vertexCount;
+            }
+        }
+
+        offset += (uint64_t) (end - begin);
+
+        UnmapFileWindow(&window);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &endTime);
+
+    for (int i = 0; i < options.threadCount; i++)
+        free(jobs[i].output);
+
+    fclose(inputFile);
+
+    if (outputFile != stdout) fclose(outputFile);
+
+    double elapsedTime = (endTime.tv_sec - startTime.tv_sec)
+                         + (endTime.tv_nsec - startTime.tv_nsec) * 1e-9;
+
+    fprintf(stderr,
+            BATCH_LOG_PREFIX "%s %llu vertices in %.3f s (%d threads)\n",
+            succeeded ? "Processed" : "Failed after",
+            (unsigned long long) totalVertexCount,
+            elapsedTime,
+            options.threadCount);
+
+    return succeeded ? 0 : 1;
+}
+
+/* Private Functions ======================================================= */
+
+/* 정점 하나를 변환하여 `job`의 출력 데이터에 추가하는 함수 */
+static void EmitVertex(BatchJob *job, float x, float y, float z) {
+    // NOTE: "MVP 행렬"의 각 열에 정점의 각 요소를 곱하여 4개의 요소를 한 번에 계산
+    v4f clip = mvpColumns[0] * x + mvpColumns[1] * y + mvpColumns[2] * z
+               + mvpColumns[3];
+
+    v4f ndc = clip / clip[3];
+
+    float values[BATCH_OUTPUT_VALUE_COUNT] = {
+        clip[0],
+        clip[1],
+        clip[2],
+        clip[3],
+        ndc[0],
+        ndc[1],
+        ndc[2],
+        (0.5f * ndc[0] + 0.5f) * screenWidth,
+        (0.5f - 0.5f * ndc[1]) * screenHeight
+    };
+
+    if (outputFormat == BATCH_OUTPUT_BIN) {
+        if (!ReserveJobOutput(job, sizeof values)) {
+            job->failed = true;
+
+            return;
+        }
+
+        memcpy(job->output + job->outputSize, values, sizeof values);
+
+        job->outputSize += sizeof values;
+    } else {
+        if (!ReserveJobOutput(job, BATCH_CSV_LINE_LENGTH)) {
+            job->failed = true;
+
+            return;
+        }
+
+        int length = snprintf((char *) job->output + job->outputSize,
+                              BATCH_CSV_LINE_LENGTH,
+                              "%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,"
+                              "%.3f,%.3f\n",
+                              values[0],
+                              values[1],
+                              values[2],
+                              values[3],
+                              values[4],
+                              values[5],
+                              values[6],
+                              values[7],
+                              values[8]);
+
+        // NOTE: 문자열이 잘렸다면, 잘린 길이만큼 출력 데이터를 늘리지 않음
+        if (length < 0 || length >= BATCH_CSV_LINE_LENGTH) {
+            job->failed = true;
+
+            return;
+        }
+
+        job->outputSize += length;
+    }
+
+    job->vertexCount++;
+}
+
+/* 입력 파일의 크기를 반환하는 함수 */
+static bool GetFileSize64(FILE *file, uint64_t *result) {
+#ifndef _WIN32
+    struct stat fileStat;
+
+    if (fstat(fileno(file), &fileStat) != 0) return false;
+
+    *result = (uint64_t) fileStat.st_size;
+#else
+    if (_fseeki64(file, 0, SEEK_END) != 0) return false;
+
+    *result = (uint64_t) _ftelli64(file);
+#endif
+
+    return true;
+}
+
+/* 입력 파일의 `offset` 위치부터 `size` 바이트를 메모리에 올리는 함수 */
+static bool MapFileWindow(FILE *file,
+                          uint64_t offset,
+                          size_t size,
+                          BatchWindow *window) {
+#ifndef _WIN32
+    // NOTE: `mmap()`의 시작 위치는 페이지 크기의 배수여야 함
+    uint64_t pageSize = (uint64_t) sysconf(_SC_PAGESIZE);
+    uint64_t alignedOffset = offset - (offset % pageSize);
+
+    window->baseSize = size + (size_t) (offset - alignedOffset);
+
+    window->base = mmap(NULL,
+                        window->baseSize,
+                        PROT_READ,
+                        MAP_PRIVATE,
+                        fileno(file),
+                        (off_t) alignedOffset);
+
+    if (window->base == MAP_FAILED) {
+        fprintf(stderr,
+                BATCH_LOG_PREFIX "Failed to map input file: %s\n",
+                strerror(errno));
+
+        window->base = NULL;
+
+        return false;
+    }
+
+    // 입력 데이터를 처음부터 끝까지 한 번만 읽으므로, 미리 읽도록 설정
+    madvise(window->base, window->baseSize, MADV_SEQUENTIAL);
+
+    window->data = window->base + (offset - alignedOffset);
+#else
+    // NOTE: `mmap()`을 사용할 수 없는 환경에서는 입력 파일을 직접 읽음
+    window->base = malloc(size);
+    window->baseSize = size;
+
+    if (window->base == NULL || _fseeki64(file, (__int64) offset, SEEK_SET)
+        || fread(window->base, 1, size, file) != size) {
+        fprintf(stderr, BATCH_LOG_PREFIX "Failed to read input file\n");
+
+        free(window->base), window->base = NULL;
+
+        return false;
+    }
+
+    window->data = window->base;
+#endif
+
+    return true;
+}
+
+/* 명령줄 옵션을 해석하는 함수 */
+static bool ParseOptions(int argc, char *argv[], BatchOptions *options) {
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+
+        // 값이 필요 없는 옵션이 없으므로, 모든 옵션은 다음 인자를 값으로 사용
+        if (arg[0] == '-' && arg[1] == '-') {
+            if (i + 1 >= argc) return false;
+
+            const char *value = argv[++i];
+
+            bool isValid = true;
+
+            if (strcmp(arg, "--input-format") == 0) {
+                if (strcmp(value, "bin") == 0)
+                    options->inputFormat = BATCH_INPUT_BIN;
+                else if (strcmp(value, "obj") == 0)
+                    options->inputFormat = BATCH_INPUT_OBJ;
+                else
+                    isValid = false;
+            } else if (strcmp(arg, "--output-format") == 0) {
+                if (strcmp(value, "csv") == 0)
+                    options->outputFormat = BATCH_OUTPUT_CSV;
+                else if (strcmp(value, "bin") == 0)
+                    options->outputFormat = BATCH_OUTPUT_BIN;
+                else
+                    isValid = false;
+            } else if (strcmp(arg, "--threads") == 0) {
+                options->threadCount = atoi(value);
+            } else if (strcmp(arg, "--scale") == 0) {
+                isValid = ParseVector3(value, &options->scale);
+            } else if (strcmp(arg, "--trans") == 0) {
+                isValid = ParseVector3(value, &options->trans);
+            } else if (strcmp(arg, "--rotate") == 0) {
+                isValid = ParseVector3(value, &options->rotate);
+            } else if (strcmp(arg, "--eye") == 0) {
+                isValid = ParseVector3(value, &options->eye);
+            } else if (strcmp(arg, "--at") == 0) {
+                isValid = ParseVector3(value, &options->at);
+            } else if (strcmp(arg, "--up") == 0) {
+                isValid = ParseVector3(value, &options->up);
+            } else if (strcmp(arg, "--fov") == 0) {
+                options->fov = Clamp(strtof(value, NULL),
+                                     CAMERA_FOV_MIN_VALUE,
+                                     CAMERA_FOV_MAX_VALUE);
+            } else if (strcmp(arg, "--near") == 0) {
+                options->nearDistance = strtof(value, NULL);
+            } else if (strcmp(arg, "--far") == 0) {
+                options->farDistance = strtof(value, NULL);
+            } else if (strcmp(arg, "--size") == 0) {
+                isValid = sscanf(value,
+                                 "%dx%d",
+                                 &options->screenWidth,
+                                 &options->screenHeight)
+                          == 2;
+            } else {
+                isValid = false;
+            }
+
+            if (!isValid) {
+                fprintf(stderr,
+                        BATCH_LOG_PREFIX "Invalid option: %s %s\n",
+                        arg,
+                        value);
+
+                return false;
+            }
+        } else if (options->inputPath == NULL) {
+            options->inputPath = arg;
+
+            // 확장자가 `.obj`라면 OBJ 파일로 간주
+            const char *extension = strrchr(arg, '.');
+
+            if (extension != NULL && strcmp(extension, ".obj") == 0)
+                options->inputFormat = BATCH_INPUT_OBJ;
+        } else if (options->outputPath == NULL) {
+            options->outputPath = arg;
+        } else {
+            return false;
+        }
+    }
+
+    if (options->threadCount <= 0) {
+#ifdef _SC_NPROCESSORS_ONLN
+        options->threadCount = (int) sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+        if (options->threadCount <= 0) options->threadCount = 1;
+    }
+
+    if (options->threadCount > BATCH_MAX_THREAD_COUNT)
+        options->threadCount = BATCH_MAX_THREAD_COUNT;
+
+    return options->inputPath != NULL && options->screenWidth > 0
+           && options->screenHeight > 0
+           && options->nearDistance < options->farDistance;
+}
+
+/* `x,y,z` 형식의 문자열을 해석하는 함수 */
+static bool ParseVector3(const char *text, Vector3 *result) {
+    return sscanf(text, "%f,%f,%f", &result->x, &result->y, &result->z) == 3;
+}
+
+/* 사용 방법을 출력하는 함수 */
+static void PrintUsage(const char *programName) {
+    fprintf(stderr,
+            "Usage: %s [options] <input.bin | input.obj> [output]\n"
+            "\n"
+            "Options:\n"
+            "  --input-format <bin | obj>   input format (default: by ext.)\n"
+            "  --output-format <csv | bin>  output format (default: csv)\n"
+            "  --threads <n>                worker threads (default: all)\n"
+            "  --scale <x,y,z>              model scale\n"
+            "  --trans <x,y,z>              model translation\n"
+            "  --rotate <x,y,z>             model rotation (degrees)\n"
+            "  --eye <x,y,z>                view eye position\n"
+            "  --at <x,y,z>                 view target position\n"
+            "  --up <x,y,z>                 view up vector\n"
+            "  --fov <degrees>              projection fov\n"
+            "  --near <d>, --far <d>        projection near/far distance\n"
+            "  --size <w>x<h>               viewport size (screen coords)\n"
+            "\n"
+            "Each output row is: clip.x, clip.y, clip.z, clip.w, "
+            "ndc.x, ndc.y, ndc.z, screen.x, screen.y\n",
+            programName);
+}
+
+/* 작업 스레드에서 입력 데이터의 범위를 처리하는 함수 */
+static void *ProcessJob(void *arg) {
+    BatchJob *job = arg;
+
+    job->failed = false;
+
+    if (inputFormat == BATCH_INPUT_BIN) {
+        for (const unsigned char *ptr = job->begin;
+             ptr + 3 * sizeof(float) <= job->end && !job->failed;
+             ptr += 3 * sizeof(float)) {
+            float position[3];
+
+            memcpy(position, ptr, sizeof position);
+
+            EmitVertex(job, position[0], position[1], position[2]);
+        }
+    } else {
+        char line[256];
+
+        const unsigned char *ptr = job->begin;
+
+        while (ptr < job->end && !job->failed) {
+            const unsigned char *lineEnd = memchr(ptr,
+                                                  '\n',
+                                                  (size_t) (job->end - ptr));
+
+            if (lineEnd == NULL) lineEnd = job->end;
+
+            size_t lineLength = (size_t) (lineEnd - ptr);
+
+            // NOTE: `strtof()`가 입력 데이터의 끝을 넘어가지 않도록 줄을 복사
+            if (lineLength >= 2 && ptr[0] == 'v'
+                && (ptr[1] == ' ' || ptr[1] == '\t')
+                && lineLength < sizeof line) {
+                memcpy(line, ptr + 2, lineLength - 2);
+
+                line[lineLength - 2] = '\0';
+
+                char *next = line;
+
+                float x = strtof(next, &next);
+                float y = strtof(next, &next);
+                float z = strtof(next, &next);
+
+                EmitVertex(job, x, y, z);
+            }
+
+            ptr = lineEnd + 1;
+        }
+    }
+
+    return NULL;
+}
+
+/* `job`의 출력 데이터 버퍼에 `size` 바이트 이상의 공간을 확보하는 함수 */
+static bool ReserveJobOutput(BatchJob *job, size_t size) {
+    if (job->outputSize + size <= job->outputCapacity) return true;
+
+    size_t newCapacity = (job->outputCapacity > 0) ? job->outputCapacity
+                                                   : (1024 * 1024);
+
+    while (newCapacity < job->outputSize + size)
+        newCapacity *= 2;
+
+    unsigned char *newOutput = realloc(job->output, newCapacity);
+
+    if (newOutput == NULL) return false;
+
+    job->output = newOutput, job->outputCapacity = newCapacity;
+
+    return true;
+}
+
+/* 메모리에 올린 입력 파일의 영역을 해제하는 함수 */
+static void UnmapFileWindow(BatchWindow *window) {
+    if (window->base == NULL) return;
+
+#ifndef _WIN32
+    munmap(window->base, window->baseSize);
+#else
+    free(window->base);
+#endif
+
+    window->base = NULL;
+}
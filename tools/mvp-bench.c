@@ -0,0 +1,549 @@
+/*
+    Copyright (c) 2024 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ================================================================ */
+
+#include "mvp-demo.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Macro Constants ========================================================= */
+
+// clang-format off
+
+#define BENCH_LOG_PREFIX                    "MVP-BENCH: "
+
+/* 각 벤치마크를 반복할 횟수 (가장 빠른 결과를 사용) */
+#define BENCH_RUN_COUNT                     20
+
+/* 문자열로 변환할 `float` 값의 개수 */
+#define BENCH_FORMAT_VALUE_COUNT            (1 << 18)
+
+/* "모델 행렬"을 계산할 물체의 개수 */
+#define BENCH_TRS_OBJECT_COUNT              4096
+
+/* 화면에 배치할 문자열 상자의 개수 */
+#define BENCH_LABEL_COUNT                   10000
+
+/* 문자열 상자를 배치할 화면의 가로 및 세로 크기 */
+#define BENCH_LABEL_SCREEN_WIDTH            1920
+#define BENCH_LABEL_SCREEN_HEIGHT           1080
+
+/* 문자열 상자 하나의 가로 및 세로 크기 */
+#define BENCH_LABEL_WIDTH                   110.0f
+#define BENCH_LABEL_HEIGHT                  16.0f
+
+/* 문자열 상자 배치를 반복할 횟수 (한 번의 실행 시간이 짧아 더 많이 반복) */
+#define BENCH_LABEL_RUN_COUNT               200
+
+/* 문자열 상자 배치에 주어진 시간 (나노초) */
+#define BENCH_LABEL_BUDGET                  1e6
+
+// clang-format on
+
+/* Typedefs ================================================================ */
+
+/* 물체 하나의 크기, 회전과 이동 변환 */
+typedef struct BenchTransform_ {
+    Vector3 translation;  // 이동 변환
+    Quaternion rotation;  // 회전 변환 (사원수)
+    Vector3 angle;        // 회전 변환 (오일러 각, 라디안)
+    Vector3 scale;        // 크기 변환
+} BenchTransform;
+
+/* 벤치마크 하나 */
+typedef struct BenchCase_ {
+    const char *name;         // 벤치마크의 이름
+    const char *description;  // 벤치마크의 설명
+    void (*func)(void);       // 벤치마크를 실행하는 함수
+} BenchCase;
+
+/* Private Function Prototypes ============================================= */
+
+/* 두 행렬의 각 요소의 차이 중 가장 큰 값을 반환하는 함수 */
+static float GetMaxMatrixError(Matrix left, Matrix right);
+
+/* 현재 시간을 나노초 단위로 반환하는 함수 */
+static double GetTimeNanoseconds(void);
+
+/* `min` 이상 `max` 이하의 의사 난수를 반환하는 함수 */
+static float NextRandomFloat(float min, float max);
+
+/* 다음 의사 난수를 반환하는 함수 (xorshift32) */
+static uint32_t NextRandomValue(void);
+
+/* 사용 방법을 출력하는 함수 */
+static void PrintUsage(const char *programName);
+
+/* 실수 문자열 변환 함수를 `snprintf()`와 비교하는 함수 */
+static void RunFormatBench(void);
+
+/* 문자열 상자 배치에 걸리는 시간을 측정하는 함수 */
+static void RunLabelBench(void);
+
+/* 크기, 회전과 이동 변환 합성 함수를 행렬 곱셈과 비교하는 함수 */
+static void RunTrsBench(void);
+
+/* Private Variables ======================================================= */
+
+/* 벤치마크 목록 */
+static const BenchCase benchCases[] = {
+    { .name = "format",
+      .description = "FormatFixedFloat() vs. snprintf(\"%.*f\")",
+      .func = RunFormatBench },
+    { .name = "label",
+      .description = "EndLabelLayout() with 10^4 candidates on 1920x1080",
+      .func = RunLabelBench },
+    { .name = "trs",
+      .description = "ComposeTRSMat() vs. chained MatrixMultiply()",
+      .func = RunTrsBench }
+};
+
+/* 의사 난수 생성기의 상태 (항상 같은 입력을 만들도록 고정된 시드 사용) */
+static uint32_t randomState = 0x2545F491U;
+
+/* 컴파일러가 벤치마크 코드를 제거하지 못하도록 결과를 모아 놓는 변수 */
+static volatile unsigned int benchSink;
+
+/* Public Functions ======================================================== */
+
+int main(int argc, char *argv[]) {
+    const int benchCaseCount = sizeof benchCases / sizeof *benchCases;
+
+    // 벤치마크 이름이 없다면, 모든 벤치마크를 실행
+    if (argc < 2) {
+        for (int i = 0; i < benchCaseCount; i++) benchCases[i].func();
+
+        return 0;
+    }
+
+    for (int i = 1; i < argc; i++) {
+        int caseIndex = -1;
+
+        for (int j = 0; j < benchCaseCount; j++)
+            if (strcmp(argv[i], benchCases[j].name) == 0) caseIndex = j;
+
+        if (caseIndex < 0) {
+            fprintf(stderr,
+                    BENCH_LOG_PREFIX "Unknown benchmark '%s'\n",
+                    argv[i]);
+
+            PrintUsage(argv[0]);
+
+            return 1;
+        }
+
+        benchCases[caseIndex].func();
+    }
+
+    return 0;
+}
+
+/* Private Functions ======================================================= */
+
+/* 두 행렬의 각 요소의 차이 중 가장 큰 값을 반환하는 함수 */
+static float GetMaxMatrixError(Matrix left, Matrix right) {
+    float16 leftValues = MatrixToFloatV(left);
+    float16 rightValues = MatrixToFloatV(right);
+
+    float result = 0.0f;
+
+    for (int i = 0; i < 16; i++) {
+        float error = fabsf(leftValues.v[i] - rightValues.v[i]);
+
+        if (result < error) result = error;
+    }
+
+    return result;
+}
+
+/* 현재 시간을 나노초 단위로 반환하는 함수 */
+static double GetTimeNanoseconds(void) {
+    struct timespec currentTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &currentTime);
+
+    return (1e9 * currentTime.tv_sec) + currentTime.tv_nsec;
+}
+
+/* `min` 이상 `max` 이하의 의사 난수를 반환하는 함수 */
+static float NextRandomFloat(float min, float max) {
+    return min + (max - min) * ((NextRandomValue() >> 8) / 16777215.0f);
+}
+
+/* 다음 의사 난수를 반환하는 함수 (xorshift32) */
+static uint32_t NextRandomValue(void) {
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+
+    return randomState;
+}
+
+/* 사용 방법을 출력하는 함수 */
+static void PrintUsage(const char *programName) {
+    fprintf(stderr, "Usage: %s [benchmark...]\n\n", programName);
+
+    for (int i = 0; i < (int) (sizeof benchCases / sizeof *benchCases); i++)
+        fprintf(stderr,
+                "  %-10s %s\n",
+                benchCases[i].name,
+                benchCases[i].description);
+}
+
+/* 실수 문자열 변환 함수를 `snprintf()`와 비교하는 함수 */
+static void RunFormatBench(void) {
+    float *values = malloc(BENCH_FORMAT_VALUE_COUNT * sizeof *values);
+
+    if (values == NULL) return;
+
+    // NOTE: 행렬의 각 요소와 비슷한 범위의 값을 사용
+    for (int i = 0; i < BENCH_FORMAT_VALUE_COUNT; i++)
+        values[i] = NextRandomFloat(-1000.0f, 1000.0f);
+
+    printf(BENCH_LOG_PREFIX "format: %d values, best of %d runs\n",
+           BENCH_FORMAT_VALUE_COUNT,
+           BENCH_RUN_COUNT);
+
+    for (int precision = 0; precision <= 3; precision++) {
+        char fixedBuffer[MATRIX_VALUE_TEXT_LENGTH];
+        char libcBuffer[MATRIX_VALUE_TEXT_LENGTH];
+
+        int mismatchCount = 0;
+
+        // 두 함수의 결과가 같은지 먼저 확인
+        for (int i = 0; i < BENCH_FORMAT_VALUE_COUNT; i++) {
+            FormatFixedFloat(fixedBuffer,
+                             sizeof fixedBuffer,
+                             values[i],
+                             precision);
+
+            snprintf(libcBuffer,
+                     sizeof libcBuffer,
+                     "%.*f",
+                     precision,
+                     values[i]);
+
+            mismatchCount += (strcmp(fixedBuffer, libcBuffer) != 0);
+        }
+
+        double fixedTime = 0.0, libcTime = 0.0;
+
+        for (int run = 0; run < BENCH_RUN_COUNT; run++) {
+            double startTime = GetTimeNanoseconds();
+
+            for (int i = 0; i < BENCH_FORMAT_VALUE_COUNT; i++)
+                benchSink += FormatFixedFloat(fixedBuffer,
+                                              sizeof fixedBuffer,
+                                              values[i],
+                                              precision);
+
+            double middleTime = GetTimeNanoseconds();
+
+            for (int i = 0; i < BENCH_FORMAT_VALUE_COUNT; i++)
+                benchSink += snprintf(libcBuffer,
+                                      sizeof libcBuffer,
+                                      "%.*f",
+                                      precision,
+                                      values[i]);
+
+            double endTime = GetTimeNanoseconds();
+
+            if (run == 0 || fixedTime > middleTime - startTime)
+                fixedTime = middleTime - startTime;
+
+            if (run == 0 || libcTime > endTime - middleTime)
+                libcTime = endTime - middleTime;
+        }
+
+        printf(BENCH_LOG_PREFIX
+               "  %%.%df: %6.1f ns vs. %6.1f ns per value (%.1fx), "
+               "%d mismatches\n",
+               precision,
+               fixedTime / BENCH_FORMAT_VALUE_COUNT,
+               libcTime / BENCH_FORMAT_VALUE_COUNT,
+               libcTime / fixedTime,
+               mismatchCount);
+    }
+
+    free(values);
+}
+
+/* 문자열 상자 배치에 걸리는 시간을 측정하는 함수 */
+static void RunLabelBench(void) {
+    LabelLayout *layout = LoadLabelLayout(BENCH_LABEL_COUNT);
+
+    Vector2 *anchors = malloc(BENCH_LABEL_COUNT * sizeof *anchors);
+    Vector2 *positions = malloc(BENCH_LABEL_COUNT * sizeof *positions);
+    float *depths = malloc(BENCH_LABEL_COUNT * sizeof *depths);
+
+    if (layout == NULL || anchors == NULL || positions == NULL
+        || depths == NULL) {
+        UnloadLabelLayout(layout);
+
+        free(anchors), free(positions), free(depths);
+
+        return;
+    }
+
+    // NOTE: 일부 정점은 화면 밖에 투영되도록, 화면보다 조금 넓은 범위를 사용
+    for (int i = 0; i < BENCH_LABEL_COUNT; i++) {
+        anchors[i] = (Vector2) {
+            .x = NextRandomFloat(-0.05f, 1.05f) * BENCH_LABEL_SCREEN_WIDTH,
+            .y = NextRandomFloat(-0.05f, 1.05f) * BENCH_LABEL_SCREEN_HEIGHT
+        };
+
+        depths[i] = NextRandomFloat(0.1f, 100.0f);
+    }
+
+    const Vector2 size = { .x = BENCH_LABEL_WIDTH, .y = BENCH_LABEL_HEIGHT };
+
+    double bestTime = 0.0;
+
+    for (int run = 0; run < BENCH_LABEL_RUN_COUNT; run++) {
+        double startTime = GetTimeNanoseconds();
+
+        BeginLabelLayout(layout,
+                         BENCH_LABEL_SCREEN_WIDTH,
+                         BENCH_LABEL_SCREEN_HEIGHT);
+
+        for (int i = 0; i < BENCH_LABEL_COUNT; i++)
+            AddLabelCandidate(layout, anchors[i], size, 12.0f, depths[i]);
+
+        EndLabelLayout(layout);
+
+        double endTime = GetTimeNanoseconds();
+
+        if (run == 0 || bestTime > endTime - startTime)
+            bestTime = endTime - startTime;
+    }
+
+    int placedCount = 0, overlapCount = 0;
+
+    for (int i = 0; i < BENCH_LABEL_COUNT; i++)
+        if (GetLabelPosition(layout, i, &positions[placedCount]))
+            placedCount++;
+
+    // 배치된 문자열 상자가 서로 겹치지 않는지 확인
+    for (int i = 0; i < placedCount; i++)
+        for (int j = i + 1; j < placedCount; j++)
+            overlapCount += (fabsf(positions[i].x - positions[j].x)
+                                 < BENCH_LABEL_WIDTH
+                             && fabsf(positions[i].y - positions[j].y)
+                                    < BENCH_LABEL_HEIGHT);
+
+    benchSink += placedCount;
+
+    printf(BENCH_LOG_PREFIX "label: %d candidates, best of %d runs\n",
+           BENCH_LABEL_COUNT,
+           BENCH_LABEL_RUN_COUNT);
+
+    printf(BENCH_LOG_PREFIX
+           "  layout: %.3f ms (budget %.3f ms), %d placed, %d overlaps\n",
+           bestTime / 1e6,
+           BENCH_LABEL_BUDGET / 1e6,
+           placedCount,
+           overlapCount);
+
+    UnloadLabelLayout(layout);
+
+    free(anchors), free(positions), free(depths);
+}
+
+/* 크기, 회전과 이동 변환 합성 함수를 행렬 곱셈과 비교하는 함수 */
+static void RunTrsBench(void) {
+    BenchTransform *transforms = malloc(BENCH_TRS_OBJECT_COUNT
+                                        * sizeof *transforms);
+
+    Vector3 *translations = malloc(BENCH_TRS_OBJECT_COUNT
+                                   * sizeof *translations);
+    Quaternion *rotations = malloc(BENCH_TRS_OBJECT_COUNT * sizeof *rotations);
+    Vector3 *scales = malloc(BENCH_TRS_OBJECT_COUNT * sizeof *scales);
+
+    Matrix *results = malloc(BENCH_TRS_OBJECT_COUNT * sizeof *results);
+
+    if (transforms == NULL || translations == NULL || rotations == NULL
+        || scales == NULL || results == NULL) {
+        free(transforms), free(translations), free(rotations);
+
+        free(scales), free(results);
+
+        return;
+    }
+
+    for (int i = 0; i < BENCH_TRS_OBJECT_COUNT; i++) {
+        BenchTransform *transform = &transforms[i];
+
+        transform->translation = (Vector3) {
+            .x = NextRandomFloat(-100.0f, 100.0f),
+            .y = NextRandomFloat(-100.0f, 100.0f),
+            .z = NextRandomFloat(-100.0f, 100.0f)
+        };
+
+        transform->angle = (Vector3) { .x = NextRandomFloat(-PI, PI),
+                                       .y = NextRandomFloat(-PI, PI),
+                                       .z = NextRandomFloat(-PI, PI) };
+
+        transform->rotation = QuaternionFromMatrix(
+            MatrixRotateXYZ(transform->angle));
+
+        transform->scale = (Vector3) { .x = NextRandomFloat(0.1f, 4.0f),
+                                       .y = NextRandomFloat(0.1f, 4.0f),
+                                       .z = NextRandomFloat(0.1f, 4.0f) };
+
+        translations[i] = transform->translation;
+        rotations[i] = transform->rotation;
+        scales[i] = transform->scale;
+    }
+
+    printf(BENCH_LOG_PREFIX "trs: %d objects, best of %d runs\n",
+           BENCH_TRS_OBJECT_COUNT,
+           BENCH_RUN_COUNT);
+
+    float maxQuatError = 0.0f, maxEulerError = 0.0f;
+
+    // 두 방법의 결과가 같은지 먼저 확인
+    for (int i = 0; i < BENCH_TRS_OBJECT_COUNT; i++) {
+        const BenchTransform *transform = &transforms[i];
+
+        Matrix scaleMat = MatrixScale(transform->scale.x,
+                                      transform->scale.y,
+                                      transform->scale.z);
+        Matrix transMat = MatrixTranslate(transform->translation.x,
+                                          transform->translation.y,
+                                          transform->translation.z);
+
+        float quatError = GetMaxMatrixError(
+            MatrixMultiply(MatrixMultiply(scaleMat,
+                                          QuaternionToMatrix(
+                                              transform->rotation)),
+                           transMat),
+            ComposeTRSMat(transform->translation,
+                          transform->rotation,
+                          transform->scale));
+
+        float eulerError = GetMaxMatrixError(
+            MatrixMultiply(MatrixMultiply(scaleMat,
+                                          MatrixRotateXYZ(transform->angle)),
+                           transMat),
+            ComposeEulerTRSMat(transform->translation,
+                               transform->angle,
+                               transform->scale));
+
+        if (maxQuatError < quatError) maxQuatError = quatError;
+        if (maxEulerError < eulerError) maxEulerError = eulerError;
+    }
+
+    double bestTimes[5] = { 0.0 };
+
+    for (int run = 0; run < BENCH_RUN_COUNT; run++) {
+        double times[6] = { GetTimeNanoseconds() };
+
+        // 이전 방법: S * R (사원수) * T
+        for (int i = 0; i < BENCH_TRS_OBJECT_COUNT; i++) {
+            const BenchTransform *transform = &transforms[i];
+
+            results[i] = MatrixMultiply(
+                MatrixMultiply(MatrixScale(transform->scale.x,
+                                           transform->scale.y,
+                                           transform->scale.z),
+                               QuaternionToMatrix(transform->rotation)),
+                MatrixTranslate(transform->translation.x,
+                                transform->translation.y,
+                                transform->translation.z));
+        }
+
+        times[1] = GetTimeNanoseconds();
+
+        for (int i = 0; i < BENCH_TRS_OBJECT_COUNT; i++)
+            results[i] = ComposeTRSMat(transforms[i].translation,
+                                       transforms[i].rotation,
+                                       transforms[i].scale);
+
+        times[2] = GetTimeNanoseconds();
+
+        ComposeTRSMats(results,
+                       translations,
+                       rotations,
+                       scales,
+                       BENCH_TRS_OBJECT_COUNT);
+
+        times[3] = GetTimeNanoseconds();
+
+        // 이전 방법: S * R (오일러 각) * T
+        for (int i = 0; i < BENCH_TRS_OBJECT_COUNT; i++) {
+            const BenchTransform *transform = &transforms[i];
+
+            results[i] = MatrixMultiply(
+                MatrixMultiply(MatrixScale(transform->scale.x,
+                                           transform->scale.y,
+                                           transform->scale.z),
+                               MatrixRotateXYZ(transform->angle)),
+                MatrixTranslate(transform->translation.x,
+                                transform->translation.y,
+                                transform->translation.z));
+        }
+
+        times[4] = GetTimeNanoseconds();
+
+        for (int i = 0; i < BENCH_TRS_OBJECT_COUNT; i++)
+            results[i] = ComposeEulerTRSMat(transforms[i].translation,
+                                            transforms[i].angle,
+                                            transforms[i].scale);
+
+        times[5] = GetTimeNanoseconds();
+
+        benchSink += (unsigned int) results[BENCH_TRS_OBJECT_COUNT - 1].m12;
+
+        for (int i = 0; i < 5; i++)
+            if (run == 0 || bestTimes[i] > times[i + 1] - times[i])
+                bestTimes[i] = times[i + 1] - times[i];
+    }
+
+    for (int i = 0; i < 5; i++) bestTimes[i] /= BENCH_TRS_OBJECT_COUNT;
+
+    printf(BENCH_LOG_PREFIX
+           "  quaternion: %6.1f ns vs. %6.1f ns per object (%.1fx), "
+           "batch %.1f ns, max error %g\n",
+           bestTimes[1],
+           bestTimes[0],
+           bestTimes[0] / bestTimes[1],
+           bestTimes[2],
+           maxQuatError);
+
+    printf(BENCH_LOG_PREFIX
+           "  euler:      %6.1f ns vs. %6.1f ns per object (%.1fx), "
+           "max error %g\n",
+           bestTimes[4],
+           bestTimes[3],
+           bestTimes[3] / bestTimes[4],
+           maxEulerError);
+
+    free(transforms), free(translations), free(rotations);
+
+    free(scales), free(results);
+}
@@ -0,0 +1,422 @@
+/*
+    Copyright (c) 2024 Jaedeok Kim <jdeokkim@protonmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Includes ================================================================ */
+
+#include "mvp-demo.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Macro Constants ========================================================= */
+
+// clang-format off
+
+#define PACK_LOG_PREFIX                     "MVP-PACK: "
+
+/* LZ4 블록 형식에서 길이 필드의 최댓값 */
+#define LZ4_LENGTH_MASK                     15
+
+/* LZ4 블록 형식에서 일치하는 문자열의 최소 길이 */
+#define LZ4_MIN_MATCH_LENGTH                4
+
+/* LZ4 블록 형식에서 마지막 일치 부분이 끝나야 하는 위치 (블록의 끝 기준) */
+#define LZ4_LAST_LITERALS                   5
+
+/* LZ4 블록 형식에서 마지막 일치 부분이 시작해야 하는 위치 (블록의 끝 기준) */
+#define LZ4_MF_LIMIT                        12
+
+/* LZ4 블록 형식에서 앞에서 찾을 수 있는 문자열의 최대 거리 */
+#define LZ4_MAX_DISTANCE                    65535
+
+/* 일치하는 문자열을 찾을 때 사용할 해시 테이블의 크기 (2의 거듭제곱) */
+#define LZ4_HASH_LOG                        16
+
+/* 일치하는 문자열을 찾을 때 확인할 위치의 최대 개수 */
+#define LZ4_MAX_CHAIN_DEPTH                 4096
+
+/* 이미지 블롭 헤더의 크기 (바이트) */
+#define IMAGE_BLOB_HEADER_SIZE              24
+
+/* 출력 파일의 한 줄에 쓸 바이트의 개수 */
+#define PACK_BYTES_PER_LINE                 12
+
+// clang-format on
+
+/* Private Function Prototypes ============================================= */
+
+/* `data`를 LZ4 블록 형식으로 압축하고, 압축된 크기를 반환하는 함수 */
+static int CompressBlobData(const unsigned char *data,
+                            int dataSize,
+                            unsigned char *packedData,
+                            int packedCapacity);
+
+/* LZ4 블록 형식의 시퀀스 하나를 출력하는 함수 */
+static int EmitLz4Sequence(unsigned char *op,
+                           unsigned char *opEnd,
+                           const unsigned char *literals,
+                           int literalLength,
+                           int offset,
+                           int matchLength);
+
+/* LZ4 블록 형식의 가변 길이 필드를 출력하는 함수 */
+static unsigned char *EmitLz4Length(unsigned char *op,
+                                    unsigned char *opEnd,
+                                    int length);
+
+/* 연속된 4바이트의 해시 값을 계산하는 함수 */
+static int HashLz4Sequence(const unsigned char *bytes);
+
+/* 사용 방법을 출력하는 함수 */
+static void PrintUsage(const char *programName);
+
+/* 32비트 정수를 리틀 엔디언으로 저장하는 함수 */
+static void WriteUInt32LE(unsigned char *bytes, unsigned int value);
+
+/* Public Functions ======================================================== */
+
+int main(int argc, char *argv[]) {
+    if (argc < 4 || argc > 5) {
+        PrintUsage(argv[0]);
+
+        return 1;
+    }
+
+    const char *inputPath = argv[1], *outputPath = argv[2];
+
+    const char *arrayName = argv[3], *sourceNote = (argc > 4) ? argv[4] : NULL;
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    // NOTE: 이미지는 원래 픽셀 형식 그대로 저장하며, 압축만 해제하면 바로 업로드 가능
+    Image image = LoadImage(inputPath);
+
+    if (image.data == NULL
+        || image.format > PIXELFORMAT_UNCOMPRESSED_R32G32B32A32) {
+        fprintf(stderr,
+                PACK_LOG_PREFIX "Failed to load image: %s\n",
+                inputPath);
+
+        UnloadImage(image);
+
+        return 1;
+    }
+
+    int dataSize = GetPixelDataSize(image.width, image.height, image.format);
+
+    // LZ4 블록 형식에서 압축된 데이터의 최대 크기
+    int packedCapacity = dataSize + (dataSize / 255) + 16;
+
+    unsigned char *blob = malloc(IMAGE_BLOB_HEADER_SIZE + packedCapacity);
+
+    unsigned char *unpackedData = malloc(dataSize);
+
+    int packedSize = -1;
+
+    if (blob != NULL && unpackedData != NULL)
+        packedSize = CompressBlobData(image.data,
+                                      dataSize,
+                                      blob + IMAGE_BLOB_HEADER_SIZE,
+                                      packedCapacity);
+
+    // 압축한 데이터를 프로그램과 같은 방법으로 다시 풀어서 확인
+    if (packedSize < 0
+        || DecompressBlobData(blob + IMAGE_BLOB_HEADER_SIZE,
+                              packedSize,
+                              unpackedData,
+                              dataSize)
+               != dataSize
+        || memcmp(unpackedData, image.data, dataSize) != 0) {
+        fprintf(stderr, PACK_LOG_PREFIX "Failed to compress image data\n");
+
+        free(blob), free(unpackedData), UnloadImage(image);
+
+        return 1;
+    }
+
+    free(unpackedData);
+
+    {
+        /* 이미지 블롭의 헤더 작성 */
+
+        memcpy(blob, IMAGE_BLOB_MAGIC, 4);
+
+        WriteUInt32LE(blob + 4, image.width);
+        WriteUInt32LE(blob + 8, image.height);
+        WriteUInt32LE(blob + 12, image.format);
+        WriteUInt32LE(blob + 16, dataSize);
+        WriteUInt32LE(blob + 20, packedSize);
+    }
+
+    int blobSize = IMAGE_BLOB_HEADER_SIZE + packedSize;
+
+    FILE *output = fopen(outputPath, "wb");
+
+    if (output == NULL) {
+        fprintf(stderr,
+                PACK_LOG_PREFIX "Failed to open output file: %s\n",
+                outputPath);
+
+        free(blob), UnloadImage(image);
+
+        return 1;
+    }
+
+    {
+        /* 이미지 블롭을 C 언어의 배열로 출력 */
+
+        fprintf(output,
+                "/*\n"
+                "    Generated by `mvp-pack` from `%s`\n"
+                "    (%dx%d, pixel format %d, %d -> %d bytes, LZ4)\n",
+                inputPath,
+                image.width,
+                image.height,
+                image.format,
+                dataSize,
+                packedSize);
+
+        if (sourceNote != NULL) fprintf(output, "\n    %s\n", sourceNote);
+
+        fprintf(output,
+                "*/\n"
+                "\n"
+                "static const unsigned char %s[] = {\n",
+                arrayName);
+
+        for (int i = 0; i < blobSize; i++) {
+            bool isLineStart = (i % PACK_BYTES_PER_LINE) == 0;
+            bool isLineEnd = ((i + 1) % PACK_BYTES_PER_LINE) == 0
+                             || (i + 1) == blobSize;
+
+            fprintf(output,
+                    "%s0x%02x%s",
+                    isLineStart ? "  " : "",
+                    blob[i],
+                    ((i + 1) == blobSize) ? "\n" : (isLineEnd ? ",\n" : ", "));
+        }
+
+        fprintf(output,
+                "};\n"
+                "\n"
+                "static const unsigned int %sLength = %d;\n",
+                arrayName,
+                blobSize);
+    }
+
+    bool result = (fclose(output) == 0);
+
+    if (result)
+        fprintf(stderr,
+                PACK_LOG_PREFIX "%s: %d -> %d bytes\n",
+                outputPath,
+                dataSize,
+                blobSize);
+
+    free(blob), UnloadImage(image);
+
+    return result ? 0 : 1;
+}
+
+/* Private Functions ======================================================= */
+
+/* `data`를 LZ4 블록 형식으로 압축하고, 압축된 크기를 반환하는 함수 */
+static int CompressBlobData(const unsigned char *data,
+                            int dataSize,
+                            unsigned char *packedData,
+                            int packedCapacity) {
+    /*
+        NOTE: 리소스를 빌드할 때 한 번만 실행되므로, 압축 속도보다 압축률을 위해
+        같은 해시 값을 가진 위치들을 모두 연결해 두고 가장 긴 문자열을 찾음
+    */
+
+    static int hashHeads[1 << LZ4_HASH_LOG];
+
+    int *hashChain = malloc((dataSize > 0 ? dataSize : 1) * sizeof *hashChain);
+
+    if (hashChain == NULL) return -1;
+
+    for (int i = 0; i < (1 << LZ4_HASH_LOG); i++)
+        hashHeads[i] = -1;
+
+    unsigned char *op = packedData, *opEnd = packedData + packedCapacity;
+
+    int anchor = 0, ip = 0, nextInsert = 0;
+
+    // NOTE: 마지막 몇 바이트는 항상 문자열 그대로 저장해야 함
+    int matchLimit = dataSize - LZ4_LAST_LITERALS;
+
+    while (ip < dataSize - LZ4_MF_LIMIT) {
+        // 현재 위치까지의 모든 위치를 해시 체인에 추가
+        for (; nextInsert < ip; nextInsert++) {
+            int hash = HashLz4Sequence(data + nextInsert);
+
+            hashChain[nextInsert] = hashHeads[hash];
+            hashHeads[hash] = nextInsert;
+        }
+
+        int matchLength = 0, matchOffset = 0;
+
+        int ref = hashHeads[HashLz4Sequence(data + ip)];
+
+        for (int depth = 0;
+             ref >= 0 && ip - ref <= LZ4_MAX_DISTANCE
+             && depth < LZ4_MAX_CHAIN_DEPTH;
+             ref = hashChain[ref], depth++) {
+            int length = 0;
+
+            while (ip + length < matchLimit
+                   && data[ref + length] == data[ip + length])
+                length++;
+
+            if (length >= LZ4_MIN_MATCH_LENGTH && length > matchLength)
+                matchLength = length, matchOffset = ip - ref;
+        }
+
+        if (matchLength == 0) {
+            ip++;
+
+            continue;
+        }
+
+        int sequenceSize = EmitLz4Sequence(op,
+                                           opEnd,
+                                           data + anchor,
+                                           ip - anchor,
+                                           matchOffset,
+                                           matchLength);
+
+        if (sequenceSize < 0) {
+            free(hashChain);
+
+            return -1;
+        }
+
+        op += sequenceSize, ip += matchLength, anchor = ip;
+    }
+
+    free(hashChain);
+
+    // 마지막 시퀀스는 문자열만으로 끝남
+    int sequenceSize = EmitLz4Sequence(op,
+                                       opEnd,
+                                       data + anchor,
+                                       dataSize - anchor,
+                                       0,
+                                       0);
+
+    if (sequenceSize < 0) return -1;
+
+    op += sequenceSize;
+
+    return (int) (op - packedData);
+}
+
+/* LZ4 블록 형식의 시퀀스 하나를 출력하는 함수 */
+static int EmitLz4Sequence(unsigned char *op,
+                           unsigned char *opEnd,
+                           const unsigned char *literals,
+                           int literalLength,
+                           int offset,
+                           int matchLength) {
+    unsigned char *opBegin = op, *token = op++;
+
+    if (token >= opEnd) return -1;
+
+    // NOTE: `offset`이 0이면, 문자열만 있는 마지막 시퀀스
+    int matchField = (offset > 0) ? (matchLength - LZ4_MIN_MATCH_LENGTH) : 0;
+
+    *token = ((literalLength < LZ4_LENGTH_MASK) ? literalLength
+                                                : LZ4_LENGTH_MASK)
+             << 4;
+
+    if (literalLength >= LZ4_LENGTH_MASK) {
+        op = EmitLz4Length(op, opEnd, literalLength - LZ4_LENGTH_MASK);
+
+        if (op == NULL) return -1;
+    }
+
+    if (literalLength > opEnd - op) return -1;
+
+    memcpy(op, literals, literalLength), op += literalLength;
+
+    if (offset <= 0) return (int) (op - opBegin);
+
+    if (opEnd - op < 2) return -1;
+
+    *op++ = offset & 0xff, *op++ = (offset >> 8) & 0xff;
+
+    *token |= (matchField < LZ4_LENGTH_MASK) ? matchField : LZ4_LENGTH_MASK;
+
+    if (matchField >= LZ4_LENGTH_MASK) {
+        op = EmitLz4Length(op, opEnd, matchField - LZ4_LENGTH_MASK);
+
+        if (op == NULL) return -1;
+    }
+
+    return (int) (op - opBegin);
+}
+
+/* LZ4 블록 형식의 가변 길이 필드를 출력하는 함수 */
+static unsigned char *EmitLz4Length(unsigned char *op,
+                                    unsigned char *opEnd,
+                                    int length) {
+    for (; length >= 255; length -= 255) {
+        if (op >= opEnd) return NULL;
+
+        *op++ = 255;
+    }
+
+    if (op >= opEnd) return NULL;
+
+    *op++ = (unsigned char) length;
+
+    return op;
+}
+
+/* 연속된 4바이트의 해시 값을 계산하는 함수 */
+static int HashLz4Sequence(const unsigned char *bytes) {
+    unsigned int sequence;
+
+    memcpy(&sequence, bytes, sizeof sequence);
+
+    // Knuth의 곱셈 해시
+    return (int) ((sequence * 2654435761u) >> (32 - LZ4_HASH_LOG));
+}
+
+/* 사용 방법을 출력하는 함수 */
+static void PrintUsage(const char *programName) {
+    fprintf(stderr,
+            "Usage: %s <input image> <output.h> <array name> [note]\n"
+            "\n"
+            "Decodes the input image once and writes its pixels as an\n"
+            "LZ4-compressed image blob that `LoadImageFromBlob()` can\n"
+            "upload without running an image decoder.\n",
+            programName);
+}
+
+/* 32비트 정수를 리틀 엔디언으로 저장하는 함수 */
+static void WriteUInt32LE(unsigned char *bytes, unsigned int value) {
+    bytes[0] = value & 0xff, bytes[1] = (value >> 8) & 0xff;
+    bytes[2] = (value >> 16) & 0xff, bytes[3] = (value >> 24) & 0xff;
+}